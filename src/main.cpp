@@ -49,7 +49,8 @@ ros::ServiceServer resetOdomSrv;
 XmlRpc::XmlRpcValue rpc_temp;
 
 // Include this header file to get access to VectorNav sensors.
-#include "vn/compositedata.h"
+#include "vn/lazycompositedata.h"
+#include "vn/searcher.h"
 #include "vn/sensors.h"
 #include "vn/util.h"
 
@@ -60,7 +61,7 @@ using namespace vn::protocol::uart;
 using namespace vn::xplat;
 
 // Method declarations for future use.
-void BinaryAsyncMessageReceived(void * userData, Packet & p, size_t index);
+void BinaryAsyncMessageReceived(void * userData, PacketView & p, size_t index);
 
 // Custom user data to pass to packet callback function
 struct UserData
@@ -177,6 +178,13 @@ int main(int argc, char * argv[])
   // Sensor IMURATE (800Hz by default, used to configure device)
   int SensorImuRate;
 
+  // Device configuration caching
+  string identity_cache_dir;
+  bool persist_configuration;
+
+  // Decoding and publishing off the serial thread, 0 to disable
+  int pipeline_queue_capacity;
+
   // Load all params
   pn.param<std::string>("map_frame_id", user_data.map_frame_id, "map");
   pn.param<std::string>("frame_id", user_data.frame_id, "vectornav");
@@ -188,6 +196,9 @@ int main(int argc, char * argv[])
   pn.param<std::string>("serial_port", SensorPort, "/dev/ttyUSB0");
   pn.param<int>("serial_baud", SensorBaudrate, 115200);
   pn.param<int>("fixed_imu_rate", SensorImuRate, 800);
+  pn.param<std::string>("identity_cache_dir", identity_cache_dir, "");
+  pn.param<bool>("persist_configuration", persist_configuration, false);
+  pn.param<int>("pipeline_queue_capacity", pipeline_queue_capacity, 0);
 
   //Call to set covariances
   if (pn.getParam("linear_accel_covariance", rpc_temp)) {
@@ -208,52 +219,33 @@ int main(int argc, char * argv[])
   // Create a VnSensor object and connect to sensor
   VnSensor vs;
 
-  // Default baudrate variable
-  int defaultBaudrate;
-  // Run through all of the acceptable baud rates until we are connected
-  // Looping in case someone has changed the default
-  bool baudSet = false;
-  // Lets add the set baudrate to the top of the list, so that it will try
-  // to connect with that value first (speed initialization up)
-  std::vector<unsigned int> supportedBaudrates = vs.supportedBaudrates();
-  supportedBaudrates.insert(supportedBaudrates.begin(), SensorBaudrate);
-  while (!baudSet) {
-    // Make this variable only accessible in the while loop
-    static int i = 0;
-    defaultBaudrate = supportedBaudrates[i];
-    ROS_INFO("Connecting with default at %d", defaultBaudrate);
-    // Default response was too low and retransmit time was too long by default.
-    // They would cause errors
-    vs.setResponseTimeoutMs(1000);  // Wait for up to 1000 ms for response
-    vs.setRetransmitDelayMs(50);    // Retransmit every 50 ms
-
-    // Acceptable baud rates 9600, 19200, 38400, 57600, 128000, 115200, 230400, 460800, 921600
-    // Data sheet says 128000 is a valid baud rate. It doesn't work with the VN100 so it is excluded.
-    // All other values seem to work fine.
-    try {
-      // Connect to sensor at it's default rate
-      if (defaultBaudrate != 128000 && SensorBaudrate != 128000) {
-        vs.connect(SensorPort, defaultBaudrate);
-        // Issues a change baudrate to the VectorNav sensor and then
-        // reconnects the attached serial port at the new baudrate.
-        vs.changeBaudRate(SensorBaudrate);
-        // Only makes it here once we have the default correct
-        ROS_INFO("Connected baud rate is %d", vs.baudrate());
-        baudSet = true;
-      }
+  // Default response was too low and retransmit time was too long by default.
+  // They would cause errors
+  vs.setResponseTimeoutMs(1000);  // Wait for up to 1000 ms for response
+  vs.setRetransmitDelayMs(50);    // Retransmit every 50 ms
+
+  // Find the baud rate the sensor is at, trying the configured one first. The
+  // sensor's output is listened to before any command is sent, so this is quick
+  // whichever rate the device was left at.
+  uint32_t detectedBaudrate = 0;
+  if (!Searcher::detectBaudrate(SensorPort, &detectedBaudrate, SensorBaudrate)) {
+    ROS_ERROR("No sensor found on %s at any baud rate", SensorPort.c_str());
+    return 1;
+  }
+  ROS_INFO("Detected baud rate %d", detectedBaudrate);
+  try {
+    vs.connect(SensorPort, detectedBaudrate);
+    // Issues a change baudrate to the VectorNav sensor and then
+    // reconnects the attached serial port at the new baudrate.
+    if (detectedBaudrate != (uint32_t)SensorBaudrate) {
+      vs.changeBaudRate(SensorBaudrate);
     }
-    // Catch all oddities
-    catch (...) {
-      // Disconnect if we had the wrong default and we were connected
+    ROS_INFO("Connected baud rate is %d", vs.baudrate());
+  }
+  // Catch all oddities
+  catch (...) {
+    if (vs.isConnected()) {
       vs.disconnect();
-      ros::Duration(0.2).sleep();
-    }
-    // Increment the default iterator
-    i++;
-    // There are only 9 available data rates, if no connection
-    // made yet possibly a hardware malfunction?
-    if (i > 8) {
-      break;
     }
   }
 
@@ -266,13 +258,14 @@ int main(int argc, char * argv[])
     ROS_WARN("9600, 19200, 38400, 57600, 115200, 128000, 230400, 460800, 921600");
     ROS_WARN("With the test IMU 128000 did not work, all others worked fine.");
   }
-  // Query the sensor's model number.
-  string mn = vs.readModelNumber();
-  string fv = vs.readFirmwareVersion();
-  uint32_t hv = vs.readHardwareRevision();
-  uint32_t sn = vs.readSerialNumber();
-  ROS_INFO("Model Number: %s, Firmware Version: %s", mn.c_str(), fv.c_str());
-  ROS_INFO("Hardware Revision : %d, Serial Number : %d", hv, sn);
+  // Query the sensor's identity, from the cache when the sensor was seen before.
+  SensorIdentity identity = vs.readIdentity(identity_cache_dir);
+  string mn = identity.modelNumber;
+  ROS_INFO(
+    "Model Number: %s, Firmware Version: %s", mn.c_str(), identity.firmwareVersion.c_str());
+  ROS_INFO(
+    "Hardware Revision : %d, Serial Number : %d", identity.hardwareRevision,
+    identity.serialNumber);
 
   // calculate the least common multiple of the two rate and assure it is a
   // valid package rate, also calculate the imu and output strides
@@ -293,10 +286,12 @@ int main(int argc, char * argv[])
   ROS_INFO("IMU Publish Rate: %d Hz", imu_output_rate);
 
   // Set the device info for passing to the packet callback function
-  user_data.device_family = vs.determineDeviceFamily();
+  user_data.device_family = VnSensor::determineDeviceFamily(mn);
+
+  OutputConfiguration output_configuration;
 
   // Make sure no generic async output is registered
-  vs.writeAsyncDataOutputType(VNOFF);
+  output_configuration.asyncDataOutputType = VNOFF;
 
   // Configure binary output message
   BinaryOutputRegister bor(
@@ -317,9 +312,19 @@ int main(int argc, char * argv[])
     0, 1, COMMONGROUP_NONE, TIMEGROUP_NONE, IMUGROUP_NONE, GPSGROUP_NONE, ATTITUDEGROUP_NONE,
     INSGROUP_NONE, GPSGROUP_NONE);
 
-  vs.writeBinaryOutput1(bor);
-  vs.writeBinaryOutput2(bor_none);
-  vs.writeBinaryOutput3(bor_none);
+  output_configuration.binaryOutput1 = bor;
+  output_configuration.binaryOutput2 = bor_none;
+  output_configuration.binaryOutput3 = bor_none;
+
+  // Only the registers which differ from the device are written
+  size_t written = vs.applyOutputConfiguration(output_configuration, persist_configuration);
+  ROS_INFO("Output configuration applied, %zu registers written", written);
+
+  // Let the serial thread only frame packets while a worker decodes and publishes them
+  if (pipeline_queue_capacity > 0) {
+    vs.enablePipeline(pipeline_queue_capacity);
+    ROS_INFO("Packet pipeline enabled, queue capacity %d", pipeline_queue_capacity);
+  }
 
   // Register async callback function
   vs.registerAsyncPacketReceivedHandler(&user_data, BinaryAsyncMessageReceived);
@@ -332,6 +337,12 @@ int main(int argc, char * argv[])
   }
 
   // Node has been terminated
+  if (vs.isPipelineEnabled()) {
+    PipelineStatistics stats = vs.pipelineStatistics();
+    ROS_INFO("Packet pipeline queued %zu packets, dropped %zu, maximum depth %zu",
+      stats.numOfPacketsQueued, stats.numOfPacketsDropped, stats.maximumDepth);
+    vs.disablePipeline();
+  }
   vs.unregisterAsyncPacketReceivedHandler();
   ros::Duration(0.5).sleep();
   ROS_INFO("Unregisted the Packet Received Handler");
@@ -343,7 +354,7 @@ int main(int argc, char * argv[])
 
 //Helper function to create IMU message
 void fill_imu_message(
-  sensor_msgs::Imu & msgIMU, vn::sensors::CompositeData & cd, ros::Time & time,
+  sensor_msgs::Imu & msgIMU, vn::sensors::LazyCompositeData & cd, ros::Time & time,
   UserData * user_data)
 {
   msgIMU.header.stamp = time;
@@ -435,7 +446,7 @@ void fill_imu_message(
 
 //Helper function to create magnetic field message
 void fill_mag_message(
-  sensor_msgs::MagneticField & msgMag, vn::sensors::CompositeData & cd, ros::Time & time,
+  sensor_msgs::MagneticField & msgMag, vn::sensors::LazyCompositeData & cd, ros::Time & time,
   UserData * user_data)
 {
   msgMag.header.stamp = time;
@@ -452,7 +463,7 @@ void fill_mag_message(
 
 //Helper function to create gps message
 void fill_gps_message(
-  sensor_msgs::NavSatFix & msgGPS, vn::sensors::CompositeData & cd, ros::Time & time,
+  sensor_msgs::NavSatFix & msgGPS, vn::sensors::LazyCompositeData & cd, ros::Time & time,
   UserData * user_data)
 {
   msgGPS.header.stamp = time;
@@ -491,7 +502,7 @@ void fill_gps_message(
 
 //Helper function to create odometry message
 void fill_odom_message(
-  nav_msgs::Odometry & msgOdom, vn::sensors::CompositeData & cd, ros::Time & time,
+  nav_msgs::Odometry & msgOdom, vn::sensors::LazyCompositeData & cd, ros::Time & time,
   UserData * user_data)
 {
   msgOdom.header.stamp = time;
@@ -634,7 +645,7 @@ void fill_odom_message(
 
 //Helper function to create temperature message
 void fill_temp_message(
-  sensor_msgs::Temperature & msgTemp, vn::sensors::CompositeData & cd, ros::Time & time,
+  sensor_msgs::Temperature & msgTemp, vn::sensors::LazyCompositeData & cd, ros::Time & time,
   UserData * user_data)
 {
   msgTemp.header.stamp = time;
@@ -647,7 +658,7 @@ void fill_temp_message(
 
 //Helper function to create pressure message
 void fill_pres_message(
-  sensor_msgs::FluidPressure & msgPres, vn::sensors::CompositeData & cd, ros::Time & time,
+  sensor_msgs::FluidPressure & msgPres, vn::sensors::LazyCompositeData & cd, ros::Time & time,
   UserData * user_data)
 {
   msgPres.header.stamp = time;
@@ -660,7 +671,8 @@ void fill_pres_message(
 
 //Helper function to create ins message
 void fill_ins_message(
-  vectornav::Ins & msgINS, vn::sensors::CompositeData & cd, ros::Time & time, UserData * user_data)
+  vectornav::Ins & msgINS, vn::sensors::LazyCompositeData & cd, ros::Time & time,
+  UserData * user_data)
 {
   msgINS.header.stamp = time;
   msgINS.header.frame_id = user_data->frame_id;
@@ -723,7 +735,7 @@ void fill_ins_message(
 }
 
 static ros::Time get_time_stamp(
-  vn::sensors::CompositeData & cd, UserData * user_data, const ros::Time & ros_time)
+  vn::sensors::LazyCompositeData & cd, UserData * user_data, const ros::Time & ros_time)
 {
   if (!cd.hasTimeStartup() || !user_data->adjust_ros_timestamp) {
     return (ros_time);  // don't adjust timestamp
@@ -751,7 +763,7 @@ static ros::Time get_time_stamp(
 //
 // Callback function to process data packet from sensor
 //
-void BinaryAsyncMessageReceived(void * userData, Packet & p, size_t index)
+void BinaryAsyncMessageReceived(void * userData, PacketView & p, size_t index)
 {
   // package counter to calculate strides
   static unsigned long long pkg_count = 0;
@@ -759,7 +771,13 @@ void BinaryAsyncMessageReceived(void * userData, Packet & p, size_t index)
   // evaluate time first, to have it as close to the measurement time as possible
   const ros::Time ros_time = ros::Time::now();
 
-  vn::sensors::CompositeData cd = vn::sensors::CompositeData::parse(p);
+  // Only indexes the packet, fields are decoded when a message that has subscribers reads them
+  vn::sensors::LazyCompositeData cd;
+  if (!vn::sensors::LazyCompositeData::tryParse(p, cd)) {
+    // Drop packets that are too short for their header without unwinding on the serial thread
+    ROS_WARN_THROTTLE(1.0, "Dropped a malformed binary packet");
+    return;
+  }
   UserData * user_data = static_cast<UserData *>(userData);
   ros::Time time = get_time_stamp(cd, user_data, ros_time);
 
@@ -0,0 +1,434 @@
+/// \file
+/// {COMMON_HEADER}
+///
+/// \section DESCRIPTION
+/// This header file provides the structure BinaryOutputData and the class
+/// template BinaryOutputDecoder.
+#ifndef _VNPROTOCOL_UART_BINARYDECODER_H_
+#define _VNPROTOCOL_UART_BINARYDECODER_H_
+
+#include <cstring>
+
+#include "int.h"
+#include "compiler.h"
+#include "types.h"
+#include "vector.h"
+#include "matrix.h"
+#include "packet.h"
+
+#if VN_SUPPORTS_CONSTEXPR
+
+namespace vn {
+namespace protocol {
+namespace uart {
+
+#define VN_BINARY_OUTPUT_FIELD_LENGTHS(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14) \
+	{ a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, 0 },
+
+/// \brief Sizes of the binary group fields, indexed by group and then by the
+/// bit position of the field in the group field. This is the table behind
+/// Packet::BinaryGroupLengths, made available at compile time.
+constexpr unsigned char BinaryOutputFieldLengths[7][16] = {
+	VN_BINARY_GROUP_FIELD_LENGTHS(VN_BINARY_OUTPUT_FIELD_LENGTHS)
+};
+
+#undef VN_BINARY_OUTPUT_FIELD_LENGTHS
+
+/// \brief Computes the combined size of the fields of a binary group.
+///
+/// \param[in] groupIndex The index of the group (0 for the Common Group).
+/// \param[in] groupField The flags for data types present.
+/// \param[in] bit The first bit position of the group field to include.
+/// \return The number of bytes for the fields at or above the bit position.
+constexpr size_t binaryOutputFieldsLength(size_t groupIndex, unsigned groupField, unsigned bit = 0)
+{
+	return bit == 16 ? 0 :
+		(((groupField >> bit) & 1u) ? BinaryOutputFieldLengths[groupIndex][bit] : 0) + binaryOutputFieldsLength(groupIndex, groupField, bit + 1);
+}
+
+/// \brief Returns the position of the lowest set bit of a non-zero value.
+///
+/// \param[in] value The value.
+/// \param[in] bit The bit position to start searching from.
+/// \return The bit position.
+constexpr unsigned binaryOutputLowestBit(unsigned value, unsigned bit = 0)
+{
+	return ((value >> bit) & 1u) ? bit : binaryOutputLowestBit(value, bit + 1);
+}
+
+/// \brief Plain structure holding the fields of a binary output packet as
+/// they are sent by the sensor.
+///
+/// Values are not converted in any way; for example, times are in
+/// nanoseconds and status fields are their raw flags. Only the fields
+/// selected by the group fields were decoded. Fields that are available in
+/// more than one group share a member, as they do in CompositeData.
+struct BinaryOutputData
+{
+	uint16_t commonField;			///< Common Group fields decoded.
+	uint16_t timeField;				///< Time Group fields decoded.
+	uint16_t imuField;				///< IMU Group fields decoded.
+	uint16_t gpsField;				///< GPS Group fields decoded.
+	uint16_t attitudeField;			///< Attitude Group fields decoded.
+	uint16_t insField;				///< INS Group fields decoded.
+	uint16_t gps2Field;				///< GPS2 Group fields decoded.
+
+	uint64_t timeStartup;			///< Time since startup [ns].
+	uint64_t timeGps;				///< GPS time [ns].
+	uint64_t timeSyncIn;			///< Time since the last SyncIn trigger [ns].
+	uint64_t timeGpsPps;			///< Time since the last GPS PPS trigger [ns].
+	uint64_t tow;					///< GPS time of week from the Time Group [ns].
+	uint16_t week;					///< GPS week from the Time Group.
+	TimeUtc timeUtc;				///< UTC time.
+	uint32_t syncInCnt;				///< SyncIn count.
+	uint32_t syncOutCnt;			///< SyncOut count.
+	uint8_t timeStatus;				///< Time status flags.
+
+	math::vec3f yawPitchRoll;		///< Yaw, pitch, roll [deg].
+	math::vec4f quaternion;			///< Attitude quaternion.
+	math::mat3f directionCosineMatrix;	///< Direction cosine matrix.
+	math::vec3f angularRate;		///< Compensated angular rate [rad/s].
+	math::vec3f acceleration;		///< Compensated acceleration [m/s^2].
+	math::vec3f magnetic;			///< Compensated magnetic field [Gauss].
+	math::vec3f angularRateUncompensated;	///< Uncompensated angular rate [rad/s].
+	math::vec3f accelerationUncompensated;	///< Uncompensated acceleration [m/s^2].
+	math::vec3f magneticUncompensated;		///< Uncompensated magnetic field [Gauss].
+	float temperature;				///< Temperature [C].
+	float pressure;					///< Pressure [kPa].
+	float deltaTime;				///< Delta time [s].
+	math::vec3f deltaTheta;			///< Delta theta [deg].
+	math::vec3f deltaVelocity;		///< Delta velocity [m/s].
+	uint16_t imuStatus;				///< IMU status (reserved).
+	uint16_t sensSat;				///< Sensor saturation flags.
+
+	uint16_t vpeStatus;				///< VPE status flags.
+	math::vec3f magneticNed;		///< Magnetic field in the NED frame [Gauss].
+	math::vec3f accelerationNed;	///< Acceleration in the NED frame [m/s^2].
+	math::vec3f accelerationLinearBody;	///< Linear acceleration in the body frame [m/s^2].
+	math::vec3f accelerationLinearNed;	///< Linear acceleration in the NED frame [m/s^2].
+	math::vec3f attitudeUncertainty;	///< Yaw, pitch, roll uncertainty [deg].
+
+	uint16_t insStatus;				///< INS status flags.
+	math::vec3d positionEstimatedLla;	///< Estimated latitude, longitude, altitude.
+	math::vec3d positionEstimatedEcef;	///< Estimated position in the ECEF frame [m].
+	math::vec3f velocityEstimatedBody;	///< Estimated velocity in the body frame [m/s].
+	math::vec3f velocityEstimatedNed;	///< Estimated velocity in the NED frame [m/s].
+	math::vec3f velocityEstimatedEcef;	///< Estimated velocity in the ECEF frame [m/s].
+	math::vec3f magneticEcef;		///< Magnetic field in the ECEF frame [Gauss].
+	math::vec3f accelerationEcef;	///< Acceleration in the ECEF frame [m/s^2].
+	math::vec3f accelerationLinearEcef;	///< Linear acceleration in the ECEF frame [m/s^2].
+	float positionUncertaintyEstimated;	///< Estimated position uncertainty [m].
+	float velocityUncertaintyEstimated;	///< Estimated velocity uncertainty [m/s].
+
+	uint64_t gpsTow;				///< GPS time of week [ns].
+	uint16_t gpsWeek;				///< GPS week.
+	uint8_t numSats;				///< Number of satellites.
+	uint8_t fix;					///< GPS fix.
+	math::vec3d positionGpsLla;		///< GPS latitude, longitude, altitude.
+	math::vec3d positionGpsEcef;	///< GPS position in the ECEF frame [m].
+	math::vec3f velocityGpsNed;		///< GPS velocity in the NED frame [m/s].
+	math::vec3f velocityGpsEcef;	///< GPS velocity in the ECEF frame [m/s].
+	math::vec3f positionUncertaintyGpsNed;	///< GPS position uncertainty [m].
+	float velocityUncertaintyGps;	///< GPS velocity uncertainty [m/s].
+	uint32_t timeUncertainty;		///< GPS time uncertainty [ns].
+	TimeInfo timeInfo;				///< GPS time info.
+	GnssDop gnssDop;				///< GPS dilution of precision.
+
+	TimeUtc timeUtc2;				///< GPS2 UTC time.
+	uint64_t gps2Tow;				///< GPS2 time of week [ns].
+	uint16_t gps2Week;				///< GPS2 week.
+	uint8_t numSats2;				///< GPS2 number of satellites.
+	uint8_t fix2;					///< GPS2 fix.
+	math::vec3d positionGps2Lla;	///< GPS2 latitude, longitude, altitude.
+	math::vec3d positionGps2Ecef;	///< GPS2 position in the ECEF frame [m].
+	math::vec3f velocityGps2Ned;	///< GPS2 velocity in the NED frame [m/s].
+	math::vec3f velocityGps2Ecef;	///< GPS2 velocity in the ECEF frame [m/s].
+	math::vec3f positionUncertaintyGps2Ned;	///< GPS2 position uncertainty [m].
+	float velocityUncertaintyGps2;	///< GPS2 velocity uncertainty [m/s].
+	uint32_t timeUncertainty2;		///< GPS2 time uncertainty [ns].
+	TimeInfo timeInfo2;				///< GPS2 time info.
+	GnssDop gnssDop2;				///< GPS2 dilution of precision.
+};
+
+/// \brief Decoder for binary output packets with a layout known at compile
+/// time.
+///
+/// The group fields are template parameters, so the length of the packet and
+/// the offset of every field are computed by the compiler. Decoding a packet
+/// is a single length and header check followed by a fixed sequence of
+/// copies, without the per-field checks CompositeData::parse performs.
+/// Fields the library does not represent are skipped over correctly.
+///
+/// Values are copied as they are stored in the packet, so the decoder
+/// expects a little-endian processor like the rest of the binary parsing.
+///
+/// [Example]
+///
+/// typedef BinaryOutputDecoder<
+///     COMMONGROUP_YAWPITCHROLL | COMMONGROUP_ANGULARRATE, TIMEGROUP_NONE,
+///     IMUGROUP_NONE, GPSGROUP_NONE, ATTITUDEGROUP_NONE, INSGROUP_NONE,
+///     GPSGROUP_NONE> Decoder;
+///
+/// BinaryOutputData d;
+///
+/// if (Decoder::decode(packet, d))
+///     use(d.yawPitchRoll, d.angularRate);
+template<uint16_t CommonField, uint16_t TimeField, uint16_t ImuField, uint16_t GpsField, uint16_t AttitudeField, uint16_t InsField, uint16_t Gps2Field>
+class BinaryOutputDecoder
+{
+
+public:
+
+	/// \brief Returns the group field configured for a group.
+	///
+	/// \param[in] groupIndex The index of the group (0 for the Common Group).
+	/// \return The group field.
+	static constexpr uint16_t groupField(size_t groupIndex)
+	{
+		return groupIndex == 0 ? CommonField :
+			groupIndex == 1 ? TimeField :
+			groupIndex == 2 ? ImuField :
+			groupIndex == 3 ? GpsField :
+			groupIndex == 4 ? AttitudeField :
+			groupIndex == 5 ? InsField :
+			groupIndex == 6 ? Gps2Field : 0;
+	}
+
+	/// \brief Returns the offset of a group's payload in the packet.
+	///
+	/// \param[in] groupIndex The index of the group (0 for the Common Group),
+	///     or 7 for the offset of the CRC.
+	/// \return The offset of the group's payload.
+	static constexpr size_t groupOffset(size_t groupIndex)
+	{
+		return groupIndex == 0 ? HeaderLength :
+			groupOffset(groupIndex - 1) + binaryOutputFieldsLength(groupIndex - 1, groupField(groupIndex - 1));
+	}
+
+	/// \brief Returns the offset of a field in the packet.
+	///
+	/// \param[in] group The group the field belongs to.
+	/// \param[in] field The field's flag in the group field.
+	/// \return The offset of the field.
+	static constexpr size_t fieldOffset(BinaryGroup group, uint16_t field)
+	{
+		return groupOffset(binaryOutputLowestBit(group)) + binaryOutputFieldsLength(binaryOutputLowestBit(group), groupField(binaryOutputLowestBit(group)) & (field - 1u));
+	}
+
+	/// \brief The groups present byte of the packet.
+	static constexpr uint8_t GroupsPresent =
+		(CommonField ? BINARYGROUP_COMMON : 0) |
+		(TimeField ? BINARYGROUP_TIME : 0) |
+		(ImuField ? BINARYGROUP_IMU : 0) |
+		(GpsField ? BINARYGROUP_GPS : 0) |
+		(AttitudeField ? BINARYGROUP_ATTITUDE : 0) |
+		(InsField ? BINARYGROUP_INS : 0) |
+		(Gps2Field ? BINARYGROUP_GPS2 : 0);
+
+	/// \brief The number of bytes before the first payload byte.
+	static constexpr size_t HeaderLength = 2 + 2 * (
+		(CommonField ? 1 : 0) + (TimeField ? 1 : 0) + (ImuField ? 1 : 0) + (GpsField ? 1 : 0) +
+		(AttitudeField ? 1 : 0) + (InsField ? 1 : 0) + (Gps2Field ? 1 : 0));
+
+	/// \brief Returns the number of bytes in a packet, including the CRC.
+	///
+	/// \return The packet length.
+	static constexpr size_t packetLength()
+	{
+		return groupOffset(7) + 2;
+	}
+
+	static_assert(GroupsPresent != 0, "A binary output must contain at least one group.");
+
+	/// \brief Decodes a binary packet with this layout. The packet's CRC is
+	/// expected to have been checked already, as it is for packets provided
+	/// by a PacketFinder.
+	///
+	/// \param[in] packet The packet to decode.
+	/// \param[out] data The structure to decode into.
+	/// \return <c>true</c> if the packet has this layout and was decoded;
+	///     otherwise <c>false</c>.
+	static bool decode(PacketView& packet, BinaryOutputData& data)
+	{
+		return decode(packet.data(), packet.length(), data);
+	}
+
+	/// \brief Decodes a binary packet with this layout. The packet's CRC is
+	/// expected to have been checked already.
+	///
+	/// \param[in] packet The packet data, starting with the sync byte.
+	/// \param[in] length The number of bytes in the packet.
+	/// \param[out] data The structure to decode into.
+	/// \return <c>true</c> if the packet has this layout and was decoded;
+	///     otherwise <c>false</c>.
+	static bool decode(const char* packet, size_t length, BinaryOutputData& data)
+	{
+		if (length != packetLength() || !hasHeader(packet))
+			return false;
+
+		data.commonField = CommonField;
+		data.timeField = TimeField;
+		data.imuField = ImuField;
+		data.gpsField = GpsField;
+		data.attitudeField = AttitudeField;
+		data.insField = InsField;
+		data.gps2Field = Gps2Field;
+
+		decodeField<BINARYGROUP_COMMON, COMMONGROUP_TIMESTARTUP, 0>(packet, data.timeStartup);
+		decodeField<BINARYGROUP_COMMON, COMMONGROUP_TIMEGPS, 0>(packet, data.timeGps);
+		decodeField<BINARYGROUP_COMMON, COMMONGROUP_TIMESYNCIN, 0>(packet, data.timeSyncIn);
+		decodeField<BINARYGROUP_COMMON, COMMONGROUP_YAWPITCHROLL, 0>(packet, data.yawPitchRoll);
+		decodeField<BINARYGROUP_COMMON, COMMONGROUP_QUATERNION, 0>(packet, data.quaternion);
+		decodeField<BINARYGROUP_COMMON, COMMONGROUP_ANGULARRATE, 0>(packet, data.angularRate);
+		decodeField<BINARYGROUP_COMMON, COMMONGROUP_POSITION, 0>(packet, data.positionEstimatedLla);
+		decodeField<BINARYGROUP_COMMON, COMMONGROUP_VELOCITY, 0>(packet, data.velocityEstimatedNed);
+		decodeField<BINARYGROUP_COMMON, COMMONGROUP_ACCEL, 0>(packet, data.acceleration);
+		decodeField<BINARYGROUP_COMMON, COMMONGROUP_IMU, 0>(packet, data.accelerationUncompensated);
+		decodeField<BINARYGROUP_COMMON, COMMONGROUP_IMU, 12>(packet, data.angularRateUncompensated);
+		decodeField<BINARYGROUP_COMMON, COMMONGROUP_MAGPRES, 0>(packet, data.magnetic);
+		decodeField<BINARYGROUP_COMMON, COMMONGROUP_MAGPRES, 12>(packet, data.temperature);
+		decodeField<BINARYGROUP_COMMON, COMMONGROUP_MAGPRES, 16>(packet, data.pressure);
+		decodeField<BINARYGROUP_COMMON, COMMONGROUP_DELTATHETA, 0>(packet, data.deltaTime);
+		decodeField<BINARYGROUP_COMMON, COMMONGROUP_DELTATHETA, 4>(packet, data.deltaTheta);
+		decodeField<BINARYGROUP_COMMON, COMMONGROUP_DELTATHETA, 16>(packet, data.deltaVelocity);
+		// Depending on the sensor this is either the VPE or the INS status.
+		decodeField<BINARYGROUP_COMMON, COMMONGROUP_INSSTATUS, 0>(packet, data.vpeStatus);
+		decodeField<BINARYGROUP_COMMON, COMMONGROUP_INSSTATUS, 0>(packet, data.insStatus);
+		decodeField<BINARYGROUP_COMMON, COMMONGROUP_SYNCINCNT, 0>(packet, data.syncInCnt);
+		decodeField<BINARYGROUP_COMMON, COMMONGROUP_TIMEGPSPPS, 0>(packet, data.timeGpsPps);
+
+		decodeField<BINARYGROUP_TIME, TIMEGROUP_TIMESTARTUP, 0>(packet, data.timeStartup);
+		decodeField<BINARYGROUP_TIME, TIMEGROUP_TIMEGPS, 0>(packet, data.timeGps);
+		decodeField<BINARYGROUP_TIME, TIMEGROUP_GPSTOW, 0>(packet, data.tow);
+		decodeField<BINARYGROUP_TIME, TIMEGROUP_GPSWEEK, 0>(packet, data.week);
+		decodeField<BINARYGROUP_TIME, TIMEGROUP_TIMESYNCIN, 0>(packet, data.timeSyncIn);
+		decodeField<BINARYGROUP_TIME, TIMEGROUP_TIMEGPSPPS, 0>(packet, data.timeGpsPps);
+		decodeField<BINARYGROUP_TIME, TIMEGROUP_TIMEUTC, 0>(packet, data.timeUtc);
+		decodeField<BINARYGROUP_TIME, TIMEGROUP_SYNCINCNT, 0>(packet, data.syncInCnt);
+		decodeField<BINARYGROUP_TIME, TIMEGROUP_SYNCOUTCNT, 0>(packet, data.syncOutCnt);
+		decodeField<BINARYGROUP_TIME, TIMEGROUP_TIMESTATUS, 0>(packet, data.timeStatus);
+
+		decodeField<BINARYGROUP_IMU, IMUGROUP_IMUSTATUS, 0>(packet, data.imuStatus);
+		decodeField<BINARYGROUP_IMU, IMUGROUP_UNCOMPMAG, 0>(packet, data.magneticUncompensated);
+		decodeField<BINARYGROUP_IMU, IMUGROUP_UNCOMPACCEL, 0>(packet, data.accelerationUncompensated);
+		decodeField<BINARYGROUP_IMU, IMUGROUP_UNCOMPGYRO, 0>(packet, data.angularRateUncompensated);
+		decodeField<BINARYGROUP_IMU, IMUGROUP_TEMP, 0>(packet, data.temperature);
+		decodeField<BINARYGROUP_IMU, IMUGROUP_PRES, 0>(packet, data.pressure);
+		decodeField<BINARYGROUP_IMU, IMUGROUP_DELTATHETA, 0>(packet, data.deltaTime);
+		decodeField<BINARYGROUP_IMU, IMUGROUP_DELTATHETA, 4>(packet, data.deltaTheta);
+		decodeField<BINARYGROUP_IMU, IMUGROUP_DELTAVEL, 0>(packet, data.deltaVelocity);
+		decodeField<BINARYGROUP_IMU, IMUGROUP_MAG, 0>(packet, data.magnetic);
+		decodeField<BINARYGROUP_IMU, IMUGROUP_ACCEL, 0>(packet, data.acceleration);
+		decodeField<BINARYGROUP_IMU, IMUGROUP_ANGULARRATE, 0>(packet, data.angularRate);
+		decodeField<BINARYGROUP_IMU, IMUGROUP_SENSSAT, 0>(packet, data.sensSat);
+
+		decodeField<BINARYGROUP_GPS, GPSGROUP_UTC, 0>(packet, data.timeUtc);
+		decodeField<BINARYGROUP_GPS, GPSGROUP_TOW, 0>(packet, data.gpsTow);
+		decodeField<BINARYGROUP_GPS, GPSGROUP_WEEK, 0>(packet, data.gpsWeek);
+		decodeField<BINARYGROUP_GPS, GPSGROUP_NUMSATS, 0>(packet, data.numSats);
+		decodeField<BINARYGROUP_GPS, GPSGROUP_FIX, 0>(packet, data.fix);
+		decodeField<BINARYGROUP_GPS, GPSGROUP_POSLLA, 0>(packet, data.positionGpsLla);
+		decodeField<BINARYGROUP_GPS, GPSGROUP_POSECEF, 0>(packet, data.positionGpsEcef);
+		decodeField<BINARYGROUP_GPS, GPSGROUP_VELNED, 0>(packet, data.velocityGpsNed);
+		decodeField<BINARYGROUP_GPS, GPSGROUP_VELECEF, 0>(packet, data.velocityGpsEcef);
+		decodeField<BINARYGROUP_GPS, GPSGROUP_POSU, 0>(packet, data.positionUncertaintyGpsNed);
+		decodeField<BINARYGROUP_GPS, GPSGROUP_VELU, 0>(packet, data.velocityUncertaintyGps);
+		decodeField<BINARYGROUP_GPS, GPSGROUP_TIMEU, 0>(packet, data.timeUncertainty);
+		decodeField<BINARYGROUP_GPS, GPSGROUP_TIMEINFO, 0>(packet, data.timeInfo);
+		decodeField<BINARYGROUP_GPS, GPSGROUP_DOP, 0>(packet, data.gnssDop);
+
+		decodeField<BINARYGROUP_ATTITUDE, ATTITUDEGROUP_VPESTATUS, 0>(packet, data.vpeStatus);
+		decodeField<BINARYGROUP_ATTITUDE, ATTITUDEGROUP_YAWPITCHROLL, 0>(packet, data.yawPitchRoll);
+		decodeField<BINARYGROUP_ATTITUDE, ATTITUDEGROUP_QUATERNION, 0>(packet, data.quaternion);
+		decodeField<BINARYGROUP_ATTITUDE, ATTITUDEGROUP_DCM, 0>(packet, data.directionCosineMatrix);
+		decodeField<BINARYGROUP_ATTITUDE, ATTITUDEGROUP_MAGNED, 0>(packet, data.magneticNed);
+		decodeField<BINARYGROUP_ATTITUDE, ATTITUDEGROUP_ACCELNED, 0>(packet, data.accelerationNed);
+		decodeField<BINARYGROUP_ATTITUDE, ATTITUDEGROUP_LINEARACCELBODY, 0>(packet, data.accelerationLinearBody);
+		decodeField<BINARYGROUP_ATTITUDE, ATTITUDEGROUP_LINEARACCELNED, 0>(packet, data.accelerationLinearNed);
+		decodeField<BINARYGROUP_ATTITUDE, ATTITUDEGROUP_YPRU, 0>(packet, data.attitudeUncertainty);
+
+		decodeField<BINARYGROUP_INS, INSGROUP_INSSTATUS, 0>(packet, data.insStatus);
+		decodeField<BINARYGROUP_INS, INSGROUP_POSLLA, 0>(packet, data.positionEstimatedLla);
+		decodeField<BINARYGROUP_INS, INSGROUP_POSECEF, 0>(packet, data.positionEstimatedEcef);
+		decodeField<BINARYGROUP_INS, INSGROUP_VELBODY, 0>(packet, data.velocityEstimatedBody);
+		decodeField<BINARYGROUP_INS, INSGROUP_VELNED, 0>(packet, data.velocityEstimatedNed);
+		decodeField<BINARYGROUP_INS, INSGROUP_VELECEF, 0>(packet, data.velocityEstimatedEcef);
+		decodeField<BINARYGROUP_INS, INSGROUP_MAGECEF, 0>(packet, data.magneticEcef);
+		decodeField<BINARYGROUP_INS, INSGROUP_ACCELECEF, 0>(packet, data.accelerationEcef);
+		decodeField<BINARYGROUP_INS, INSGROUP_LINEARACCELECEF, 0>(packet, data.accelerationLinearEcef);
+		decodeField<BINARYGROUP_INS, INSGROUP_POSU, 0>(packet, data.positionUncertaintyEstimated);
+		decodeField<BINARYGROUP_INS, INSGROUP_VELU, 0>(packet, data.velocityUncertaintyEstimated);
+
+		decodeField<BINARYGROUP_GPS2, GPSGROUP_UTC, 0>(packet, data.timeUtc2);
+		decodeField<BINARYGROUP_GPS2, GPSGROUP_TOW, 0>(packet, data.gps2Tow);
+		decodeField<BINARYGROUP_GPS2, GPSGROUP_WEEK, 0>(packet, data.gps2Week);
+		decodeField<BINARYGROUP_GPS2, GPSGROUP_NUMSATS, 0>(packet, data.numSats2);
+		decodeField<BINARYGROUP_GPS2, GPSGROUP_FIX, 0>(packet, data.fix2);
+		decodeField<BINARYGROUP_GPS2, GPSGROUP_POSLLA, 0>(packet, data.positionGps2Lla);
+		decodeField<BINARYGROUP_GPS2, GPSGROUP_POSECEF, 0>(packet, data.positionGps2Ecef);
+		decodeField<BINARYGROUP_GPS2, GPSGROUP_VELNED, 0>(packet, data.velocityGps2Ned);
+		decodeField<BINARYGROUP_GPS2, GPSGROUP_VELECEF, 0>(packet, data.velocityGps2Ecef);
+		decodeField<BINARYGROUP_GPS2, GPSGROUP_POSU, 0>(packet, data.positionUncertaintyGps2Ned);
+		decodeField<BINARYGROUP_GPS2, GPSGROUP_VELU, 0>(packet, data.velocityUncertaintyGps2);
+		decodeField<BINARYGROUP_GPS2, GPSGROUP_TIMEU, 0>(packet, data.timeUncertainty2);
+		decodeField<BINARYGROUP_GPS2, GPSGROUP_TIMEINFO, 0>(packet, data.timeInfo2);
+		decodeField<BINARYGROUP_GPS2, GPSGROUP_DOP, 0>(packet, data.gnssDop2);
+
+		return true;
+	}
+
+private:
+
+	// Checks the groups present and the group fields of a packet, which are
+	// all known at compile time.
+	static bool hasHeader(const char* packet)
+	{
+		if (static_cast<uint8_t>(packet[1]) != GroupsPresent)
+			return false;
+
+		size_t offset = 2;
+
+		for (size_t i = 0; i < 7; i++)
+		{
+			if (groupField(i) == 0)
+				continue;
+
+			uint16_t field = static_cast<uint16_t>(static_cast<uint8_t>(packet[offset]) | (static_cast<uint8_t>(packet[offset + 1]) << 8));
+
+			if (field != groupField(i))
+				return false;
+
+			offset += 2;
+		}
+
+		return true;
+	}
+
+	// Copies part of a field out of the packet if the field is configured.
+	// Both the condition and the offset are constant, so this compiles down
+	// to either nothing or a single copy.
+	template<BinaryGroup Group, uint16_t Field, size_t OffsetInField, typename T>
+	static void decodeField(const char* packet, T& value)
+	{
+		static_assert(OffsetInField + sizeof(T) <= BinaryOutputFieldLengths[binaryOutputLowestBit(Group)][binaryOutputLowestBit(Field)],
+			"Value does not fit in the binary field.");
+
+		if ((groupField(binaryOutputLowestBit(Group)) & Field) != 0)
+			std::memcpy(&value, packet + fieldOffset(Group, Field) + OffsetInField, sizeof(T));
+	}
+
+};
+
+template<uint16_t CommonField, uint16_t TimeField, uint16_t ImuField, uint16_t GpsField, uint16_t AttitudeField, uint16_t InsField, uint16_t Gps2Field>
+constexpr uint8_t BinaryOutputDecoder<CommonField, TimeField, ImuField, GpsField, AttitudeField, InsField, Gps2Field>::GroupsPresent;
+
+template<uint16_t CommonField, uint16_t TimeField, uint16_t ImuField, uint16_t GpsField, uint16_t AttitudeField, uint16_t InsField, uint16_t Gps2Field>
+constexpr size_t BinaryOutputDecoder<CommonField, TimeField, ImuField, GpsField, AttitudeField, InsField, Gps2Field>::HeaderLength;
+
+}
+}
+}
+
+#endif
+
+#endif
@@ -0,0 +1,128 @@
+/// \file
+/// {COMMON_HEADER}
+///
+/// \section DESCRIPTION
+/// This header file provides the class CommandBuilder.
+#ifndef _VNPROTOCOL_UART_COMMANDBUILDER_H_
+#define _VNPROTOCOL_UART_COMMANDBUILDER_H_
+
+#include <cstddef>
+
+#include "int.h"
+#include "export.h"
+
+namespace vn {
+namespace protocol {
+namespace uart {
+
+/// \brief Builds an ASCII command directly in a caller supplied buffer.
+///
+/// Each value is written by the method matching its printf conversion, so the
+/// format is fixed when the command is compiled instead of being interpreted
+/// when it is sent. The output is identical to the corresponding printf
+/// conversion, and the buffer is always kept null-terminated. Characters that
+/// do not fit in the buffer are dropped.
+class vn_proglib_DLLEXPORT CommandBuilder
+{
+
+	// Constructors ///////////////////////////////////////////////////////////
+
+public:
+
+	/// \brief Creates a new builder which writes from the start of a buffer.
+	///
+	/// \param[in] buffer The buffer to write the command to.
+	/// \param[in] size The size of the buffer, including room for the null
+	///     terminator.
+	CommandBuilder(char *buffer, size_t size);
+
+	// Public Methods /////////////////////////////////////////////////////////
+
+public:
+
+	/// \brief Returns the number of characters written so far, not counting
+	/// the null terminator.
+	///
+	/// \return The length of the command.
+	size_t length() const { return _length; }
+
+	/// \brief Appends a string literal. Its length is known at compile time.
+	///
+	/// \param[in] text The string literal to append.
+	/// \return Reference to this builder.
+	template<size_t N>
+	CommandBuilder& append(const char (&text)[N])
+	{
+		return appendCharacters(text, N - 1);
+	}
+
+	/// \brief Appends a single character.
+	///
+	/// \param[in] character The character to append.
+	/// \return Reference to this builder.
+	CommandBuilder& append(char character);
+
+	/// \brief Appends a null-terminated string, like the <c>%s</c>
+	/// conversion.
+	///
+	/// \param[in] text The string to append.
+	/// \return Reference to this builder.
+	CommandBuilder& appendString(const char *text);
+
+	/// \brief Appends an unsigned decimal integer, like the <c>%u</c>
+	/// conversion.
+	///
+	/// \param[in] value The value to append.
+	/// \return Reference to this builder.
+	CommandBuilder& appendUnsigned(uint32_t value);
+
+	/// \brief Appends a signed decimal integer, like the <c>%d</c> conversion.
+	///
+	/// \param[in] value The value to append.
+	/// \return Reference to this builder.
+	CommandBuilder& appendSigned(int32_t value);
+
+	/// \brief Appends an uppercase hexadecimal integer, like the <c>%X</c>
+	/// conversion.
+	///
+	/// \param[in] value The value to append.
+	/// \param[in] width The minimum number of digits, padded with leading
+	///     zeros as with <c>%02X</c> and <c>%04X</c>.
+	/// \return Reference to this builder.
+	CommandBuilder& appendHex(uint32_t value, size_t width = 0);
+
+	/// \brief Appends a floating-point value with six digits after the decimal
+	/// point, like the <c>%f</c> conversion.
+	///
+	/// \param[in] value The value to append.
+	/// \return Reference to this builder.
+	CommandBuilder& appendFixed(double value);
+
+	/// \brief Appends a floating-point value in exponential notation with six
+	/// digits after the decimal point, like the <c>%E</c> conversion.
+	///
+	/// \param[in] value The value to append.
+	/// \return Reference to this builder.
+	CommandBuilder& appendScientific(double value);
+
+	// Private Methods ////////////////////////////////////////////////////////
+
+private:
+
+	CommandBuilder& appendCharacters(const char *text, size_t length);
+
+	// Private Members ////////////////////////////////////////////////////////
+
+private:
+
+	char *_buffer;
+	size_t _size;
+	size_t _length;
+
+};
+
+}
+}
+}
+
+#endif
@@ -50,6 +50,57 @@
 	#define VN_SUPPORTS_INITIALIZER_LIST 1
 #endif
 
+// The VN_SUPPORTS_MOVE define indicates if the compiler supports rvalue
+// references, allowing classes to provide move constructors and move
+// assignment operators.
+//
+// [Example]
+//
+// #if VN_SUPPORTS_MOVE
+//     Packet p(std::move(responses.front()));
+// #else
+//     Packet p(responses.front());
+// #endif
+//
+#if (defined(_MSC_VER) && _MSC_VER >= 1600) || (__cplusplus >= 201103L)
+	#define VN_SUPPORTS_MOVE 1
+#else
+	#define VN_SUPPORTS_MOVE 0
+#endif
+
+// The VN_SUPPORTS_CONSTEXPR define indicates if the compiler supports
+// constexpr functions and variables, allowing values such as the layout of a
+// binary output to be computed at compile time. VN_CONSTEXPR expands to
+// constexpr when it is supported.
+//
+// [Example]
+//
+// #if VN_SUPPORTS_CONSTEXPR
+//     static_assert(Decoder::packetLength() <= 600, "Packet is too large.");
+// #endif
+//
+#if (defined(_MSC_VER) && _MSC_VER >= 1900) || (__cplusplus >= 201103L)
+	#define VN_SUPPORTS_CONSTEXPR 1
+	#define VN_CONSTEXPR constexpr
+#else
+	#define VN_SUPPORTS_CONSTEXPR 0
+	#define VN_CONSTEXPR
+#endif
+
+// The VN_NOEXCEPT define expands to noexcept when the compiler supports it.
+// It marks the functions of the exception-free decoding API so the compiler
+// can omit unwinding support from their callers.
+//
+// [Example]
+//
+// bool tryExtract(uint8_t& value) VN_NOEXCEPT;
+//
+#if (defined(_MSC_VER) && _MSC_VER >= 1900) || (__cplusplus >= 201103L)
+	#define VN_NOEXCEPT noexcept
+#else
+	#define VN_NOEXCEPT
+#endif
+
 // The VN_SUPPORTS_CSTR_STRING_CONCATENATE define indictes if the compiler supports
 // concatenating a C-style string with std::string using the '+' operator.
 //
@@ -76,4 +127,26 @@
 	#define VN_HAVE_SECURE_SCL 0
 #endif
 
+// The VN_HAVE_SSE2 and VN_HAVE_AVX2 defines indicate if the compiler is
+// generating code for a processor with the SSE2 or AVX2 instruction sets, in
+// which case the corresponding intrinsics headers may be used.
+//
+// [Example]
+//
+// #if VN_HAVE_SSE2
+//     #include <emmintrin.h>
+// #endif
+//
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define VN_HAVE_SSE2 1
+#else
+	#define VN_HAVE_SSE2 0
+#endif
+
+#if defined(__AVX2__)
+	#define VN_HAVE_AVX2 1
+#else
+	#define VN_HAVE_AVX2 0
+#endif
+
 #endif
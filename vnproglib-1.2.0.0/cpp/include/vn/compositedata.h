@@ -27,19 +27,64 @@ public:
 	///
 	/// \param[in] p The packet to parse.
 	/// \return The data contained in the parsed packet.
-	static CompositeData parse(protocol::uart::Packet& p);
+	static CompositeData parse(protocol::uart::PacketView& p);
 
 	/// \brief Parses a packet.
 	///
 	/// \param[in] p The packet to parse.
 	/// \param[in/out] o The CompositeData structure to write the data to.
-	static void parse(protocol::uart::Packet& p, CompositeData& o);
+	static void parse(protocol::uart::PacketView& p, CompositeData& o);
+
+	/// \brief Parses a packet and updates two CompositeData objects. Each field
+	/// is decoded from the packet once.
+	///
+	/// \param[in] p The packet to parse.
+	/// \param[in/out] o1 The first CompositeData structure to write the data to.
+	/// \param[in/out] o2 The second CompositeData structure to write the data to.
+	static void parse(protocol::uart::PacketView& p, CompositeData& o1, CompositeData& o2);
+
+	/// \brief Parses a packet and updates multiple CompositeData objects. Each
+	/// field is decoded from the packet once.
+	///
+	/// \param[in] p The packet to parse.
+	/// \param[in] o Array of the CompositeData objects to update.
+	/// \param[in] count The number of objects in <c>o</c>.
+	static void parse(protocol::uart::PacketView& p, CompositeData* const* o, size_t count);
 
 	/// \brief Parses a packet and updates multiple CompositeData objects.
 	///
 	/// \param[in] p The packet to parse.
 	/// \param[in] o The collection of CompositeData objects to update.
-	static void parse(protocol::uart::Packet& p, std::vector<CompositeData*>& o);
+	static void parse(protocol::uart::PacketView& p, std::vector<CompositeData*>& o);
+
+	/// \brief Parses a packet without throwing an exception.
+	///
+	/// Binary packets that are too short for the fields they announce are
+	/// rejected before any data is written to the CompositeData structure.
+	///
+	/// \param[in] p The packet to parse.
+	/// \param[in/out] o The CompositeData structure to write the data to.
+	/// \return <c>true</c> if the packet was parsed; <c>false</c> if it is
+	///     too short or is not a supported asynchronous message.
+	static bool tryParse(protocol::uart::PacketView& p, CompositeData& o) VN_NOEXCEPT;
+
+	/// \brief Parses a packet and updates two CompositeData objects without
+	/// throwing an exception.
+	///
+	/// \param[in] p The packet to parse.
+	/// \param[in/out] o1 The first CompositeData structure to write the data to.
+	/// \param[in/out] o2 The second CompositeData structure to write the data to.
+	/// \return <c>true</c> if the packet was parsed; otherwise <c>false</c>.
+	static bool tryParse(protocol::uart::PacketView& p, CompositeData& o1, CompositeData& o2) VN_NOEXCEPT;
+
+	/// \brief Parses a packet and updates multiple CompositeData objects
+	/// without throwing an exception.
+	///
+	/// \param[in] p The packet to parse.
+	/// \param[in] o Array of the CompositeData objects to update.
+	/// \param[in] count The number of objects in <c>o</c>.
+	/// \return <c>true</c> if the packet was parsed; otherwise <c>false</c>.
+	static bool tryParse(protocol::uart::PacketView& p, CompositeData* const* o, size_t count) VN_NOEXCEPT;
 
 	/// \brief Resets the data contained in the CompositeData object.
 	void reset();
@@ -57,6 +102,11 @@ public:
 	/// \exception invalid_operation Thrown if there is no valid data.
 	math::AttitudeF anyAttitude();
 
+	/// \brief Gets <c>anyAttitude</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>anyAttitude</c> if it has valid data.
+	/// \return <c>true</c> if <c>anyAttitude</c> has valid data; otherwise <c>false</c>.
+	bool tryAnyAttitude(math::AttitudeF& value) VN_NOEXCEPT;
+
 	/// \brief Indicates if <c>yawPitchRoll</c> has valid data.
 	/// \return <c>true</c> if <c>yawPitchRoll</c> has valid data; otherwise <c>false</c>.
 	bool hasYawPitchRoll();
@@ -66,6 +116,11 @@ public:
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	math::vec3f yawPitchRoll();
 
+	/// \brief Gets <c>yawPitchRoll</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>yawPitchRoll</c> if it has valid data.
+	/// \return <c>true</c> if <c>yawPitchRoll</c> has valid data; otherwise <c>false</c>.
+	bool tryYawPitchRoll(math::vec3f& value) VN_NOEXCEPT;
+
 	/// \brief Indicates if <c>quaternion</c> has valid data.
 	/// \return <c>true</c> if <c>quaternion</c> has valid data; otherwise <c>false</c>.
 	bool hasQuaternion();
@@ -75,6 +130,11 @@ public:
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	math::vec4f quaternion();
 
+	/// \brief Gets <c>quaternion</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>quaternion</c> if it has valid data.
+	/// \return <c>true</c> if <c>quaternion</c> has valid data; otherwise <c>false</c>.
+	bool tryQuaternion(math::vec4f& value) VN_NOEXCEPT;
+
 	/// \brief Indicates if <c>directionCosineMatrix</c> has valid data.
 	/// \return <c>true</c> if <c>directionCosineMatrix</c> has valid data; otherwise <c>false</c>.
 	bool hasDirectionCosineMatrix();
@@ -84,6 +144,11 @@ public:
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	math::mat3f directionCosineMatrix();
 
+	/// \brief Gets <c>directionCosineMatrix</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>directionCosineMatrix</c> if it has valid data.
+	/// \return <c>true</c> if <c>directionCosineMatrix</c> has valid data; otherwise <c>false</c>.
+	bool tryDirectionCosineMatrix(math::mat3f& value) VN_NOEXCEPT;
+
 	/// \brief Indicates if <c>anyMagnetic</c> has valid data.
 	/// \return <c>true</c> if <c>anyMagnetic</c> has valid data; otherwise <c>false</c>.
 	bool hasAnyMagnetic();
@@ -97,6 +162,11 @@ public:
 	/// \exception invalid_operation Thrown if there is no valid data.
 	math::vec3f anyMagnetic();
 
+	/// \brief Gets <c>anyMagnetic</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>anyMagnetic</c> if it has valid data.
+	/// \return <c>true</c> if <c>anyMagnetic</c> has valid data; otherwise <c>false</c>.
+	bool tryAnyMagnetic(math::vec3f& value) VN_NOEXCEPT;
+
 	/// \brief Indicates if <c>magnetic</c> has valid data.
 	/// \return <c>true</c> if <c>magnetic</c> has valid data; otherwise <c>false</c>.
 	bool hasMagnetic();
@@ -106,6 +176,11 @@ public:
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	math::vec3f magnetic();
 
+	/// \brief Gets <c>magnetic</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>magnetic</c> if it has valid data.
+	/// \return <c>true</c> if <c>magnetic</c> has valid data; otherwise <c>false</c>.
+	bool tryMagnetic(math::vec3f& value) VN_NOEXCEPT;
+
 	/// \brief Indicates if <c>magneticUncompensated</c> has valid data.
 	/// \return <c>true</c> if <c>magneticUncompensated</c> has valid data; otherwise <c>false</c>.
 	bool hasMagneticUncompensated();
@@ -115,6 +190,11 @@ public:
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	math::vec3f magneticUncompensated();
 
+	/// \brief Gets <c>magneticUncompensated</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>magneticUncompensated</c> if it has valid data.
+	/// \return <c>true</c> if <c>magneticUncompensated</c> has valid data; otherwise <c>false</c>.
+	bool tryMagneticUncompensated(math::vec3f& value) VN_NOEXCEPT;
+
 	/// \brief Indicates if <c>magneticNed</c> has valid data.
 	/// \return <c>true</c> if <c>magneticNed</c> has valid data; otherwise <c>false</c>.
 	bool hasMagneticNed();
@@ -124,6 +204,11 @@ public:
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	math::vec3f magneticNed();
 
+	/// \brief Gets <c>magneticNed</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>magneticNed</c> if it has valid data.
+	/// \return <c>true</c> if <c>magneticNed</c> has valid data; otherwise <c>false</c>.
+	bool tryMagneticNed(math::vec3f& value) VN_NOEXCEPT;
+
 	/// \brief Indicates if <c>magneticEcef</c> has valid data.
 	/// \return <c>true</c> if <c>magneticEcef</c> has valid data; otherwise <c>false</c>.
 	bool hasMagneticEcef();
@@ -133,6 +218,11 @@ public:
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	math::vec3f magneticEcef();
 
+	/// \brief Gets <c>magneticEcef</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>magneticEcef</c> if it has valid data.
+	/// \return <c>true</c> if <c>magneticEcef</c> has valid data; otherwise <c>false</c>.
+	bool tryMagneticEcef(math::vec3f& value) VN_NOEXCEPT;
+
 
 	/// \brief Indicates if <c>anyAcceleration</c> has valid data.
 	/// \return <c>true</c> if <c>anyAcceleration</c> has valid data; otherwise <c>false</c>.
@@ -145,6 +235,11 @@ public:
 	/// \exception invalid_operation Thrown if there is no valid data.
 	math::vec3f anyAcceleration();
 
+	/// \brief Gets <c>anyAcceleration</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>anyAcceleration</c> if it has valid data.
+	/// \return <c>true</c> if <c>anyAcceleration</c> has valid data; otherwise <c>false</c>.
+	bool tryAnyAcceleration(math::vec3f& value) VN_NOEXCEPT;
+
 	/// \brief Indicates if <c>acceleration</c> has valid data.
 	/// \return <c>true</c> if <c>acceleration</c> has valid data; otherwise <c>false</c>.
 	bool hasAcceleration();
@@ -154,6 +249,11 @@ public:
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	math::vec3f acceleration();
 
+	/// \brief Gets <c>acceleration</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>acceleration</c> if it has valid data.
+	/// \return <c>true</c> if <c>acceleration</c> has valid data; otherwise <c>false</c>.
+	bool tryAcceleration(math::vec3f& value) VN_NOEXCEPT;
+
 	/// \brief Indicates if <c>accelerationLinearBody</c> has valid data.
 	/// \return <c>true</c> if <c>accelerationLinearBody</c> has valid data; otherwise <c>false</c>.
 	bool hasAccelerationLinearBody();
@@ -162,6 +262,11 @@ public:
 	/// \return The acceleration linear body data.
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	math::vec3f accelerationLinearBody();
+
+	/// \brief Gets <c>accelerationLinearBody</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>accelerationLinearBody</c> if it has valid data.
+	/// \return <c>true</c> if <c>accelerationLinearBody</c> has valid data; otherwise <c>false</c>.
+	bool tryAccelerationLinearBody(math::vec3f& value) VN_NOEXCEPT;
 	
 	/// \brief Indicates if <c>accelerationUncompensated</c> has valid data.
 	/// \return <c>true</c> if <c>accelerationUncompensated</c> has valid data; otherwise <c>false</c>.
@@ -172,6 +277,11 @@ public:
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	math::vec3f accelerationUncompensated();
 
+	/// \brief Gets <c>accelerationUncompensated</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>accelerationUncompensated</c> if it has valid data.
+	/// \return <c>true</c> if <c>accelerationUncompensated</c> has valid data; otherwise <c>false</c>.
+	bool tryAccelerationUncompensated(math::vec3f& value) VN_NOEXCEPT;
+
 	/// \brief Indicates if <c>accelerationLinearNed</c> has valid data.
 	/// \return <c>true</c> if <c>accelerationLinearNed</c> has valid data; otherwise <c>false</c>.
 	bool hasAccelerationLinearNed();
@@ -181,6 +291,11 @@ public:
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	math::vec3f accelerationLinearNed();
 
+	/// \brief Gets <c>accelerationLinearNed</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>accelerationLinearNed</c> if it has valid data.
+	/// \return <c>true</c> if <c>accelerationLinearNed</c> has valid data; otherwise <c>false</c>.
+	bool tryAccelerationLinearNed(math::vec3f& value) VN_NOEXCEPT;
+
 	/// \brief Indicates if <c>accelerationLinearEcef</c> has valid data.
 	/// \return <c>true</c> if <c>accelerationLinearEcef</c> has valid data; otherwise <c>false</c>.
 	bool hasAccelerationLinearEcef();
@@ -190,6 +305,11 @@ public:
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	math::vec3f accelerationLinearEcef();
 
+	/// \brief Gets <c>accelerationLinearEcef</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>accelerationLinearEcef</c> if it has valid data.
+	/// \return <c>true</c> if <c>accelerationLinearEcef</c> has valid data; otherwise <c>false</c>.
+	bool tryAccelerationLinearEcef(math::vec3f& value) VN_NOEXCEPT;
+
 	/// \brief Indicates if <c>accelerationNed</c> has valid data.
 	/// \return <c>true</c> if <c>accelerationNed</c> has valid data; otherwise <c>false</c>.
 	bool hasAccelerationNed();
@@ -199,6 +319,11 @@ public:
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	math::vec3f accelerationNed();
 
+	/// \brief Gets <c>accelerationNed</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>accelerationNed</c> if it has valid data.
+	/// \return <c>true</c> if <c>accelerationNed</c> has valid data; otherwise <c>false</c>.
+	bool tryAccelerationNed(math::vec3f& value) VN_NOEXCEPT;
+
 	/// \brief Indicates if <c>accelerationEcef</c> has valid data.
 	/// \return <c>true</c> if <c>accelerationEcef</c> has valid data; otherwise <c>false</c>.
 	bool hasAccelerationEcef();
@@ -208,6 +333,11 @@ public:
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	math::vec3f accelerationEcef();
 
+	/// \brief Gets <c>accelerationEcef</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>accelerationEcef</c> if it has valid data.
+	/// \return <c>true</c> if <c>accelerationEcef</c> has valid data; otherwise <c>false</c>.
+	bool tryAccelerationEcef(math::vec3f& value) VN_NOEXCEPT;
+
 
 	/// \brief Indicates if <c>anyAngularRate</c> has valid data.
 	/// \return <c>true</c> if <c>anyAngularRate</c> has valid data; otherwise <c>false</c>.
@@ -220,6 +350,11 @@ public:
 	/// \exception invalid_operation Thrown if there is no valid data.
 	math::vec3f anyAngularRate();
 
+	/// \brief Gets <c>anyAngularRate</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>anyAngularRate</c> if it has valid data.
+	/// \return <c>true</c> if <c>anyAngularRate</c> has valid data; otherwise <c>false</c>.
+	bool tryAnyAngularRate(math::vec3f& value) VN_NOEXCEPT;
+
 	/// \brief Indicates if <c>angularRate</c> has valid data.
 	/// \return <c>true</c> if <c>angularRate</c> has valid data; otherwise <c>false</c>.
 	bool hasAngularRate();
@@ -229,6 +364,11 @@ public:
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	math::vec3f angularRate();
 
+	/// \brief Gets <c>angularRate</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>angularRate</c> if it has valid data.
+	/// \return <c>true</c> if <c>angularRate</c> has valid data; otherwise <c>false</c>.
+	bool tryAngularRate(math::vec3f& value) VN_NOEXCEPT;
+
 	/// \brief Indicates if <c>angularRateUncompensated</c> has valid data.
 	/// \return <c>true</c> if <c>angularRateUncompensated</c> has valid data; otherwise <c>false</c>.
 	bool hasAngularRateUncompensated();
@@ -238,6 +378,11 @@ public:
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	math::vec3f angularRateUncompensated();
 
+	/// \brief Gets <c>angularRateUncompensated</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>angularRateUncompensated</c> if it has valid data.
+	/// \return <c>true</c> if <c>angularRateUncompensated</c> has valid data; otherwise <c>false</c>.
+	bool tryAngularRateUncompensated(math::vec3f& value) VN_NOEXCEPT;
+
 
 	/// \brief Indicates if <c>anyTemperature</c> has valid data.
 	/// \return <c>true</c> if <c>anyTemperature</c> has valid data; otherwise <c>false</c>.
@@ -250,6 +395,11 @@ public:
 	/// \exception invalid_operation Thrown if there is no valid data.
 	float anyTemperature();
 
+	/// \brief Gets <c>anyTemperature</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>anyTemperature</c> if it has valid data.
+	/// \return <c>true</c> if <c>anyTemperature</c> has valid data; otherwise <c>false</c>.
+	bool tryAnyTemperature(float& value) VN_NOEXCEPT;
+
 	/// \brief Indicates if <c>temperature</c> has valid data.
 	/// \return <c>true</c> if <c>temperature</c> has valid data; otherwise <c>false</c>.
 	bool hasTemperature();
@@ -259,6 +409,11 @@ public:
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	float temperature();
 
+	/// \brief Gets <c>temperature</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>temperature</c> if it has valid data.
+	/// \return <c>true</c> if <c>temperature</c> has valid data; otherwise <c>false</c>.
+	bool tryTemperature(float& value) VN_NOEXCEPT;
+
 
 	/// \brief Indicates if <c>anyPressure</c> has valid data.
 	/// \return <c>true</c> if <c>anyPressure</c> has valid data; otherwise <c>false</c>.
@@ -271,6 +426,11 @@ public:
 	/// \exception invalid_operation Thrown if there is no valid data.
 	float anyPressure();
 
+	/// \brief Gets <c>anyPressure</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>anyPressure</c> if it has valid data.
+	/// \return <c>true</c> if <c>anyPressure</c> has valid data; otherwise <c>false</c>.
+	bool tryAnyPressure(float& value) VN_NOEXCEPT;
+
 	/// \brief Indicates if <c>pressure</c> has valid data.
 	/// \return <c>true</c> if <c>pressure</c> has valid data; otherwise <c>false</c>.
 	bool hasPressure();
@@ -280,6 +440,11 @@ public:
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	float pressure();
 
+	/// \brief Gets <c>pressure</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>pressure</c> if it has valid data.
+	/// \return <c>true</c> if <c>pressure</c> has valid data; otherwise <c>false</c>.
+	bool tryPressure(float& value) VN_NOEXCEPT;
+
 	/// \brief Indicates if <c>anyPosition</c> has valid data.
 	/// \return <c>true</c> if <c>anyPosition</c> has valid data; otherwise <c>false</c>.
 	bool hasAnyPosition();
@@ -291,6 +456,11 @@ public:
 	/// \exception invalid_operation Thrown if there is no valid data.
 	math::PositionD anyPosition();
 
+	/// \brief Gets <c>anyPosition</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>anyPosition</c> if it has valid data.
+	/// \return <c>true</c> if <c>anyPosition</c> has valid data; otherwise <c>false</c>.
+	bool tryAnyPosition(math::PositionD& value) VN_NOEXCEPT;
+
   /// \brief Indicates if <c>positionGpsLla</c> has valid data.
   /// \return <c>true</c> if <c>positionGpsLla</c> has valid data; otherwise <c>false</c>.
   bool hasPositionGpsLla();
@@ -304,11 +474,21 @@ public:
   /// \exception invalid_operation Thrown if there is not any valid data.
   math::vec3d positionGpsLla();
 
+  /// \brief Gets <c>positionGpsLla</c> without throwing an exception.
+  /// \param[out] value Set to the value of <c>positionGpsLla</c> if it has valid data.
+  /// \return <c>true</c> if <c>positionGpsLla</c> has valid data; otherwise <c>false</c>.
+  bool tryPositionGpsLla(math::vec3d& value) VN_NOEXCEPT;
+
   /// \brief Position GPS2 LLA data.
   /// \return The Position GPS2 LLA data.
   /// \exception invalid_operation Thrown if there is not any valid data.
   math::vec3d positionGps2Lla();
 
+  /// \brief Gets <c>positionGps2Lla</c> without throwing an exception.
+  /// \param[out] value Set to the value of <c>positionGps2Lla</c> if it has valid data.
+  /// \return <c>true</c> if <c>positionGps2Lla</c> has valid data; otherwise <c>false</c>.
+  bool tryPositionGps2Lla(math::vec3d& value) VN_NOEXCEPT;
+
   /// \brief Indicates if <c>positionGpsEcef</c> has valid data.
   /// \return <c>true</c> if <c>positionGpsEcef</c> has valid data; otherwise <c>false</c>.
   bool hasPositionGpsEcef();
@@ -322,11 +502,21 @@ public:
   /// \exception invalid_operation Thrown if there is not any valid data.
   math::vec3d positionGpsEcef();
 
+  /// \brief Gets <c>positionGpsEcef</c> without throwing an exception.
+  /// \param[out] value Set to the value of <c>positionGpsEcef</c> if it has valid data.
+  /// \return <c>true</c> if <c>positionGpsEcef</c> has valid data; otherwise <c>false</c>.
+  bool tryPositionGpsEcef(math::vec3d& value) VN_NOEXCEPT;
+
   /// \brief Position GPS2 ECEF data.
   /// \return The Position GPS2 ECEF data.
   /// \exception invalid_operation Thrown if there is not any valid data.
   math::vec3d positionGps2Ecef();
 
+  /// \brief Gets <c>positionGps2Ecef</c> without throwing an exception.
+  /// \param[out] value Set to the value of <c>positionGps2Ecef</c> if it has valid data.
+  /// \return <c>true</c> if <c>positionGps2Ecef</c> has valid data; otherwise <c>false</c>.
+  bool tryPositionGps2Ecef(math::vec3d& value) VN_NOEXCEPT;
+
   /// \brief Indicates if <c>positionEstimatedLla</c> has valid data.
 	/// \return <c>true</c> if <c>positionEstimatedLla</c> has valid data; otherwise <c>false</c>.
 	bool hasPositionEstimatedLla();
@@ -336,6 +526,11 @@ public:
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	math::vec3d positionEstimatedLla();
 
+	/// \brief Gets <c>positionEstimatedLla</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>positionEstimatedLla</c> if it has valid data.
+	/// \return <c>true</c> if <c>positionEstimatedLla</c> has valid data; otherwise <c>false</c>.
+	bool tryPositionEstimatedLla(math::vec3d& value) VN_NOEXCEPT;
+
 	/// \brief Indicates if <c>positionEstimatedEcef</c> has valid data.
 	/// \return <c>true</c> if <c>positionEstimatedEcef</c> has valid data; otherwise <c>false</c>.
 	bool hasPositionEstimatedEcef();
@@ -345,6 +540,11 @@ public:
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	math::vec3d positionEstimatedEcef();
 
+	/// \brief Gets <c>positionEstimatedEcef</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>positionEstimatedEcef</c> if it has valid data.
+	/// \return <c>true</c> if <c>positionEstimatedEcef</c> has valid data; otherwise <c>false</c>.
+	bool tryPositionEstimatedEcef(math::vec3d& value) VN_NOEXCEPT;
+
 	/// \brief Indicates if <c>anyVelocity</c> has valid data.
 	/// \return <c>true</c> if <c>anyVelocity</c> has valid data; otherwise <c>false</c>.
 	bool hasAnyVelocity();
@@ -356,6 +556,11 @@ public:
 	/// \exception invalid_operation Thrown if there is no valid data.
 	math::vec3f anyVelocity();
 
+	/// \brief Gets <c>anyVelocity</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>anyVelocity</c> if it has valid data.
+	/// \return <c>true</c> if <c>anyVelocity</c> has valid data; otherwise <c>false</c>.
+	bool tryAnyVelocity(math::vec3f& value) VN_NOEXCEPT;
+
   /// \brief Indicates if <c>velocityGpsNed</c> has valid data.
   /// \return <c>true</c> if <c>velocityGpsNed</c> has valid data; otherwise <c>false</c>.
   bool hasVelocityGpsNed();
@@ -369,11 +574,21 @@ public:
   /// \exception invalid_operation Thrown if there is not any valid data.
   math::vec3f velocityGpsNed();
 
+  /// \brief Gets <c>velocityGpsNed</c> without throwing an exception.
+  /// \param[out] value Set to the value of <c>velocityGpsNed</c> if it has valid data.
+  /// \return <c>true</c> if <c>velocityGpsNed</c> has valid data; otherwise <c>false</c>.
+  bool tryVelocityGpsNed(math::vec3f& value) VN_NOEXCEPT;
+
   /// \brief Velocity GPS2 NED data.
   /// \return The velocity GPS2 NED data.
   /// \exception invalid_operation Thrown if there is not any valid data.
   math::vec3f velocityGps2Ned();
 
+  /// \brief Gets <c>velocityGps2Ned</c> without throwing an exception.
+  /// \param[out] value Set to the value of <c>velocityGps2Ned</c> if it has valid data.
+  /// \return <c>true</c> if <c>velocityGps2Ned</c> has valid data; otherwise <c>false</c>.
+  bool tryVelocityGps2Ned(math::vec3f& value) VN_NOEXCEPT;
+
   /// \brief Indicates if <c>velocityGpsEcef</c> has valid data.
   /// \return <c>true</c> if <c>velocityGpsEcef</c> has valid data; otherwise <c>false</c>.
   bool hasVelocityGpsEcef();
@@ -387,11 +602,21 @@ public:
   /// \exception invalid_operation Thrown if there is not any valid data.
   math::vec3f velocityGpsEcef();
 
+  /// \brief Gets <c>velocityGpsEcef</c> without throwing an exception.
+  /// \param[out] value Set to the value of <c>velocityGpsEcef</c> if it has valid data.
+  /// \return <c>true</c> if <c>velocityGpsEcef</c> has valid data; otherwise <c>false</c>.
+  bool tryVelocityGpsEcef(math::vec3f& value) VN_NOEXCEPT;
+
   /// \brief Velocity GPS2 ECEF data.
   /// \return The velocity GPS2 ECEF data.
   /// \exception invalid_operation Thrown if there is not any valid data.
   math::vec3f velocityGps2Ecef();
 
+  /// \brief Gets <c>velocityGps2Ecef</c> without throwing an exception.
+  /// \param[out] value Set to the value of <c>velocityGps2Ecef</c> if it has valid data.
+  /// \return <c>true</c> if <c>velocityGps2Ecef</c> has valid data; otherwise <c>false</c>.
+  bool tryVelocityGps2Ecef(math::vec3f& value) VN_NOEXCEPT;
+
   /// \brief Indicates if <c>velocityEstimatedNed</c> has valid data.
 	/// \return <c>true</c> if <c>velocityEstimatedNed</c> has valid data; otherwise <c>false</c>.
 	bool hasVelocityEstimatedNed();
@@ -401,6 +626,11 @@ public:
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	math::vec3f velocityEstimatedNed();
 
+	/// \brief Gets <c>velocityEstimatedNed</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>velocityEstimatedNed</c> if it has valid data.
+	/// \return <c>true</c> if <c>velocityEstimatedNed</c> has valid data; otherwise <c>false</c>.
+	bool tryVelocityEstimatedNed(math::vec3f& value) VN_NOEXCEPT;
+
 	/// \brief Indicates if <c>velocityEstimatedEcef</c> has valid data.
 	/// \return <c>true</c> if <c>velocityEstimatedEcef</c> has valid data; otherwise <c>false</c>.
 	bool hasVelocityEstimatedEcef();
@@ -409,6 +639,11 @@ public:
 	/// \return The velocity estimated ECEF data.
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	math::vec3f velocityEstimatedEcef();
+
+	/// \brief Gets <c>velocityEstimatedEcef</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>velocityEstimatedEcef</c> if it has valid data.
+	/// \return <c>true</c> if <c>velocityEstimatedEcef</c> has valid data; otherwise <c>false</c>.
+	bool tryVelocityEstimatedEcef(math::vec3f& value) VN_NOEXCEPT;
 	
 	/// \brief Indicates if <c>velocityEstimatedBody</c> has valid data.
 	/// \return <c>true</c> if <c>velocityEstimatedBody</c> has valid data; otherwise <c>false</c>.
@@ -419,6 +654,11 @@ public:
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	math::vec3f velocityEstimatedBody();
 
+	/// \brief Gets <c>velocityEstimatedBody</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>velocityEstimatedBody</c> if it has valid data.
+	/// \return <c>true</c> if <c>velocityEstimatedBody</c> has valid data; otherwise <c>false</c>.
+	bool tryVelocityEstimatedBody(math::vec3f& value) VN_NOEXCEPT;
+
 	/// \brief Indicates if <c>deltaTime</c> has valid data.
 	/// \return <c>true</c> if <c>deltaTime</c> has valid data; otherwise <c>false</c>.
 	bool hasDeltaTime();
@@ -428,6 +668,11 @@ public:
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	float deltaTime();
 
+	/// \brief Gets <c>deltaTime</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>deltaTime</c> if it has valid data.
+	/// \return <c>true</c> if <c>deltaTime</c> has valid data; otherwise <c>false</c>.
+	bool tryDeltaTime(float& value) VN_NOEXCEPT;
+
 	/// \brief Indicates if <c>deltaTheta</c> has valid data.
 	/// \return <c>true</c> if <c>deltaTheta</c> has valid data; otherwise <c>false</c>.
 	bool hasDeltaTheta();
@@ -437,6 +682,11 @@ public:
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	math::vec3f deltaTheta();
 
+	/// \brief Gets <c>deltaTheta</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>deltaTheta</c> if it has valid data.
+	/// \return <c>true</c> if <c>deltaTheta</c> has valid data; otherwise <c>false</c>.
+	bool tryDeltaTheta(math::vec3f& value) VN_NOEXCEPT;
+
 	/// \brief Indicates if <c>deltaVelocity</c> has valid data.
 	/// \return <c>true</c> if <c>deltaVelocity</c> has valid data; otherwise <c>false</c>.
 	bool hasDeltaVelocity();
@@ -446,6 +696,11 @@ public:
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	math::vec3f deltaVelocity();
 
+	/// \brief Gets <c>deltaVelocity</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>deltaVelocity</c> if it has valid data.
+	/// \return <c>true</c> if <c>deltaVelocity</c> has valid data; otherwise <c>false</c>.
+	bool tryDeltaVelocity(math::vec3f& value) VN_NOEXCEPT;
+
 	/// \brief Indicates if <c>timeStartup</c> has valid data.
 	/// \return <c>true</c> if <c>timeStartup</c> has valid data; otherwise <c>false</c>.
 	bool hasTimeStartup();
@@ -455,6 +710,11 @@ public:
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	uint64_t timeStartup();
 
+	/// \brief Gets <c>timeStartup</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>timeStartup</c> if it has valid data.
+	/// \return <c>true</c> if <c>timeStartup</c> has valid data; otherwise <c>false</c>.
+	bool tryTimeStartup(uint64_t& value) VN_NOEXCEPT;
+
   /// \brief Indicates if <c>timeGps</c> has valid data.
   /// \return <c>true</c> if <c>timeGps</c> has valid data; otherwise <c>false</c>.
   bool hasTimeGps();
@@ -468,11 +728,21 @@ public:
   /// \exception invalid_operation Thrown if there is not any valid data.
   uint64_t timeGps();
 
+  /// \brief Gets <c>timeGps</c> without throwing an exception.
+  /// \param[out] value Set to the value of <c>timeGps</c> if it has valid data.
+  /// \return <c>true</c> if <c>timeGps</c> has valid data; otherwise <c>false</c>.
+  bool tryTimeGps(uint64_t& value) VN_NOEXCEPT;
+
   /// \brief Time GPS2 data.
   /// \return The time GPS2 data.
   /// \exception invalid_operation Thrown if there is not any valid data.
   uint64_t timeGps2();
 
+  /// \brief Gets <c>timeGps2</c> without throwing an exception.
+  /// \param[out] value Set to the value of <c>timeGps2</c> if it has valid data.
+  /// \return <c>true</c> if <c>timeGps2</c> has valid data; otherwise <c>false</c>.
+  bool tryTimeGps2(uint64_t& value) VN_NOEXCEPT;
+
   /// \brief Indicates if <c>tow</c> has valid data.
   /// \return <c>true</c> if <c>tow</c> has valid data; otherwise <c>false</c>.
   bool hasTow();
@@ -482,6 +752,11 @@ public:
   /// \exception invalid_operation Thrown if there is not any valid data.
   double tow();
 
+  /// \brief Gets <c>tow</c> without throwing an exception.
+  /// \param[out] value Set to the value of <c>tow</c> if it has valid data.
+  /// \return <c>true</c> if <c>tow</c> has valid data; otherwise <c>false</c>.
+  bool tryTow(double& value) VN_NOEXCEPT;
+
   /// \brief Indicates if <c>week</c> has valid data.
 	/// \return <c>true</c> if <c>week</c> has valid data; otherwise <c>false</c>.
 	bool hasWeek();
@@ -491,6 +766,11 @@ public:
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	uint16_t week();
 
+	/// \brief Gets <c>week</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>week</c> if it has valid data.
+	/// \return <c>true</c> if <c>week</c> has valid data; otherwise <c>false</c>.
+	bool tryWeek(uint16_t& value) VN_NOEXCEPT;
+
 	/// \brief Indicates if <c>numSats</c> has valid data.
 	/// \return <c>true</c> if <c>numSats</c> has valid data; otherwise <c>false</c>.
 	bool hasNumSats();
@@ -500,6 +780,11 @@ public:
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	uint8_t numSats();
 
+	/// \brief Gets <c>numSats</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>numSats</c> if it has valid data.
+	/// \return <c>true</c> if <c>numSats</c> has valid data; otherwise <c>false</c>.
+	bool tryNumSats(uint8_t& value) VN_NOEXCEPT;
+
 	/// \brief Indicates if <c>timeSyncIn</c> has valid data.
 	/// \return <c>true</c> if <c>timeSyncIn</c> has valid data; otherwise <c>false</c>.
 	bool hasTimeSyncIn();
@@ -509,6 +794,11 @@ public:
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	uint64_t timeSyncIn();
 
+	/// \brief Gets <c>timeSyncIn</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>timeSyncIn</c> if it has valid data.
+	/// \return <c>true</c> if <c>timeSyncIn</c> has valid data; otherwise <c>false</c>.
+	bool tryTimeSyncIn(uint64_t& value) VN_NOEXCEPT;
+
 	/// \brief Indicates if <c>vpeStatus</c> has valid data.
 	/// \return <c>true</c> if <c>vpeStatus</c> has valid data; otherwise <c>false</c>.
 	bool hasVpeStatus();
@@ -518,6 +808,11 @@ public:
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	protocol::uart::VpeStatus vpeStatus();
 
+	/// \brief Gets <c>vpeStatus</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>vpeStatus</c> if it has valid data.
+	/// \return <c>true</c> if <c>vpeStatus</c> has valid data; otherwise <c>false</c>.
+	bool tryVpeStatus(protocol::uart::VpeStatus& value) VN_NOEXCEPT;
+
 	/// \brief Indicates if <c>insStatus</c> has valid data.
 	/// \return <c>true</c> if <c>insStatus</c> has valid data; otherwise <c>false</c>.
 	bool hasInsStatus();
@@ -527,6 +822,11 @@ public:
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	protocol::uart::InsStatus insStatus();
 
+	/// \brief Gets <c>insStatus</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>insStatus</c> if it has valid data.
+	/// \return <c>true</c> if <c>insStatus</c> has valid data; otherwise <c>false</c>.
+	bool tryInsStatus(protocol::uart::InsStatus& value) VN_NOEXCEPT;
+
 	/// \brief Indicates if <c>syncInCnt</c> has valid data.
 	/// \return <c>true</c> if <c>syncInCnt</c> has valid data; otherwise <c>false</c>.
 	bool hasSyncInCnt();
@@ -536,6 +836,11 @@ public:
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	uint32_t syncInCnt();
 
+	/// \brief Gets <c>syncInCnt</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>syncInCnt</c> if it has valid data.
+	/// \return <c>true</c> if <c>syncInCnt</c> has valid data; otherwise <c>false</c>.
+	bool trySyncInCnt(uint32_t& value) VN_NOEXCEPT;
+
   /// \brief Indicates if <c>syncOutCnt</c> has valid data.
   /// \return <c>true</c> if <c>syncOutCnt</c> has valid data; otherwise <c>false</c>.
   bool hasSyncOutCnt();
@@ -545,6 +850,11 @@ public:
   /// \exception invalid_operation Thrown if there is not any valid data.
   uint32_t syncOutCnt();
 
+  /// \brief Gets <c>syncOutCnt</c> without throwing an exception.
+  /// \param[out] value Set to the value of <c>syncOutCnt</c> if it has valid data.
+  /// \return <c>true</c> if <c>syncOutCnt</c> has valid data; otherwise <c>false</c>.
+  bool trySyncOutCnt(uint32_t& value) VN_NOEXCEPT;
+
   /// \brief Indicates if <c>timeStatus</c> has valid data.
   /// \return <c>true</c> if <c>timeStatus</c> has valid data; otherwise <c>false</c>.
   bool hasTimeStatus();
@@ -554,6 +864,11 @@ public:
   /// \exception invalid_operation Thrown if there is not any valid data.
   uint8_t timeStatus();
 
+  /// \brief Gets <c>timeStatus</c> without throwing an exception.
+  /// \param[out] value Set to the value of <c>timeStatus</c> if it has valid data.
+  /// \return <c>true</c> if <c>timeStatus</c> has valid data; otherwise <c>false</c>.
+  bool tryTimeStatus(uint8_t& value) VN_NOEXCEPT;
+
   /// \brief Indicates if <c>timeGpsPps</c> has valid data.
   /// \return <c>true</c> if <c>timeGpsPps</c> has valid data; otherwise <c>false</c>.
   bool hasTimeGpsPps();
@@ -567,11 +882,21 @@ public:
   /// \exception invalid_operation Thrown if there is not any valid data.
   uint64_t timeGpsPps();
 
+  /// \brief Gets <c>timeGpsPps</c> without throwing an exception.
+  /// \param[out] value Set to the value of <c>timeGpsPps</c> if it has valid data.
+  /// \return <c>true</c> if <c>timeGpsPps</c> has valid data; otherwise <c>false</c>.
+  bool tryTimeGpsPps(uint64_t& value) VN_NOEXCEPT;
+
   /// \brief TimeGps2Pps data.
   /// \return The TimeGps2Pps data.
   /// \exception invalid_operation Thrown if there is not any valid data.
   uint64_t timeGps2Pps();
 
+  /// \brief Gets <c>timeGps2Pps</c> without throwing an exception.
+  /// \param[out] value Set to the value of <c>timeGps2Pps</c> if it has valid data.
+  /// \return <c>true</c> if <c>timeGps2Pps</c> has valid data; otherwise <c>false</c>.
+  bool tryTimeGps2Pps(uint64_t& value) VN_NOEXCEPT;
+
   /// \brief Indicates if <c>gpsTow</c> has valid data.
   /// \return <c>true</c> if <c>gpsTow</c> has valid data; otherwise <c>false</c>.
   bool hasGpsTow();
@@ -585,11 +910,21 @@ public:
   /// \exception invalid_operation Thrown if there is not any valid data.
   uint64_t gpsTow();
 
+  /// \brief Gets <c>gpsTow</c> without throwing an exception.
+  /// \param[out] value Set to the value of <c>gpsTow</c> if it has valid data.
+  /// \return <c>true</c> if <c>gpsTow</c> has valid data; otherwise <c>false</c>.
+  bool tryGpsTow(uint64_t& value) VN_NOEXCEPT;
+
   /// \brief Gps2Tow data.
   /// \return The Gps2Tow data.
   /// \exception invalid_operation Thrown if there is not any valid data.
   uint64_t gps2Tow();
 
+  /// \brief Gets <c>gps2Tow</c> without throwing an exception.
+  /// \param[out] value Set to the value of <c>gps2Tow</c> if it has valid data.
+  /// \return <c>true</c> if <c>gps2Tow</c> has valid data; otherwise <c>false</c>.
+  bool tryGps2Tow(uint64_t& value) VN_NOEXCEPT;
+
   /// \brief Indicates if <c>timeUtc</c> has valid data.
 	/// \return <c>true</c> if <c>timeUtc</c> has valid data; otherwise <c>false</c>.
 	bool hasTimeUtc();
@@ -599,6 +934,11 @@ public:
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	protocol::uart::TimeUtc timeUtc();
 
+	/// \brief Gets <c>timeUtc</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>timeUtc</c> if it has valid data.
+	/// \return <c>true</c> if <c>timeUtc</c> has valid data; otherwise <c>false</c>.
+	bool tryTimeUtc(protocol::uart::TimeUtc& value) VN_NOEXCEPT;
+
 	/// \brief Indicates if <c>sensSat</c> has valid data.
 	/// \return <c>true</c> if <c>sensSat</c> has valid data; otherwise <c>false</c>.
 	bool hasSensSat();
@@ -608,6 +948,11 @@ public:
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	protocol::uart::SensSat sensSat();
 
+	/// \brief Gets <c>sensSat</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>sensSat</c> if it has valid data.
+	/// \return <c>true</c> if <c>sensSat</c> has valid data; otherwise <c>false</c>.
+	bool trySensSat(protocol::uart::SensSat& value) VN_NOEXCEPT;
+
   /// \brief Indicates if <c>fix</c> has valid data.
   /// \return <c>true</c> if <c>fix</c> has valid data; otherwise <c>false</c>.
   bool hasFix();
@@ -621,11 +966,21 @@ public:
   /// \exception invalid_operation Thrown if there is not any valid data.
   protocol::uart::GpsFix fix();
 
+  /// \brief Gets <c>fix</c> without throwing an exception.
+  /// \param[out] value Set to the value of <c>fix</c> if it has valid data.
+  /// \return <c>true</c> if <c>fix</c> has valid data; otherwise <c>false</c>.
+  bool tryFix(protocol::uart::GpsFix& value) VN_NOEXCEPT;
+
   /// \brief GPS2 fix data.
   /// \return The GPS2 fix data.
   /// \exception invalid_operation Thrown if there is not any valid data.
   protocol::uart::GpsFix fix2();
 
+  /// \brief Gets <c>fix2</c> without throwing an exception.
+  /// \param[out] value Set to the value of <c>fix2</c> if it has valid data.
+  /// \return <c>true</c> if <c>fix2</c> has valid data; otherwise <c>false</c>.
+  bool tryFix2(protocol::uart::GpsFix& value) VN_NOEXCEPT;
+
   /// \brief Indicates if <c>anyPositionUncertainty</c> has valid data.
 	/// \return <c>true</c> if <c>anyPositionUncertainty</c> has valid data; otherwise <c>false</c>.
 	bool hasAnyPositionUncertainty();
@@ -637,6 +992,11 @@ public:
 	/// \exception invalid_operation Thrown if there is no valid data.
 	math::vec3f anyPositionUncertainty();
 
+	/// \brief Gets <c>anyPositionUncertainty</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>anyPositionUncertainty</c> if it has valid data.
+	/// \return <c>true</c> if <c>anyPositionUncertainty</c> has valid data; otherwise <c>false</c>.
+	bool tryAnyPositionUncertainty(math::vec3f& value) VN_NOEXCEPT;
+
   /// \brief Indicates if <c>positionUncertaintyGpsNed</c> has valid data.
   /// \return <c>true</c> if <c>positionUncertaintyGpsNed</c> has valid data; otherwise <c>false</c>.
   bool hasPositionUncertaintyGpsNed();
@@ -650,11 +1010,21 @@ public:
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	math::vec3f positionUncertaintyGpsNed();
 
+	/// \brief Gets <c>positionUncertaintyGpsNed</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>positionUncertaintyGpsNed</c> if it has valid data.
+	/// \return <c>true</c> if <c>positionUncertaintyGpsNed</c> has valid data; otherwise <c>false</c>.
+	bool tryPositionUncertaintyGpsNed(math::vec3f& value) VN_NOEXCEPT;
+
   /// \brief GPS2 position uncertainty NED data.
   /// \return The GPS2 position uncertainty NED data.
   /// \exception invalid_operation Thrown if there is not any valid data.
   math::vec3f positionUncertaintyGps2Ned();
 
+  /// \brief Gets <c>positionUncertaintyGps2Ned</c> without throwing an exception.
+  /// \param[out] value Set to the value of <c>positionUncertaintyGps2Ned</c> if it has valid data.
+  /// \return <c>true</c> if <c>positionUncertaintyGps2Ned</c> has valid data; otherwise <c>false</c>.
+  bool tryPositionUncertaintyGps2Ned(math::vec3f& value) VN_NOEXCEPT;
+
   /// \brief Indicates if <c>positionUncertaintyGpsEcef</c> has valid data.
   /// \return <c>true</c> if <c>positionUncertaintyGpsEcef</c> has valid data; otherwise <c>false</c>.
   bool hasPositionUncertaintyGpsEcef();
@@ -668,11 +1038,21 @@ public:
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	math::vec3f positionUncertaintyGpsEcef();
 
+	/// \brief Gets <c>positionUncertaintyGpsEcef</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>positionUncertaintyGpsEcef</c> if it has valid data.
+	/// \return <c>true</c> if <c>positionUncertaintyGpsEcef</c> has valid data; otherwise <c>false</c>.
+	bool tryPositionUncertaintyGpsEcef(math::vec3f& value) VN_NOEXCEPT;
+
   /// \brief GPS2 position uncertainty ECEF data.
   /// \return The GPS2 position uncertainty ECEF data.
   /// \exception invalid_operation Thrown if there is not any valid data.
   math::vec3f positionUncertaintyGps2Ecef();
 
+  /// \brief Gets <c>positionUncertaintyGps2Ecef</c> without throwing an exception.
+  /// \param[out] value Set to the value of <c>positionUncertaintyGps2Ecef</c> if it has valid data.
+  /// \return <c>true</c> if <c>positionUncertaintyGps2Ecef</c> has valid data; otherwise <c>false</c>.
+  bool tryPositionUncertaintyGps2Ecef(math::vec3f& value) VN_NOEXCEPT;
+
   /// \brief Indicates if <c>positionUncertaintyEstimated</c> has valid data.
 	/// \return <c>true</c> if <c>positionUncertaintyEstimated</c> has valid data; otherwise <c>false</c>.
 	bool hasPositionUncertaintyEstimated();
@@ -682,6 +1062,11 @@ public:
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	float positionUncertaintyEstimated();
 
+	/// \brief Gets <c>positionUncertaintyEstimated</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>positionUncertaintyEstimated</c> if it has valid data.
+	/// \return <c>true</c> if <c>positionUncertaintyEstimated</c> has valid data; otherwise <c>false</c>.
+	bool tryPositionUncertaintyEstimated(float& value) VN_NOEXCEPT;
+
 	/// \brief Indicates if <c>anyVelocityUncertainty</c> has valid data.
 	/// \return <c>true</c> if <c>anyVelocityUncertainty</c> has valid data; otherwise <c>false</c>.
 	bool hasAnyVelocityUncertainty();
@@ -693,6 +1078,11 @@ public:
 	/// \exception invalid_operation Thrown if there is no valid data.
 	float anyVelocityUncertainty();
 
+	/// \brief Gets <c>anyVelocityUncertainty</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>anyVelocityUncertainty</c> if it has valid data.
+	/// \return <c>true</c> if <c>anyVelocityUncertainty</c> has valid data; otherwise <c>false</c>.
+	bool tryAnyVelocityUncertainty(float& value) VN_NOEXCEPT;
+
   /// \brief Indicates if <c>velocityUncertaintyGps</c> has valid data.
   /// \return <c>true</c> if <c>velocityUncertaintyGps</c> has valid data; otherwise <c>false</c>.
   bool hasVelocityUncertaintyGps();
@@ -706,11 +1096,21 @@ public:
   /// \exception invalid_operation Thrown if there is not any valid data.
   float velocityUncertaintyGps();
 
+  /// \brief Gets <c>velocityUncertaintyGps</c> without throwing an exception.
+  /// \param[out] value Set to the value of <c>velocityUncertaintyGps</c> if it has valid data.
+  /// \return <c>true</c> if <c>velocityUncertaintyGps</c> has valid data; otherwise <c>false</c>.
+  bool tryVelocityUncertaintyGps(float& value) VN_NOEXCEPT;
+
   /// \brief GPS2 velocity uncertainty data.
   /// \return The GPS2 velocity uncertainty data.
   /// \exception invalid_operation Thrown if there is not any valid data.
   float velocityUncertaintyGps2();
 
+  /// \brief Gets <c>velocityUncertaintyGps2</c> without throwing an exception.
+  /// \param[out] value Set to the value of <c>velocityUncertaintyGps2</c> if it has valid data.
+  /// \return <c>true</c> if <c>velocityUncertaintyGps2</c> has valid data; otherwise <c>false</c>.
+  bool tryVelocityUncertaintyGps2(float& value) VN_NOEXCEPT;
+
   /// \brief Indicates if <c>velocityUncertaintyEstimated</c> has valid data.
 	/// \return <c>true</c> if <c>velocityUncertaintyEstimated</c> has valid data; otherwise <c>false</c>.
 	bool hasVelocityUncertaintyEstimated();
@@ -719,6 +1119,11 @@ public:
 	/// \return The estimated velocity uncertainty data.
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	float velocityUncertaintyEstimated();
+
+	/// \brief Gets <c>velocityUncertaintyEstimated</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>velocityUncertaintyEstimated</c> if it has valid data.
+	/// \return <c>true</c> if <c>velocityUncertaintyEstimated</c> has valid data; otherwise <c>false</c>.
+	bool tryVelocityUncertaintyEstimated(float& value) VN_NOEXCEPT;
 	
 	/// \brief Indicates if <c>timeUncertainty</c> has valid data.
 	/// \return <c>true</c> if <c>timeUncertainty</c> has valid data; otherwise <c>false</c>.
@@ -728,6 +1133,11 @@ public:
 	/// \return The time uncertainty data.
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	uint32_t timeUncertainty();
+
+	/// \brief Gets <c>timeUncertainty</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>timeUncertainty</c> if it has valid data.
+	/// \return <c>true</c> if <c>timeUncertainty</c> has valid data; otherwise <c>false</c>.
+	bool tryTimeUncertainty(uint32_t& value) VN_NOEXCEPT;
 	
 	/// \brief Indicates if <c>attitudeUncertainty</c> has valid data.
 	/// \return <c>true</c> if <c>attitudeUncertainty</c> has valid data; otherwise <c>false</c>.
@@ -738,6 +1148,11 @@ public:
 	/// \exception invalid_operation Thrown if there is not any valid data.
 	math::vec3f attitudeUncertainty();
 
+	/// \brief Gets <c>attitudeUncertainty</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>attitudeUncertainty</c> if it has valid data.
+	/// \return <c>true</c> if <c>attitudeUncertainty</c> has valid data; otherwise <c>false</c>.
+	bool tryAttitudeUncertainty(math::vec3f& value) VN_NOEXCEPT;
+
 	/// \brief Indicates if <c>courseOverGround</c> has valid data.
 	/// \return <c>true</c> if <c>courseOverGround</c> havs valid data; otherwise <c>false</c>.
 	bool hasCourseOverGround();
@@ -748,6 +1163,11 @@ public:
 	/// \exception invalid_operation Thrown if there is no valid data.
 	float courseOverGround();
 
+	/// \brief Gets <c>courseOverGround</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>courseOverGround</c> if it has valid data.
+	/// \return <c>true</c> if <c>courseOverGround</c> has valid data; otherwise <c>false</c>.
+	bool tryCourseOverGround(float& value) VN_NOEXCEPT;
+
 	/// \brief Indicates if <c>speedOverGround</c> has valid data.
 	/// \return <c>true</c> if <c>speedOverGround</c> havs valid data; otherwise <c>false</c>.
 	bool hasSpeedOverGround();
@@ -758,6 +1178,11 @@ public:
 	/// \exception invalid_operation Thrown if there is no valid data.
 	float speedOverGround();
 
+	/// \brief Gets <c>speedOverGround</c> without throwing an exception.
+	/// \param[out] value Set to the value of <c>speedOverGround</c> if it has valid data.
+	/// \return <c>true</c> if <c>speedOverGround</c> has valid data; otherwise <c>false</c>.
+	bool trySpeedOverGround(float& value) VN_NOEXCEPT;
+
   /// \brief Indicates if <c>timeInfo</c> has valid data.
   /// \return <c>true</c> if <c>timeInfo</c> havs valid data; otherwise <c>false</c>.
   bool hasTimeInfo();
@@ -768,12 +1193,26 @@ public:
   /// \exception invalid_operation Thrown if there is no valid data.
   protocol::uart::TimeInfo timeInfo();
 
+  /// \brief Gets <c>timeInfo</c> without throwing an exception.
+  /// \param[out] value Set to the value of <c>timeInfo</c> if it has valid data.
+  /// \return <c>true</c> if <c>timeInfo</c> has valid data; otherwise <c>false</c>.
+  bool tryTimeInfo(protocol::uart::TimeInfo& value) VN_NOEXCEPT;
+
+  /// \brief Indicates if <c>timeInfo2</c> has valid data.
+  /// \return <c>true</c> if <c>timeInfo2</c> has valid data; otherwise <c>false</c>.
+  bool hasTimeInfo2();
+
   /// \brief GPS2 Time Status and number of leap seconds.
   ///
   /// \return Current Time Info.
   /// \exception invalid_operation Thrown if there is no valid data.
   protocol::uart::TimeInfo timeInfo2();
 
+  /// \brief Gets <c>timeInfo2</c> without throwing an exception.
+  /// \param[out] value Set to the value of <c>timeInfo2</c> if it has valid data.
+  /// \return <c>true</c> if <c>timeInfo2</c> has valid data; otherwise <c>false</c>.
+  bool tryTimeInfo2(protocol::uart::TimeInfo& value) VN_NOEXCEPT;
+
   /// \brief Indicates if <c>dop</c> has valid data.
   /// \return <c>true</c> if <c>dop</c> havs valid data; otherwise <c>false</c>.
   bool hasDop();
@@ -784,26 +1223,58 @@ public:
   /// \exception invalid_operation Thrown if there is no valid data.
   protocol::uart::GnssDop dop();
 
+  /// \brief Gets <c>dop</c> without throwing an exception.
+  /// \param[out] value Set to the value of <c>dop</c> if it has valid data.
+  /// \return <c>true</c> if <c>dop</c> has valid data; otherwise <c>false</c>.
+  bool tryDop(protocol::uart::GnssDop& value) VN_NOEXCEPT;
+
 
 private:
-	static void parseBinary(protocol::uart::Packet& p, std::vector<CompositeData*>& o);
-	static void parseAscii(protocol::uart::Packet& p, std::vector<CompositeData*>& o);
-	static void parseBinaryPacketCommonGroup(protocol::uart::Packet& p, protocol::uart::CommonGroup gf, std::vector<CompositeData*>& o);
-	static void parseBinaryPacketTimeGroup(protocol::uart::Packet& p, protocol::uart::TimeGroup gf, std::vector<CompositeData*>& o);
-	static void parseBinaryPacketImuGroup(protocol::uart::Packet& p, protocol::uart::ImuGroup gf, std::vector<CompositeData*>& o);
-	static void parseBinaryPacketGpsGroup(protocol::uart::Packet& p, protocol::uart::GpsGroup gf, std::vector<CompositeData*>& o);
-	static void parseBinaryPacketAttitudeGroup(protocol::uart::Packet& p, protocol::uart::AttitudeGroup gf, std::vector<CompositeData*>& o);
-	static void parseBinaryPacketInsGroup(protocol::uart::Packet& p, protocol::uart::InsGroup gf, std::vector<CompositeData*>& o);
-	static void parseBinaryPacketGps2Group(protocol::uart::Packet& p, protocol::uart::GpsGroup gf, std::vector<CompositeData*>& o);
+
+	// A non-owning range of the CompositeData objects updated by a parse.
+	struct Targets
+	{
+		CompositeData* const* first;
+		CompositeData* const* last;
+
+		Targets(CompositeData* const* o, size_t count) : first(o), last(o + count) { }
+		CompositeData* const* begin() const { return first; }
+		CompositeData* const* end() const { return last; }
+	};
+
+	static void parseBinary(protocol::uart::PacketView& p, const Targets& o);
+	static bool hasCompleteBinaryPayload(protocol::uart::PacketView& p);
+	static bool parseAscii(protocol::uart::PacketView& p, const Targets& o);
+	static void parseBinaryPacketCommonGroup(protocol::uart::PacketView& p, protocol::uart::CommonGroup gf, const Targets& o);
+	static void parseBinaryPacketTimeGroup(protocol::uart::PacketView& p, protocol::uart::TimeGroup gf, const Targets& o);
+	static void parseBinaryPacketImuGroup(protocol::uart::PacketView& p, protocol::uart::ImuGroup gf, const Targets& o);
+	static void parseBinaryPacketGpsGroup(protocol::uart::PacketView& p, protocol::uart::GpsGroup gf, const Targets& o);
+	static void parseBinaryPacketAttitudeGroup(protocol::uart::PacketView& p, protocol::uart::AttitudeGroup gf, const Targets& o);
+	static void parseBinaryPacketInsGroup(protocol::uart::PacketView& p, protocol::uart::InsGroup gf, const Targets& o);
+	static void parseBinaryPacketGps2Group(protocol::uart::PacketView& p, protocol::uart::GpsGroup gf, const Targets& o);
 
 private:
 	struct Impl;
+
+	// The number of bytes reserved for the Impl.
+	static const size_t ImplStorageSize = 816;
+
 	Impl* _i;
 
+	// The Impl is a trivially copyable structure held inline here, so
+	// creating or copying a CompositeData never touches the heap. The
+	// uint64_t and double members only align the storage.
+	union
+	{
+		char _storage[ImplStorageSize];
+		uint64_t _storageAlignment;
+		double _storageAlignmentDouble;
+	};
+
 	template<typename T>
-	static void setValues(T val, std::vector<CompositeData*>& o, void (Impl::* function)(T))
+	static void setValues(T val, const Targets& o, void (Impl::* function)(T))
 	{
-		for (std::vector<CompositeData*>::iterator i = o.begin(); i != o.end(); ++i)
+		for (CompositeData* const* i = o.begin(); i != o.end(); ++i)
 			(*((*i)->_i).*function)(val);
 	}
 };
@@ -0,0 +1,261 @@
+/// \file
+/// {COMMON_HEADER}
+///
+/// \section DESCRIPTION
+/// This header file provides the class CompositeDataColumns.
+#ifndef _VNSENSORS_COMPOSITEDATACOLUMNS_H_
+#define _VNSENSORS_COMPOSITEDATACOLUMNS_H_
+
+#include <cstddef>
+#include <vector>
+
+#include "vn/int.h"
+#include "vn/export.h"
+#include "vn/types.h"
+
+namespace vn {
+namespace sensors {
+
+/// \brief The data of a batch of binary packets which share the same binary
+/// output layout, stored as one contiguous array per value component.
+///
+/// Members are named after the CompositeData accessors and hold the same
+/// values CompositeData::parse would produce for each packet, in packet order.
+/// Vector values are split into one array per component, so for example
+/// <c>quaternion[0]</c> holds the first quaternion component of every packet.
+/// Matrix components are stored in the order they are sent, which is column
+/// major. Arrays of values the packets do not contain are left empty.
+///
+/// Decoding happens one array at a time with a strided copy across the
+/// packets, since every packet has the value at the same offset.
+class vn_proglib_DLLEXPORT CompositeDataColumns
+{
+public:
+
+	CompositeDataColumns();
+
+	/// \brief Decodes a batch of binary packets into the columns, replacing
+	/// their previous contents.
+	///
+	/// The first packet which is a complete binary packet sets the layout of
+	/// the batch. Packets which are not binary packets, whose length does not
+	/// match the length their header describes, or whose header differs from
+	/// that first packet are skipped. Checksums are not verified, since a
+	/// PacketFinder only reports packets which have passed their check.
+	///
+	/// \param[in] packets The start of each packet.
+	/// \param[in] lengths The number of bytes in each packet.
+	/// \param[in] count The number of packets.
+	/// \param[in/out] o The columns to write the data to.
+	/// \return The number of packets which were skipped.
+	static size_t parse(const char* const* packets, const size_t* lengths, size_t count, CompositeDataColumns& o);
+
+	/// \brief Returns the number of packets held by the columns.
+	///
+	/// \return The number of packets.
+	size_t size() const;
+
+	/// \brief Empties every column.
+	void clear();
+
+	/// \brief The index in the batch of the packet each row was decoded from.
+	std::vector<size_t> packetIndex;
+
+	/// \brief Yaw, pitch, roll data.
+	std::vector<float> yawPitchRoll[3];
+
+	/// \brief Quaternion data.
+	std::vector<float> quaternion[4];
+
+	/// \brief Direction cosine matrix data.
+	std::vector<float> directionCosineMatrix[9];
+
+	/// \brief Magnetic data.
+	std::vector<float> magnetic[3];
+
+	/// \brief Magnetic uncompensated data.
+	std::vector<float> magneticUncompensated[3];
+
+	/// \brief Magnetic NED data.
+	std::vector<float> magneticNed[3];
+
+	/// \brief Magnetic ECEF data.
+	std::vector<float> magneticEcef[3];
+
+	/// \brief Acceleration data.
+	std::vector<float> acceleration[3];
+
+	/// \brief Acceleration linear body data.
+	std::vector<float> accelerationLinearBody[3];
+
+	/// \brief Acceleration uncompensated data.
+	std::vector<float> accelerationUncompensated[3];
+
+	/// \brief Acceleration linear NED data.
+	std::vector<float> accelerationLinearNed[3];
+
+	/// \brief Acceleration linear ECEF data.
+	std::vector<float> accelerationLinearEcef[3];
+
+	/// \brief Acceleration NED data.
+	std::vector<float> accelerationNed[3];
+
+	/// \brief Acceleration ECEF data.
+	std::vector<float> accelerationEcef[3];
+
+	/// \brief Angular rate data.
+	std::vector<float> angularRate[3];
+
+	/// \brief Angular rate uncompensated data.
+	std::vector<float> angularRateUncompensated[3];
+
+	/// \brief Temperature data.
+	std::vector<float> temperature;
+
+	/// \brief Pressure data.
+	std::vector<float> pressure;
+
+	/// \brief Position GPS LLA data.
+	std::vector<double> positionGpsLla[3];
+
+	/// \brief Position GPS2 LLA data.
+	std::vector<double> positionGps2Lla[3];
+
+	/// \brief Position GPS ECEF data.
+	std::vector<double> positionGpsEcef[3];
+
+	/// \brief Position GPS2 ECEF data.
+	std::vector<double> positionGps2Ecef[3];
+
+	/// \brief Position Estimated LLA data.
+	std::vector<double> positionEstimatedLla[3];
+
+	/// \brief Position Estimated ECEF data.
+	std::vector<double> positionEstimatedEcef[3];
+
+	/// \brief Velocity GPS NED data.
+	std::vector<float> velocityGpsNed[3];
+
+	/// \brief Velocity GPS2 NED data.
+	std::vector<float> velocityGps2Ned[3];
+
+	/// \brief Velocity GPS ECEF data.
+	std::vector<float> velocityGpsEcef[3];
+
+	/// \brief Velocity GPS2 ECEF data.
+	std::vector<float> velocityGps2Ecef[3];
+
+	/// \brief Velocity Estimated NED data.
+	std::vector<float> velocityEstimatedNed[3];
+
+	/// \brief Velocity Estimated ECEF data.
+	std::vector<float> velocityEstimatedEcef[3];
+
+	/// \brief Velocity Estimated Body data.
+	std::vector<float> velocityEstimatedBody[3];
+
+	/// \brief Delta time data.
+	std::vector<float> deltaTime;
+
+	/// \brief Delta theta data.
+	std::vector<float> deltaTheta[3];
+
+	/// \brief Delta velocity data.
+	std::vector<float> deltaVelocity[3];
+
+	/// \brief Time startup data.
+	std::vector<uint64_t> timeStartup;
+
+	/// \brief Time GPS data.
+	std::vector<uint64_t> timeGps;
+
+	/// \brief GPS time of week data.
+	std::vector<double> tow;
+
+	/// \brief Week data.
+	std::vector<uint16_t> week;
+
+	/// \brief NumSats data.
+	std::vector<uint8_t> numSats;
+
+	/// \brief TimeSyncIn data.
+	std::vector<uint64_t> timeSyncIn;
+
+	/// \brief VpeStatus data.
+	std::vector<protocol::uart::VpeStatus> vpeStatus;
+
+	/// \brief InsStatus data.
+	std::vector<protocol::uart::InsStatus> insStatus;
+
+	/// \brief SyncInCnt data.
+	std::vector<uint32_t> syncInCnt;
+
+	/// \brief SyncOutCnt data.
+	std::vector<uint32_t> syncOutCnt;
+
+	/// \brief TimeStatus data.
+	std::vector<uint8_t> timeStatus;
+
+	/// \brief TimeGpsPps data.
+	std::vector<uint64_t> timeGpsPps;
+
+	/// \brief GpsTow data.
+	std::vector<uint64_t> gpsTow;
+
+	/// \brief Gps2Tow data.
+	std::vector<uint64_t> gps2Tow;
+
+	/// \brief TimeUtc data.
+	std::vector<protocol::uart::TimeUtc> timeUtc;
+
+	/// \brief SensSat data.
+	std::vector<protocol::uart::SensSat> sensSat;
+
+	/// \brief GPS fix data.
+	std::vector<protocol::uart::GpsFix> fix;
+
+	/// \brief GPS2 fix data.
+	std::vector<protocol::uart::GpsFix> fix2;
+
+	/// \brief GPS position uncertainty NED data.
+	std::vector<float> positionUncertaintyGpsNed[3];
+
+	/// \brief GPS2 position uncertainty NED data.
+	std::vector<float> positionUncertaintyGps2Ned[3];
+
+	/// \brief Estimated position uncertainty data.
+	std::vector<float> positionUncertaintyEstimated;
+
+	/// \brief GPS velocity uncertainty data.
+	std::vector<float> velocityUncertaintyGps;
+
+	/// \brief GPS2 velocity uncertainty data.
+	std::vector<float> velocityUncertaintyGps2;
+
+	/// \brief Estimated velocity uncertainty data.
+	std::vector<float> velocityUncertaintyEstimated;
+
+	/// \brief Time uncertainty data.
+	std::vector<uint32_t> timeUncertainty;
+
+	/// \brief Attitude uncertainty data.
+	std::vector<float> attitudeUncertainty[3];
+
+	/// \brief GPS Time Status and number of leap seconds.
+	std::vector<protocol::uart::TimeInfo> timeInfo;
+
+	/// \brief GPS2 Time Status and number of leap seconds.
+	std::vector<protocol::uart::TimeInfo> timeInfo2;
+
+	/// \brief Dilution of precision data.
+	std::vector<protocol::uart::GnssDop> dop;
+
+private:
+
+	size_t _size;
+};
+
+}
+}
+
+#endif
@@ -38,12 +38,44 @@ public:
 
 	/// \brief Computes the 16-bit CRC of the provided data.
 	///
+	/// The fastest implementation supported by the processor is selected the
+	/// first time this is called. All implementations give identical results.
+	///
 	/// \param[in] data The data array to compute the 16-bit CRC for.
 	/// \param[in] length The length of data bytes from the array to compute
 	///     the CRC over.
 	/// \return The computed CRC.
 	static uint16_t compute(const char data[], size_t length);
 
+	/// \brief Computes the 16-bit CRC of the provided data one bit-twiddled
+	/// byte at a time. This is the reference implementation.
+	///
+	/// \param[in] data The data array to compute the 16-bit CRC for.
+	/// \param[in] length The length of data bytes from the array to compute
+	///     the CRC over.
+	/// \return The computed CRC.
+	static uint16_t computeBitwise(const char data[], size_t length);
+
+	/// \brief Computes the 16-bit CRC of the provided data eight bytes at a
+	/// time using lookup tables.
+	///
+	/// \param[in] data The data array to compute the 16-bit CRC for.
+	/// \param[in] length The length of data bytes from the array to compute
+	///     the CRC over.
+	/// \return The computed CRC.
+	static uint16_t computeSliceBy8(const char data[], size_t length);
+
+	/// \brief Computes the 16-bit CRC of the provided data sixteen bytes at a
+	/// time using the PCLMULQDQ carry-less multiply instruction.
+	///
+	/// \param[in] data The data array to compute the 16-bit CRC for.
+	/// \param[in] length The length of data bytes from the array to compute
+	///     the CRC over.
+	/// \return The computed CRC.
+	/// \exception not_supported Thrown if the processor does not support
+	///     PCLMULQDQ.
+	static uint16_t computeClmul(const char data[], size_t length);
+
 };
 
 }
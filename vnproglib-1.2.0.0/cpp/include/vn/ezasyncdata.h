@@ -61,7 +61,7 @@ public:
 	CompositeData getNextData(int timeoutMs);
 
 private:
-	static void asyncPacketReceivedHandler(void* userData, protocol::uart::Packet& p, size_t index);
+	static void asyncPacketReceivedHandler(void* userData, protocol::uart::PacketView& p, size_t index);
 
 private:
 	VnSensor* _sensor;
@@ -0,0 +1,332 @@
+/// \file
+/// {COMMON_HEADER}
+///
+/// \section DESCRIPTION
+/// This header file provides the class LazyCompositeData.
+#ifndef _VNSENSORS_LAZYCOMPOSITEDATA_H_
+#define _VNSENSORS_LAZYCOMPOSITEDATA_H_
+
+#include "vn/int.h"
+#include "vn/export.h"
+#include "vn/packet.h"
+#include "vn/attitude.h"
+#include "vn/position.h"
+
+/// \brief Lists the values of a binary packet which CompositeData provides,
+/// as <c>X(Name, accessor, Type)</c>.
+///
+/// CompositeData and LazyCompositeData both have the accessors
+/// <c>has<i>Name</i></c>, <c><i>accessor</i></c> and <c>try<i>Name</i></c>
+/// for every entry. LazyCompositeData's accessors are generated from this
+/// list, and the tests check each of them against CompositeData's.
+#define VN_COMPOSITEDATA_BINARY_VALUES(X) \
+	X(YawPitchRoll, yawPitchRoll, vn::math::vec3f) \
+	X(Quaternion, quaternion, vn::math::vec4f) \
+	X(DirectionCosineMatrix, directionCosineMatrix, vn::math::mat3f) \
+	X(Magnetic, magnetic, vn::math::vec3f) \
+	X(MagneticUncompensated, magneticUncompensated, vn::math::vec3f) \
+	X(MagneticNed, magneticNed, vn::math::vec3f) \
+	X(MagneticEcef, magneticEcef, vn::math::vec3f) \
+	X(Acceleration, acceleration, vn::math::vec3f) \
+	X(AccelerationLinearBody, accelerationLinearBody, vn::math::vec3f) \
+	X(AccelerationUncompensated, accelerationUncompensated, vn::math::vec3f) \
+	X(AccelerationLinearNed, accelerationLinearNed, vn::math::vec3f) \
+	X(AccelerationLinearEcef, accelerationLinearEcef, vn::math::vec3f) \
+	X(AccelerationNed, accelerationNed, vn::math::vec3f) \
+	X(AccelerationEcef, accelerationEcef, vn::math::vec3f) \
+	X(AngularRate, angularRate, vn::math::vec3f) \
+	X(AngularRateUncompensated, angularRateUncompensated, vn::math::vec3f) \
+	X(Temperature, temperature, float) \
+	X(Pressure, pressure, float) \
+	X(PositionGpsLla, positionGpsLla, vn::math::vec3d) \
+	X(PositionGps2Lla, positionGps2Lla, vn::math::vec3d) \
+	X(PositionGpsEcef, positionGpsEcef, vn::math::vec3d) \
+	X(PositionGps2Ecef, positionGps2Ecef, vn::math::vec3d) \
+	X(PositionEstimatedLla, positionEstimatedLla, vn::math::vec3d) \
+	X(PositionEstimatedEcef, positionEstimatedEcef, vn::math::vec3d) \
+	X(VelocityGpsNed, velocityGpsNed, vn::math::vec3f) \
+	X(VelocityGps2Ned, velocityGps2Ned, vn::math::vec3f) \
+	X(VelocityGpsEcef, velocityGpsEcef, vn::math::vec3f) \
+	X(VelocityGps2Ecef, velocityGps2Ecef, vn::math::vec3f) \
+	X(VelocityEstimatedNed, velocityEstimatedNed, vn::math::vec3f) \
+	X(VelocityEstimatedEcef, velocityEstimatedEcef, vn::math::vec3f) \
+	X(VelocityEstimatedBody, velocityEstimatedBody, vn::math::vec3f) \
+	X(DeltaTime, deltaTime, float) \
+	X(DeltaTheta, deltaTheta, vn::math::vec3f) \
+	X(DeltaVelocity, deltaVelocity, vn::math::vec3f) \
+	X(TimeStartup, timeStartup, uint64_t) \
+	X(TimeGps, timeGps, uint64_t) \
+	X(TimeGps2, timeGps2, uint64_t) \
+	X(Tow, tow, double) \
+	X(Week, week, uint16_t) \
+	X(NumSats, numSats, uint8_t) \
+	X(TimeSyncIn, timeSyncIn, uint64_t) \
+	X(VpeStatus, vpeStatus, vn::protocol::uart::VpeStatus) \
+	X(InsStatus, insStatus, vn::protocol::uart::InsStatus) \
+	X(SyncInCnt, syncInCnt, uint32_t) \
+	X(SyncOutCnt, syncOutCnt, uint32_t) \
+	X(TimeStatus, timeStatus, uint8_t) \
+	X(TimeGpsPps, timeGpsPps, uint64_t) \
+	X(TimeGps2Pps, timeGps2Pps, uint64_t) \
+	X(GpsTow, gpsTow, uint64_t) \
+	X(Gps2Tow, gps2Tow, uint64_t) \
+	X(TimeUtc, timeUtc, vn::protocol::uart::TimeUtc) \
+	X(SensSat, sensSat, vn::protocol::uart::SensSat) \
+	X(Fix, fix, vn::protocol::uart::GpsFix) \
+	X(Fix2, fix2, vn::protocol::uart::GpsFix) \
+	X(PositionUncertaintyGpsNed, positionUncertaintyGpsNed, vn::math::vec3f) \
+	X(PositionUncertaintyGps2Ned, positionUncertaintyGps2Ned, vn::math::vec3f) \
+	X(PositionUncertaintyGpsEcef, positionUncertaintyGpsEcef, vn::math::vec3f) \
+	X(PositionUncertaintyGps2Ecef, positionUncertaintyGps2Ecef, vn::math::vec3f) \
+	X(PositionUncertaintyEstimated, positionUncertaintyEstimated, float) \
+	X(VelocityUncertaintyGps, velocityUncertaintyGps, float) \
+	X(VelocityUncertaintyGps2, velocityUncertaintyGps2, float) \
+	X(VelocityUncertaintyEstimated, velocityUncertaintyEstimated, float) \
+	X(TimeUncertainty, timeUncertainty, uint32_t) \
+	X(AttitudeUncertainty, attitudeUncertainty, vn::math::vec3f) \
+	X(TimeInfo, timeInfo, vn::protocol::uart::TimeInfo) \
+	X(TimeInfo2, timeInfo2, vn::protocol::uart::TimeInfo) \
+	X(Dop, dop, vn::protocol::uart::GnssDop)
+
+namespace vn {
+namespace sensors {
+
+class CompositeDataColumns;
+
+/// \brief Provides the data of a binary packet through the same accessors as
+/// CompositeData, but only decodes a value when it is accessed.
+///
+/// Parsing records where each value lies in the packet, working from the
+/// packet's header; nothing is copied or decoded until one of the accessors
+/// is called, so values which are never read cost nothing. The packet's data
+/// is referenced rather than copied and must stay unchanged for as long as
+/// the LazyCompositeData is used, which is the case for the packet passed to
+/// a packet handler while the handler runs.
+///
+/// For every value listed in VN_COMPOSITEDATA_BINARY_VALUES there is a
+/// <c>has<i>Name</i>()</c> method indicating if the packet contains the
+/// value, an accessor which decodes it and throws invalid_operation if the
+/// packet does not contain it, and a <c>try<i>Name</i>(value)</c> method
+/// which decodes it without throwing an exception. When the packet contains
+/// a value in more than one group, the accessors return the one that
+/// CompositeData would keep, which is the one from the last group. The
+/// <c>any</c> accessors, <c>courseOverGround</c> and <c>speedOverGround</c>
+/// likewise use the value CompositeData would have updated last.
+///
+/// Only binary packets are supported.
+class vn_proglib_DLLEXPORT LazyCompositeData
+{
+public:
+
+	LazyCompositeData();
+
+	/// \brief Parses a binary packet.
+	///
+	/// \param[in] p The packet to parse, which must outlive the returned
+	///     object.
+	/// \return The indexed packet.
+	/// \exception not_supported Thrown if the packet is not a binary packet.
+	/// \exception invalid_operation Thrown if the packet is too short for the
+	///     fields its header lists.
+	static LazyCompositeData parse(protocol::uart::PacketView& p);
+
+	/// \brief Parses a binary packet.
+	///
+	/// \param[in] p The packet to parse, which must outlive <c>o</c>'s use of it.
+	/// \param[in/out] o The LazyCompositeData structure to index the packet into.
+	/// \exception not_supported Thrown if the packet is not a binary packet.
+	/// \exception invalid_operation Thrown if the packet is too short for the
+	///     fields its header lists.
+	static void parse(protocol::uart::PacketView& p, LazyCompositeData& o);
+
+	/// \brief Parses a binary packet without throwing an exception.
+	///
+	/// \param[in] p The packet to parse, which must outlive <c>o</c>'s use of it.
+	/// \param[in/out] o The LazyCompositeData structure to index the packet into.
+	///     It is left without data if the packet cannot be parsed.
+	/// \return <c>true</c> if the packet was parsed; <c>false</c> if it is not
+	///     a binary packet or is too short for the fields its header lists.
+	static bool tryParse(protocol::uart::PacketView& p, LazyCompositeData& o) VN_NOEXCEPT;
+
+	/// \brief Resets the LazyCompositeData object so it has no data.
+	void reset();
+
+	#define VN_LAZYCOMPOSITEDATA_ACCESSORS(Name, accessor, Type) \
+		bool has##Name(); \
+		Type accessor(); \
+		bool try##Name(Type& value) VN_NOEXCEPT;
+
+	VN_COMPOSITEDATA_BINARY_VALUES(VN_LAZYCOMPOSITEDATA_ACCESSORS)
+
+	#undef VN_LAZYCOMPOSITEDATA_ACCESSORS
+
+	/// \brief Indicates if <c>anyAttitude</c> has valid data.
+	/// \return <c>true</c> if <c>anyAttitude</c> has valid data; otherwise <c>false</c>.
+	bool hasAnyAttitude();
+
+	/// \brief Gets and converts the latest attitude data regardless of the
+	/// received underlying type.
+	/// \return The attitude data.
+	/// \exception invalid_operation Thrown if there is no valid data.
+	math::AttitudeF anyAttitude();
+
+	/// \brief Indicates if <c>anyMagnetic</c> has valid data.
+	/// \return <c>true</c> if <c>anyMagnetic</c> has valid data; otherwise <c>false</c>.
+	bool hasAnyMagnetic();
+
+	/// \brief Gets the latest magnetic data regardless of the received
+	/// underlying type.
+	/// \return The magnetic data.
+	/// \exception invalid_operation Thrown if there is no valid data.
+	math::vec3f anyMagnetic();
+
+	/// \brief Indicates if <c>anyAcceleration</c> has valid data.
+	/// \return <c>true</c> if <c>anyAcceleration</c> has valid data; otherwise <c>false</c>.
+	bool hasAnyAcceleration();
+
+	/// \brief Gets the latest acceleration data regardless of the received
+	/// underlying type.
+	/// \return The acceleration data.
+	/// \exception invalid_operation Thrown if there is no valid data.
+	math::vec3f anyAcceleration();
+
+	/// \brief Indicates if <c>anyAngularRate</c> has valid data.
+	/// \return <c>true</c> if <c>anyAngularRate</c> has valid data; otherwise <c>false</c>.
+	bool hasAnyAngularRate();
+
+	/// \brief Gets the latest angular rate data regardless of the received
+	/// underlying type.
+	/// \return The angular rate data.
+	/// \exception invalid_operation Thrown if there is no valid data.
+	math::vec3f anyAngularRate();
+
+	/// \brief Indicates if <c>anyTemperature</c> has valid data.
+	/// \return <c>true</c> if <c>anyTemperature</c> has valid data; otherwise <c>false</c>.
+	bool hasAnyTemperature();
+
+	/// \brief Gets the latest temperature data regardless of the received
+	/// underlying type.
+	/// \return The temperature data.
+	/// \exception invalid_operation Thrown if there is no valid data.
+	float anyTemperature();
+
+	/// \brief Indicates if <c>anyPressure</c> has valid data.
+	/// \return <c>true</c> if <c>anyPressure</c> has valid data; otherwise <c>false</c>.
+	bool hasAnyPressure();
+
+	/// \brief Gets the latest pressure data regardless of the received
+	/// underlying type.
+	/// \return The pressure data.
+	/// \exception invalid_operation Thrown if there is no valid data.
+	float anyPressure();
+
+	/// \brief Indicates if <c>anyPosition</c> has valid data.
+	/// \return <c>true</c> if <c>anyPosition</c> has valid data; otherwise <c>false</c>.
+	bool hasAnyPosition();
+
+	/// \brief Gets the latest position data regardless of the received
+	/// underlying type.
+	/// \return The position data.
+	/// \exception invalid_operation Thrown if there is no valid data.
+	math::PositionD anyPosition();
+
+	/// \brief Indicates if <c>anyVelocity</c> has valid data.
+	/// \return <c>true</c> if <c>anyVelocity</c> has valid data; otherwise <c>false</c>.
+	bool hasAnyVelocity();
+
+	/// \brief Gets the latest velocity data regardless of the received
+	/// underlying type.
+	/// \return The velocity data.
+	/// \exception invalid_operation Thrown if there is no valid data.
+	math::vec3f anyVelocity();
+
+	/// \brief Indicates if <c>anyPositionUncertainty</c> has valid data.
+	/// \return <c>true</c> if <c>anyPositionUncertainty</c> has valid data; otherwise <c>false</c>.
+	bool hasAnyPositionUncertainty();
+
+	/// \brief Gets the latest position uncertainty data regardless of the
+	/// received underlying type.
+	/// \return The position uncertainty data.
+	/// \exception invalid_operation Thrown if there is no valid data.
+	math::vec3f anyPositionUncertainty();
+
+	/// \brief Indicates if <c>anyVelocityUncertainty</c> has valid data.
+	/// \return <c>true</c> if <c>anyVelocityUncertainty</c> has valid data; otherwise <c>false</c>.
+	bool hasAnyVelocityUncertainty();
+
+	/// \brief Gets the latest velocity uncertainty data regardless of the
+	/// received underlying type.
+	/// \return The velocity uncertainty data.
+	/// \exception invalid_operation Thrown if there is no valid data.
+	float anyVelocityUncertainty();
+
+	/// \brief Indicates if <c>courseOverGround</c> has valid data.
+	/// \return <c>true</c> if <c>courseOverGround</c> has valid data; otherwise <c>false</c>.
+	bool hasCourseOverGround();
+
+	/// \brief Computes the course over ground from the latest velocity data
+	/// in the NED frame.
+	/// \return The course over ground.
+	/// \exception invalid_operation Thrown if there is no valid data.
+	float courseOverGround();
+
+	/// \brief Indicates if <c>speedOverGround</c> has valid data.
+	/// \return <c>true</c> if <c>speedOverGround</c> has valid data; otherwise <c>false</c>.
+	bool hasSpeedOverGround();
+
+	/// \brief Computes the speed over ground from the latest velocity data
+	/// in the NED frame.
+	/// \return The speed over ground.
+	/// \exception invalid_operation Thrown if there is no valid data.
+	float speedOverGround();
+
+private:
+
+	// Uses the field index to decode batches of packets.
+	friend class CompositeDataColumns;
+
+	#define VN_LAZYCOMPOSITEDATA_FIELD(Name, accessor, Type) LCD_##Name,
+
+	enum Field
+	{
+		VN_COMPOSITEDATA_BINARY_VALUES(VN_LAZYCOMPOSITEDATA_FIELD)
+		LCD_Count
+	};
+
+	#undef VN_LAZYCOMPOSITEDATA_FIELD
+
+	// Identifies a value available from a binary group field and where in the
+	// field the value starts.
+	struct FieldTarget
+	{
+		uint8_t field;
+		uint8_t offset;
+	};
+
+	// The values available from each field of each binary group, in the order
+	// of the group indices and field bits. Unused entries have a field of
+	// LCD_Count.
+	static const FieldTarget FieldTargets[7][16][3];
+
+	// Returns the one of the fields which comes last in the packet, which is
+	// the one CompositeData would have updated last, or LCD_Count if the
+	// packet contains none of them.
+	Field latest(const Field* fields, size_t count) VN_NOEXCEPT;
+
+	// Returns the velocity CompositeData would have updated last, or
+	// LCD_Count if the packet contains no velocity.
+	Field latestVelocity() VN_NOEXCEPT;
+
+	// The data of the indexed packet, or NULL if there is none.
+	const char* _data;
+
+	// Offset in the packet of each value, or 0 when the packet does not
+	// contain it. Offset 0 always holds the sync byte, so it never holds a
+	// value.
+	uint16_t _offsets[LCD_Count];
+};
+
+}
+}
+
+#endif
@@ -6,18 +6,60 @@
 #include "matrix.h"
 #include "nocopy.h"
 #include "types.h"
+#include "compiler.h"
+
+/// \brief Expands <c>ROW</c> once for each binary group, in the order of the
+/// groups present byte, with the payload lengths of the fields selected by
+/// bits 0 to 14 of the group field.
+///
+/// This is the only copy of the binary field lengths. The tables in Packet
+/// and the compile-time tables of BinaryOutputDecoder are all built from it.
+#define VN_BINARY_GROUP_FIELD_LENGTHS(ROW) \
+	ROW( 8,  8,  8, 12, 16, 12, 24, 12, 12, 24, 20, 28,  2,  4,  8)		/* Group 1 */ \
+	ROW( 8,  8,  8,  2,  8,  8,  8,  4,  4,  1,  0,  0,  0,  0,  0)		/* Group 2 */ \
+	ROW( 2, 12, 12, 12,  4,  4, 16, 12, 12, 12, 12,  2, 40,  0,  0)		/* Group 3 */ \
+	ROW( 8,  8,  2,  1,  1, 24, 24, 12, 12, 12,  4,  4,  2, 28,  0)		/* Group 4 */ \
+	ROW( 2, 12, 16, 36, 12, 12, 12, 12, 12, 12, 28, 24, 12,  0,  0)		/* Group 5 */ \
+	ROW( 2, 24, 24, 12, 12, 12, 12, 12, 12,  4,  4, 68, 64,  0,  0)		/* Group 6 */ \
+	ROW( 8,  8,  2,  1,  1, 24, 24, 12, 12, 12,  4,  4,  2, 28,  0)		/* Group 7 */
 
 namespace vn {
 namespace protocol {
 namespace uart {
 
-/// \brief Structure representing a UART packet received from the VectorNav
+struct Packet;
+
+/// \brief Non-owning view of a UART packet received from the VectorNav
 /// sensor.
-struct vn_proglib_DLLEXPORT Packet
+///
+/// A PacketView refers directly to the bytes the packet was found in, so no
+/// memory is allocated or copied when it is created. The packets provided to
+/// packet handlers are views which are only valid for the duration of the
+/// callback. To keep the packet beyond that point, retain it by copying it
+/// into a Packet, which will make its own copy of the data.
+///
+/// [Example]
+///
+/// void asyncPacketReceived(void* userData, PacketView& p, size_t index)
+/// {
+///     Packet retained(p);
+///     ...
+/// }
+struct vn_proglib_DLLEXPORT PacketView
 {
 	/// \brief Array containing sizes for the binary group fields.
 	static const unsigned char BinaryGroupLengths[sizeof(uint8_t)*8][sizeof(uint16_t)*15];
 
+	/// \brief Array containing the combined sizes of the binary group fields
+	/// selected by each nibble of a group field.
+	///
+	/// <c>BinaryGroupNibbleLengths[group][nibble][value]</c> is the number of
+	/// payload bytes for the fields selected by <c>value</c> in nibble
+	/// <c>nibble</c> (0 being the least significant) of the group field for
+	/// group index <c>group</c>. The tables are generated at compile time from
+	/// the lengths in BinaryGroupLengths.
+	static const unsigned char BinaryGroupNibbleLengths[8][4][16];
+
 	/// \brief The different types of UART packets.
 	enum Type
 	{
@@ -26,35 +68,45 @@ struct vn_proglib_DLLEXPORT Packet
 		TYPE_ASCII		///< ASCII packet.
 	};
 
-	Packet();
-
-	/// \brief Creates a new packet based on the provided packet data buffer. A full
-	/// packet is expected which contains the deliminators (i.e. "$VNRRG,1*XX\r\n").
+	/// \brief Creates a new view of the provided packet data buffer. A full
+	/// packet is expected which contains the deliminators.
 	///
 	/// \param[in] packet Pointer to buffer containing the packet.
 	/// \param[in] length The number of bytes in the packet.
-	Packet(char const* packet, size_t length);
+	PacketView(char* packet, size_t length);
 
-	explicit Packet(std::string packet);
-
-	/// \brief Copy constructor.
+	/// \brief Copy constructor. The new view refers to the same data.
 	///
-	/// \param[in] toCopy The Packet to copy.
-	Packet(const Packet &toCopy);
+	/// \param[in] toCopy The PacketView to copy.
+	PacketView(const PacketView &toCopy);
 
-	~Packet();
+	/// \brief Assignment operator. The view will refer to the same data.
+	///
+	/// \param[in] from The view to assign from.
+	/// \return Reference to this view.
+	PacketView& operator=(const PacketView &from);
 
-	/// \brief Assignment operator.
+	/// \brief Makes an owning copy of the packet which remains valid after
+	/// the underlying buffer is reused.
 	///
-	/// \param[in] from The packet to assign from.
-	/// \return Reference to the newly copied packet.
-	Packet& operator=(const Packet &from);
+	/// \return The retained packet.
+	Packet retain() const;
 
 	/// \brief Returns the encapsulated data as a string.
 	///
 	/// \return The packet data.
 	std::string datastr();
 
+	/// \brief Returns the encapsulated data.
+	///
+	/// \return Pointer to the packet data.
+	const char* data() const;
+
+	/// \brief Returns the number of bytes in the packet.
+	///
+	/// \return The packet length.
+	size_t length() const;
+
 	/// \brief Returns the type of packet.
 	///
 	/// \return The type of packet.
@@ -65,10 +117,22 @@ struct vn_proglib_DLLEXPORT Packet
 	/// This will perform an 8-bit XOR checksum, a CRC16-CCITT CRC, or no
 	/// checking depending on the provided data integrity in the packet.
 	///
+	/// The check is only performed the first time this is called; later
+	/// calls, including on copies of the packet, return the same result.
+	///
 	/// \return <c>true</c> if the packet passed the data integrity checks;
 	///     otherwise <c>false</c>.
 	bool isValid();
 
+	/// \brief Performs the data integrity check on the data packet without
+	/// throwing an exception for packets of an unknown type.
+	///
+	/// \param[out] valid Set to <c>true</c> if the packet passed the data
+	///     integrity checks; otherwise <c>false</c>.
+	/// \return <c>true</c> if the integrity of the packet could be checked;
+	///     <c>false</c> if the packet is of an unknown type.
+	bool tryIsValid(bool& valid) VN_NOEXCEPT;
+
 	/// \brief Indicates if the packet is an ASCII error message.
 	///
 	/// \return <c>true</c> if the packet is an error message; otherwise
@@ -101,6 +165,21 @@ struct vn_proglib_DLLEXPORT Packet
 	/// \return The asynchronous data type of the packet.
 	AsciiAsync determineAsciiAsyncType();
 
+	/// \brief Determines the type of ASCII asynchronous message this packet
+	/// is without throwing an exception.
+	///
+	/// \param[out] type Set to the asynchronous data type of the packet.
+	/// \return <c>true</c> if the packet is a known ASCII asynchronous
+	///     message; otherwise <c>false</c>.
+	bool tryDetermineAsciiAsyncType(AsciiAsync& type) VN_NOEXCEPT;
+
+	/// \brief Counts the data fields of an ASCII message, which are the
+	/// comma separated values between the message identifier and the
+	/// checksum.
+	///
+	/// \return The number of fields the parse routines are able to read.
+	size_t countAsciiFields() const VN_NOEXCEPT;
+
 	/// \brief Determines if the packet is a compatible match for an expected
 	/// binary output message type.
 	///
@@ -133,6 +212,15 @@ struct vn_proglib_DLLEXPORT Packet
 	/// \return The number of bytes for this group.
 	static size_t computeNumOfBytesForBinaryGroupPayload(BinaryGroup group, uint16_t groupField);
 
+	/// \brief Computes the offset of a field within the payload of a binary
+	/// group.
+	///
+	/// \param[in] group The group the field belongs to.
+	/// \param[in] groupField The flags for data types present.
+	/// \param[in] fieldIndex The bit position of the field in the group field.
+	/// \return The number of bytes preceding the field in the group's payload.
+	static size_t computeBinaryFieldOffset(BinaryGroup group, uint16_t groupField, size_t fieldIndex);
+
 	/// \brief Parses an error packet to get the error type.
 	///
 	/// \return The sensor error.
@@ -215,6 +303,32 @@ struct vn_proglib_DLLEXPORT Packet
 	/// \return The extracted value.
 	vn::math::mat3f extractMat3f();
 
+	/// \brief Moves the extraction point so the next extraction starts at the
+	/// provided offset instead of following the previous one.
+	///
+	/// \param[in] offset The offset from the start of the packet of the next
+	///     byte to extract. Must be past the packet's header, or 0 to start
+	///     again from the first field.
+	void setExtractLocation(size_t offset);
+
+	/// \brief This group of methods extract data from binary data packets like
+	/// the <c>extract</c> methods above but report a packet that is too short
+	/// by their return value instead of throwing an exception. Nothing is
+	/// extracted and the extraction point is not advanced on failure.
+	///
+	/// \param[out] value Set to the extracted value.
+	/// \return <c>true</c> if the value was extracted; otherwise <c>false</c>.
+	bool tryExtract(uint8_t& value) VN_NOEXCEPT;
+	bool tryExtract(int8_t& value) VN_NOEXCEPT;
+	bool tryExtract(uint16_t& value) VN_NOEXCEPT;
+	bool tryExtract(uint32_t& value) VN_NOEXCEPT;
+	bool tryExtract(uint64_t& value) VN_NOEXCEPT;
+	bool tryExtract(float& value) VN_NOEXCEPT;
+	bool tryExtract(vn::math::vec3f& value) VN_NOEXCEPT;
+	bool tryExtract(vn::math::vec3d& value) VN_NOEXCEPT;
+	bool tryExtract(vn::math::vec4f& value) VN_NOEXCEPT;
+	bool tryExtract(vn::math::mat3f& value) VN_NOEXCEPT;
+
 	/// \}
 
 	/// \brief Appends astrick (*), checksum, and newlines to command.
@@ -2197,14 +2311,116 @@ struct vn_proglib_DLLEXPORT Packet
 
 	/// \}
 
+protected:
+
+	/// \brief Creates a view which does not refer to any data yet.
+	PacketView();
+
+	/// \brief Copies the integrity check and classification results from
+	/// another packet containing the same data.
+	///
+	/// \param[in] from The packet to copy the results from.
+	void copyCachedStateFrom(const PacketView &from);
+
 private:
 
-	void ensureCanExtract(size_t numOfBytes);
+	bool canExtract(size_t numOfBytes) VN_NOEXCEPT;
+	bool checkIsValid(bool& valid) VN_NOEXCEPT;
+	void classify();
+	void initializeCachedState();
+
+protected:
 
-	bool _isPacketDataMine;
 	size_t _length;
 	char *_data;
 	size_t _curExtractLoc;
+
+	// The integrity check and classification of a packet never change, so
+	// they are only determined once and then carried along with the packet.
+	bool _isValidityKnown;
+	bool _isValid;
+	bool _isClassified;
+	bool _isError;
+	bool _isResponse;
+	bool _isBootloader;
+	bool _isAsciiAsync;
+	AsciiAsync _asciiAsyncType;
+};
+
+/// \brief Structure representing a UART packet received from the VectorNav
+/// sensor.
+///
+/// A Packet offers the same interface as a PacketView but owns a copy of the
+/// packet data, so it remains valid for as long as it is kept.
+struct vn_proglib_DLLEXPORT Packet : public PacketView
+{
+	/// \brief The largest packet a Packet stores without allocating memory.
+	/// This is the size of the largest binary packet expected from the
+	/// sensor, so only oversized packets are allocated. PacketViews do not
+	/// carry this storage.
+	static const size_t MaximumInlineDataSize = 600;
+
+	Packet();
+
+	/// \brief Creates a new packet based on the provided packet data buffer. A full
+	/// packet is expected which contains the deliminators (i.e. "$VNRRG,1*XX\r\n").
+	///
+	/// \param[in] packet Pointer to buffer containing the packet.
+	/// \param[in] length The number of bytes in the packet.
+	Packet(char const* packet, size_t length);
+
+	explicit Packet(std::string packet);
+
+	/// \brief Copy constructor.
+	///
+	/// \param[in] toCopy The Packet to copy.
+	Packet(const Packet &toCopy);
+
+	/// \brief Retains a packet by copying the data it refers to.
+	///
+	/// \param[in] toCopy The PacketView to copy.
+	Packet(const PacketView &toCopy);
+
+	#if VN_SUPPORTS_MOVE
+
+	/// \brief Move constructor. Takes over the data of a packet which owns
+	/// allocated data instead of copying it.
+	///
+	/// \param[in] toMove The Packet to move.
+	Packet(Packet&& toMove);
+
+	#endif
+
+	~Packet();
+
+	/// \brief Assignment operator.
+	///
+	/// \param[in] from The packet to assign from.
+	/// \return Reference to the newly copied packet.
+	Packet& operator=(const Packet &from);
+
+	#if VN_SUPPORTS_MOVE
+
+	/// \brief Move assignment operator.
+	///
+	/// \param[in] from The packet to move from.
+	/// \return Reference to the packet.
+	Packet& operator=(Packet&& from);
+
+	#endif
+
+private:
+
+	void releaseData();
+	void copyDataFrom(const char* data, size_t length);
+	#if VN_SUPPORTS_MOVE
+	void moveDataFrom(Packet& from);
+	#endif
+
+	bool _isPacketDataMine;
+
+	// Owned data which fits is stored here rather than being allocated.
+	char _inlineData[MaximumInlineDataSize];
 };
 
 }
@@ -13,6 +13,91 @@ namespace vn {
 namespace protocol {
 namespace uart {
 
+class PacketFinder;
+
+/// \brief Reusable collection of the packets found by a \ref PacketFinder in
+/// a single call to processReceivedData.
+///
+/// Each packet is a PacketView which has already passed its integrity check.
+/// Packets found entirely within the data provided to processReceivedData
+/// refer directly to that data, while packets which were split across calls
+/// are copied into storage owned by the batch. The packets are only valid
+/// until the batch is cleared or reused, and until the provided data buffer
+/// is modified.
+///
+/// The batch keeps its memory when cleared, so reusing the same batch for
+/// every read does not allocate once it has grown to the number of packets
+/// typically found per read.
+///
+/// [Example]
+///
+/// PacketBatch batch;
+///
+/// while (...)
+/// {
+///     size_t numOfBytesRead = ...;
+///     finder.processReceivedData(buffer, numOfBytesRead, batch);
+///
+///     for (size_t i = 0; i < batch.size(); i++)
+///         decode(batch.packet(i), batch.timestamp(i));
+/// }
+class vn_proglib_DLLEXPORT PacketBatch : private util::NoCopy
+{
+
+public:
+
+	PacketBatch();
+
+	~PacketBatch();
+
+	/// \brief Returns the number of packets in the batch.
+	///
+	/// \return The number of packets.
+	size_t size() const;
+
+	/// \brief Indicates if the batch does not contain any packets.
+	///
+	/// \return <c>true</c> if the batch is empty; otherwise <c>false</c>.
+	bool empty() const;
+
+	/// \brief Removes all packets from the batch while keeping its memory for
+	/// reuse.
+	void clear();
+
+	/// \brief Returns a packet in the batch.
+	///
+	/// \param[in] index The index of the packet, in the order found.
+	/// \return The packet.
+	PacketView& packet(size_t index);
+
+	/// \brief Returns the running index of the start of a packet in the batch.
+	///
+	/// \param[in] index The index of the packet, in the order found.
+	/// \return The running index of the start of the packet.
+	size_t runningIndexOfPacketStart(size_t index) const;
+
+	/// \brief Returns the timestamp a packet in the batch was found.
+	///
+	/// \param[in] index The index of the packet, in the order found.
+	/// \return The timestamp of the packet.
+	xplat::TimeStamp timestamp(size_t index) const;
+
+private:
+
+	friend class PacketFinder;
+
+	// Reserves space to copy a packet into which would otherwise not remain
+	// valid. Space must be released in the reverse order it was reserved.
+	char* reserveStorage(size_t length);
+	void releaseStorage(size_t length);
+
+	void add(const PacketView& packet, size_t runningIndexOfPacketStart, xplat::TimeStamp timestamp);
+
+	struct Impl;
+	Impl *_pi;
+
+};
+
 /// \brief Helps with management of communication with a sensor using the UART
 /// protocol.
 ///
@@ -30,13 +115,16 @@ public:
 	/// \brief Defines the signature for a method that can receive
 	/// notifications of new valid packets found.
 	///
+	/// The packet refers directly to the received data and is only valid for
+	/// the duration of the callback. Copy it into a new Packet to keep it.
+	///
 	/// \param[in] userData Pointer to user data that was initially supplied
 	///     when the callback was registered via registerPossiblePacketFoundHandler.
 	/// \param[in] possiblePacket The possible packet that was found.
 	/// \param[in] packetStartRunningIndex The running index of the start of
 	///     the packet.
 	/// \param[in] timestamp The timestamp the packet was found.
-	typedef void (*ValidPacketFoundHandler)(void* userData, Packet& packet, size_t runningIndexOfPacketStart, xplat::TimeStamp timestamp);
+	typedef void (*ValidPacketFoundHandler)(void* userData, PacketView& packet, size_t runningIndexOfPacketStart, xplat::TimeStamp timestamp);
 
 	/// \brief Creates a new /ref PacketFinder with internal buffers to store
 	/// incoming bytes and alert when valid packets are received.
@@ -45,8 +133,9 @@ public:
 	/// \brief Creates a new /ref PacketFinder with an internal buffer the size
 	/// specified.
 	///
-	/// \param[in] internalReceiveBufferSize The number of bytes to make the
-	///     internal buffer.
+	/// \param[in] internalReceiveBufferSize The minimum number of bytes to
+	///     make the internal buffer. The buffer is rounded up to a whole
+	///     number of memory pages.
 	explicit PacketFinder(size_t internalReceiveBufferSize);
 
 	~PacketFinder();
@@ -67,6 +156,27 @@ public:
 	/// \param[in] timestamp The time when the data was received.
 	void processReceivedData(char data[], size_t length, bool bootloaderFilter, xplat::TimeStamp timestamp);
 
+	/// \brief Adds new data to the internal buffers and collects the valid
+	/// packets found into the provided batch instead of notifying the
+	/// registered callback.
+	///
+	/// \param[in] data The data buffer containing the received data.
+	/// \param[in] length The number of bytes of data in the buffer.
+	/// \param[out] batch The batch to fill. It is cleared first.
+	void processReceivedData(char data[], size_t length, PacketBatch& batch);
+
+	/// \brief Adds new data to the internal buffers and collects the valid
+	/// packets found into the provided batch instead of notifying the
+	/// registered callback.
+	///
+	/// \param[in] data The data buffer containing the received data.
+	/// \param[in] length The number of bytes of data in the buffer.
+	/// \param[in] bootloaderFilter Indicates if bootloader messages are being
+	///     received.
+	/// \param[in] timestamp The time when the data was received.
+	/// \param[out] batch The batch to fill. It is cleared first.
+	void processReceivedData(char data[], size_t length, bool bootloaderFilter, xplat::TimeStamp timestamp, PacketBatch& batch);
+
 	#if PYTHON
 
 	void processReceivedData(boost::python::list data);
@@ -84,6 +194,48 @@ public:
 	/// \brief Unregisters the registered callback method.
 	void unregisterPossiblePacketFoundHandler();
 
+	/// \brief Registers the group configuration of a binary output the sensor
+	/// is expected to send.
+	///
+	/// Once any binary output is registered, the header of each possible
+	/// binary packet is compared against the registered configurations as
+	/// soon as it is found. Matching packets are checked without being
+	/// tracked byte by byte. Possible packets which do not match are still
+	/// tracked as usual unless rejectUnexpectedBinaryOutputs is set.
+	///
+	/// \param[in] binaryOutputNumber The binary output register (1 - 3) the
+	///     configuration is for. Registering an output again replaces its
+	///     previous configuration.
+	/// \param[in] commonGroup The Common Group configuration.
+	/// \param[in] timeGroup The Time Group configuration.
+	/// \param[in] imuGroup The IMU Group configuration.
+	/// \param[in] gpsGroup The GPS Group configuration.
+	/// \param[in] attitudeGroup The Attitude Group configuration.
+	/// \param[in] insGroup The INS Group configuration.
+	/// \param[in] gps2Group The GPS2 Group configuration.
+	void registerExpectedBinaryOutput(uint8_t binaryOutputNumber, CommonGroup commonGroup, TimeGroup timeGroup, ImuGroup imuGroup, GpsGroup gpsGroup, AttitudeGroup attitudeGroup, InsGroup insGroup, GpsGroup gps2Group);
+
+	/// \brief Unregisters the configuration of a binary output.
+	///
+	/// \param[in] binaryOutputNumber The binary output register (1 - 3).
+	void unregisterExpectedBinaryOutput(uint8_t binaryOutputNumber);
+
+	/// \brief Indicates if possible binary packets which do not match any
+	/// registered binary output are discarded.
+	///
+	/// \return <c>true</c> if unexpected binary packets are discarded;
+	/// otherwise <c>false</c>.
+	bool rejectUnexpectedBinaryOutputs();
+
+	/// \brief Sets if possible binary packets which do not match any
+	/// registered binary output are discarded immediately instead of being
+	/// tracked. This has no effect while no binary outputs are registered.
+	/// Defaults to <c>false</c>.
+	///
+	/// \param[in] reject <c>true</c> to only find binary packets matching
+	///     the registered binary outputs.
+	void setRejectUnexpectedBinaryOutputs(bool reject);
+
 	#if PYTHON
 
 	boost::python::object* register_packet_found_handler(/*boost::python::object* callable*/ PyObject* callable);
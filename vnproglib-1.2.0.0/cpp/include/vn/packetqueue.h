@@ -0,0 +1,118 @@
+/// \file
+/// {COMMON_HEADER}
+///
+/// \section DESCRIPTION
+/// This header file provides the class PacketQueue.
+#ifndef _VNPROTOCOL_UART_PACKETQUEUE_H_
+#define _VNPROTOCOL_UART_PACKETQUEUE_H_
+
+#include <cstddef>
+
+#include "int.h"
+#include "nocopy.h"
+#include "export.h"
+#include "packet.h"
+#include "vntime.h"
+
+namespace vn {
+namespace protocol {
+namespace uart {
+
+/// \brief Lock-free queue which hands framed packets from one thread to
+/// another.
+///
+/// The queue has exactly one producer thread, which may only call
+/// <c>push</c>, and exactly one consumer thread, which may only call
+/// <c>front</c> and <c>pop</c>. Neither side ever blocks or allocates memory:
+/// each packet is copied into a fixed slot, and a packet pushed while every
+/// slot is taken is dropped and counted instead. The statistics may be read
+/// from any thread.
+class vn_proglib_DLLEXPORT PacketQueue : private util::NoCopy
+{
+
+	// Constructors ///////////////////////////////////////////////////////////
+
+public:
+
+	/// \brief The largest packet the queue can hold, which is the largest
+	/// packet a PacketFinder reports.
+	static const size_t MaximumPacketSize = 600;
+
+	/// \brief Creates a new packet queue.
+	///
+	/// \param[in] minimumCapacity The minimum number of packets the queue must
+	///     hold. The actual capacity is rounded up to a power of two.
+	explicit PacketQueue(size_t minimumCapacity);
+
+	~PacketQueue();
+
+	// Public Methods /////////////////////////////////////////////////////////
+
+public:
+
+	/// \brief Returns the number of packets the queue holds.
+	///
+	/// \return The capacity of the queue.
+	size_t capacity() const;
+
+	/// \brief Copies a packet to the back of the queue. May only be called by
+	/// the producer.
+	///
+	/// \param[in] packet The packet to queue.
+	/// \param[in] runningIndex The running index of the start of the packet.
+	/// \param[in] timestamp The time the packet was received.
+	/// \return <c>true</c> if the packet was queued; <c>false</c> if it was
+	///     dropped because the queue is full or the packet is too large.
+	bool push(const PacketView &packet, size_t runningIndex, xplat::TimeStamp timestamp);
+
+	/// \brief Returns the packet at the front of the queue without removing
+	/// it. May only be called by the consumer.
+	///
+	/// \param[out] length The number of bytes in the packet.
+	/// \param[out] runningIndex The running index of the start of the packet.
+	/// \param[out] timestamp The time the packet was received.
+	/// \return Pointer to the packet's data, which remains valid until
+	///     <c>pop</c> is called, or NULL if the queue is empty.
+	char* front(size_t &length, size_t &runningIndex, xplat::TimeStamp &timestamp);
+
+	/// \brief Removes the packet at the front of the queue. May only be called
+	/// by the consumer after <c>front</c> returned a packet.
+	void pop();
+
+	/// \brief Returns the number of packets waiting in the queue.
+	///
+	/// \return The depth of the queue.
+	size_t depth() const;
+
+	/// \brief Returns the largest number of packets which were ever waiting
+	/// in the queue at once.
+	///
+	/// \return The maximum depth of the queue.
+	size_t maximumDepth() const;
+
+	/// \brief Returns the number of packets which were queued.
+	///
+	/// \return The number of packets queued.
+	size_t numOfPacketsQueued() const;
+
+	/// \brief Returns the number of packets which were dropped.
+	///
+	/// \return The number of packets dropped.
+	size_t numOfPacketsDropped() const;
+
+	// Private Members ////////////////////////////////////////////////////////
+
+private:
+
+	// Contains internal data, mainly stuff that is required for cross-platform
+	// support.
+	struct Impl;
+	Impl *_pi;
+
+};
+
+}
+}
+}
+
+#endif
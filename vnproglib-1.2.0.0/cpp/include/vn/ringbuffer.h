@@ -0,0 +1,83 @@
+/// \file
+/// {COMMON_HEADER}
+///
+/// \section DESCRIPTION
+/// This header file provides the class RingBuffer.
+#ifndef _VNXPLAT_RINGBUFFER_H_
+#define _VNXPLAT_RINGBUFFER_H_
+
+#include <cstddef>
+
+#include "int.h"
+#include "nocopy.h"
+#include "export.h"
+
+namespace vn {
+namespace xplat {
+
+/// \brief Represents a cross-platform ring buffer whose contents can always
+/// be accessed contiguously.
+///
+/// Where supported, the same physical memory is mapped twice back to back
+/// in virtual memory, so a run of bytes that wraps past the end of the ring
+/// continues seamlessly into the second mapping. On other systems, the buffer
+/// falls back to keeping a mirrored copy of the data in ordinary memory.
+///
+/// Bytes are addressed by a running position which may grow without bound.
+/// The byte at a given position is stored at that position modulo the
+/// capacity, so unsigned overflow of the position is handled naturally.
+class vn_proglib_DLLEXPORT RingBuffer : private util::NoCopy
+{
+
+	// Constructors ///////////////////////////////////////////////////////////
+
+public:
+
+	/// \brief Creates a new ring buffer.
+	///
+	/// \param[in] minimumCapacity The minimum number of bytes the ring buffer
+	///     must hold. The actual capacity is rounded up to a power of two and
+	///     to the system's page size.
+	explicit RingBuffer(size_t minimumCapacity);
+
+	~RingBuffer();
+
+	// Public Methods /////////////////////////////////////////////////////////
+
+public:
+
+	/// \brief Returns the number of bytes the ring buffer holds.
+	///
+	/// \return The capacity of the ring buffer.
+	size_t capacity() const;
+
+	/// \brief Returns a pointer to the byte at the provided position. Up to
+	/// <c>capacity()</c> bytes may be accessed contiguously from it.
+	///
+	/// \param[in] position The running position of the byte.
+	/// \return Pointer to the byte.
+	uint8_t* at(size_t position);
+
+	/// \brief Writes data into the ring buffer.
+	///
+	/// \param[in] position The running position to store the first byte at.
+	/// \param[in] data The data to write.
+	/// \param[in] length The number of bytes to write. Must not be larger than
+	///     <c>capacity()</c>.
+	void write(size_t position, const uint8_t* data, size_t length);
+
+	// Private Members ////////////////////////////////////////////////////////
+
+private:
+
+	// Contains internal data, mainly stuff that is required for cross-platform
+	// support.
+	struct Impl;
+	Impl *_pi;
+
+};
+
+}
+}
+
+#endif
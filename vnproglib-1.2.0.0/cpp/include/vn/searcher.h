@@ -10,6 +10,19 @@
 namespace vn {
 namespace sensors {
 
+/// \brief A sensor found by Searcher::discover.
+struct DiscoveredSensor
+{
+	std::string portName;	///< The serial port the sensor is connected to.
+	uint32_t baudrate;		///< The baudrate the sensor is communicating at.
+	uint32_t serialNumber;	///< The serial number of the sensor, or 0 if it did not answer.
+
+	DiscoveredSensor() :
+		baudrate(0),
+		serialNumber(0)
+	{ }
+};
+
 /// \brief Helpful class for finding VectorNav sensors.
 class vn_proglib_DLLEXPORT Searcher
 {
@@ -34,6 +47,24 @@ public:
 	/// \returns <c>true</c> if a sensor if found; otherwise <c>false</c>.
 	static bool search(const std::string &portName, int32_t *foundBaudrate);
 
+	/// \brief Detects the baudrate a VectorNav sensor on the serial port is
+	///     communicating at.
+	///
+	/// The port is first listened to, starting with the expected baudrate,
+	/// and a baudrate is accepted once asynchronous output received at it
+	/// passes its checksum or CRC. Only when nothing at all is received,
+	/// meaning the sensor is not outputting anything, is each baudrate
+	/// probed with a read of the Model Number register instead.
+	///
+	/// \param[in] portName The serial port to search.
+	/// \param[out] foundBaudrate If a sensor is found, this will be set to the
+	///     baudrate the sensor is communicating at.
+	/// \param[in] expectedBaudrate The baudrate to try first, normally the
+	///     one the sensor was last used at, or 0 to only try the baudrates in
+	///     order of likeliness.
+	/// \returns <c>true</c> if a sensor is found; otherwise <c>false</c>.
+	static bool detectBaudrate(const std::string &portName, uint32_t *foundBaudrate, uint32_t expectedBaudrate = 0);
+
 	/// \brief Checks all available serial ports on the system for any
 	///     VectorNav sensors.
 	///
@@ -47,6 +78,25 @@ public:
 	/// \return Collection of serial ports and baudrates for all found sensors.
 	static std::vector<std::pair<std::string, uint32_t> > search(std::vector<std::string>& portsToCheck);
 
+	/// \brief Searches the provided serial ports for VectorNav sensors all at
+	///     once and reads the serial number of each sensor found.
+	///
+	/// Each port is searched as in \ref detectBaudrate. The search of a port
+	/// ends as soon as its sensor is identified, and the searches of all
+	/// remaining ports are cancelled once the expected number of sensors has
+	/// been found.
+	///
+	/// \param[in] portsToCheck List of serial ports to check for sensors.
+	/// \param[in] expectedNumOfSensors The number of sensors after which to
+	///     stop searching, or 0 to search every port to the end.
+	/// \param[in] cacheFile File recording the port, baudrate and serial
+	///     number of the sensors found, so the next discovery tries the
+	///     baudrate each port had last time first. An empty string disables
+	///     the cache.
+	/// \return The sensors found, in the order of their ports in
+	///     portsToCheck.
+	static std::vector<DiscoveredSensor> discover(const std::vector<std::string> &portsToCheck, size_t expectedNumOfSensors = 0, const std::string &cacheFile = std::string());
+
 	/// \brief Tests if a sensor is connected to the serial port at the
 	///     specified baudrate.
 	///
@@ -57,6 +57,119 @@ private:
 	char *_errorMessage;
 };
 
+class VnSensor;
+
+/// \brief Tracks a command sent with VnSensor::beginTransaction until the
+/// sensor answers it.
+///
+/// Any number of transactions may be in flight at once, started from any
+/// number of threads. Responses are matched to their command by the command
+/// name and, for register reads and writes, the register ID. Error responses
+/// carry neither, so they complete the oldest command still in flight since
+/// the sensor answers commands in the order it receives them.
+class vn_proglib_DLLEXPORT PendingTransaction : private util::NoCopy
+{
+
+public:
+
+	/// \brief Defines the signature for a method that is notified when a
+	/// transaction completes.
+	///
+	/// The method is called on the thread which completed the transaction,
+	/// normally the port's thread when the response arrives. The transaction
+	/// is reported as completed once the method returns, so the method must
+	/// not wait for it or destroy it.
+	///
+	/// \param[in] userData Pointer to user data that was initially supplied
+	///     to VnSensor::beginTransaction.
+	/// \param[in] transaction The completed transaction.
+	typedef void(*CompletedHandler)(void* userData, PendingTransaction& transaction);
+
+	PendingTransaction();
+
+	/// \brief Destroys the transaction. A command still in flight is
+	/// abandoned and its response is ignored.
+	~PendingTransaction();
+
+	/// \brief Indicates if the transaction has completed, either with a
+	/// response from the sensor or with a failure.
+	///
+	/// \return <c>true</c> if the transaction has completed; otherwise
+	///     <c>false</c>.
+	bool isCompleted();
+
+	/// \brief Waits for the transaction to complete.
+	///
+	/// \return The response from the sensor. It remains valid until the
+	///     transaction is destroyed or started again.
+	/// \exception timeout Thrown if no response arrived within the response
+	///     timeout.
+	/// \exception sensor_error Thrown if the sensor answered with an error.
+	/// \exception invalid_operation Thrown if the transaction was never
+	///     started or the sensor was disconnected before it answered.
+	protocol::uart::Packet& wait();
+
+	/// \brief Returns the number of times the command has been
+	/// retransmitted.
+	///
+	/// \return The number of retransmits.
+	uint32_t retransmits();
+
+private:
+	friend class VnSensor;
+	struct Impl;
+	Impl *_pi;
+};
+
+/// \brief The identifying registers of a sensor. The model number and
+/// hardware revision never change for a given sensor, which allows them to be
+/// cached by VnSensor::readIdentity.
+struct SensorIdentity
+{
+	std::string modelNumber;		///< The Model Number register.
+	std::string firmwareVersion;	///< The Firmware Version register.
+	uint32_t hardwareRevision;		///< The Hardware Revision register.
+	uint32_t serialNumber;			///< The Serial Number register.
+
+	SensorIdentity() :
+		hardwareRevision(0),
+		serialNumber(0)
+	{ }
+};
+
+/// \brief The output registers configured by
+/// VnSensor::applyOutputConfiguration.
+struct OutputConfiguration
+{
+	protocol::uart::AsciiAsync asyncDataOutputType;	///< The Async Data Output Type register.
+	BinaryOutputRegister binaryOutput1;				///< The Binary Output 1 register.
+	BinaryOutputRegister binaryOutput2;				///< The Binary Output 2 register.
+	BinaryOutputRegister binaryOutput3;				///< The Binary Output 3 register.
+
+	OutputConfiguration() :
+		asyncDataOutputType(protocol::uart::VNOFF)
+	{ }
+};
+
+/// \brief Statistics of the packet pipeline enabled by
+/// VnSensor::enablePipeline, totalled over all of its workers.
+struct PipelineStatistics
+{
+	size_t numOfPacketsQueued;	///< Packets handed from the serial port's thread to the workers.
+	size_t numOfPacketsDropped;	///< Packets dropped because the queue of their worker was full.
+	size_t numOfHandlerExceptions;	///< Packets whose handler threw an exception on a worker.
+	size_t depth;				///< Packets currently waiting to be dispatched.
+	size_t maximumDepth;		///< The most packets ever waiting in a single worker's queue.
+
+	PipelineStatistics() :
+		numOfPacketsQueued(0),
+		numOfPacketsDropped(0),
+		numOfHandlerExceptions(0),
+		depth(0),
+		maximumDepth(0)
+	{ }
+};
+
 /// \brief Helpful class for working with VectorNav sensors.
 class vn_proglib_DLLEXPORT VnSensor : private util::NoCopy
 {
@@ -80,7 +193,7 @@ public:
 	};
 
 	#if PYTHON
-	typedef Event<protocol::uart::Packet&, size_t, xplat::TimeStamp> AsyncPacketReceivedEvent;
+	typedef Event<protocol::uart::PacketView&, size_t, xplat::TimeStamp> AsyncPacketReceivedEvent;
 	#endif
 
 	/// \brief Defines a callback handler that can received notification when
@@ -101,21 +214,23 @@ public:
 	/// \param[in] possiblePacket The possible packet that was found.
 	/// \param[in] packetStartRunningIndex The running index of the start of
 	///     the packet.
-	typedef void(*PossiblePacketFoundHandler)(void* userData, protocol::uart::Packet& possiblePacket, size_t packetStartRunningIndex);
+	typedef void(*PossiblePacketFoundHandler)(void* userData, protocol::uart::PacketView& possiblePacket, size_t packetStartRunningIndex);
 
 	/// \brief Defines the signature for a method that can receive
 	/// notifications of when a new asynchronous data packet (ASCII or BINARY)
 	/// is received.
 	///
 	/// This packet will have already had and pertinent error checking
-	/// performed and determined to be an asynchronous packet.
+	/// performed and determined to be an asynchronous packet. It refers
+	/// directly to the received data and is only valid for the duration of
+	/// the callback. Copy it into a new Packet to keep it.
 	///
 	/// \param[in] userData Pointer to user data that was initially supplied
 	///     when the callback was registered via registerAsyncPacketReceivedHandler.
 	/// \param[in] asyncPacket The asynchronous packet received.
 	/// \param[in] packetStartRunningIndex The running index of the start of
 	///     the packet.
-	typedef void(*AsyncPacketReceivedHandler)(void* userData, protocol::uart::Packet& asyncPacket, size_t packetStartRunningIndex);
+	typedef void(*AsyncPacketReceivedHandler)(void* userData, protocol::uart::PacketView& asyncPacket, size_t packetStartRunningIndex);
 
 	/// \brief Defines the signature for a method that can receive
 	/// notifications when an error message is received.
@@ -128,7 +243,7 @@ public:
 	/// \param[in] errorPacket The error packet received.
 	/// \param[in] packetStartRunningIndex The running index of the start of
 	///     the packet.
-	typedef void(*ErrorPacketReceivedHandler)(void* userData, protocol::uart::Packet& errorPacket, size_t packetStartRunningIndex);
+	typedef void(*ErrorPacketReceivedHandler)(void* userData, protocol::uart::PacketView& errorPacket, size_t packetStartRunningIndex);
 
 	/// \brief The list of baudrates supported by VectorNav sensors.
 	static std::vector<uint32_t> supportedBaudrates();
@@ -184,6 +299,22 @@ public:
 	/// \param[in] timeout The number of milliseconds for response timeouts.
 	void setResponseTimeoutMs(uint16_t timeout);
 
+	/// \brief Indicates if binary packets which do not match the binary
+	/// outputs written since connecting are discarded.
+	///
+	/// \return <c>true</c> if unexpected binary packets are discarded;
+	/// otherwise <c>false</c>.
+	bool rejectUnexpectedBinaryOutputs();
+
+	/// \brief Sets if binary packets which do not match the binary outputs
+	/// written since connecting are discarded. When enabled, write every
+	/// binary output the sensor has enabled, since packets from outputs left
+	/// alone are no longer reported. Defaults to <c>false</c>.
+	///
+	/// \param[in] reject <c>true</c> to only report binary packets matching
+	///     the written binary outputs.
+	void setRejectUnexpectedBinaryOutputs(bool reject);
+
 	/// \brief The delay in milliseconds between retransmitting commands.
 	///
 	/// \return The retransmit delay in milliseconds.
@@ -237,6 +368,28 @@ public:
 	/// \return The response received from the sensor.
 	std::string transaction(std::string toSend);
 
+	/// \brief Sends a command to the sensor without waiting for the response,
+	/// so several commands can be in flight at once.
+	///
+	/// The command is retransmitted and timed out on its own schedule using
+	/// the current responseTimeoutMs and retransmitDelayMs settings. Use the
+	/// transaction to wait for the response, or provide a handler to be
+	/// notified when it completes.
+	///
+	/// \param[in] transaction Tracks the command until it completes. It may be
+	///     started again once it has completed.
+	/// \param[in] toSend The complete command to send, including its checksum
+	///     and line ending, such as the commands generated by the
+	///     protocol::uart::Packet::gen* methods.
+	/// \param[in] length The number of bytes in toSend.
+	/// \param[in] handler Optional method to notify when the transaction
+	///     completes.
+	/// \param[in] userData Pointer to user data which will be provided to the
+	///     handler.
+	/// \exception invalid_operation Thrown if the VnSensor is not connected
+	///     or the transaction is still in flight.
+	void beginTransaction(PendingTransaction& transaction, const char* toSend, size_t length, PendingTransaction::CompletedHandler handler = NULL, void* userData = NULL);
+
 	/// \brief Writes a raw data string to the sensor, normally appending an
 	/// appropriate error detection checksum.
 	///
@@ -355,6 +508,34 @@ public:
 	/// \return The determined device family.
 	static Family determineDeviceFamily(std::string modelNumber);
 
+	/// \brief Reads the identifying registers of the sensor.
+	///
+	/// The registers are requested together rather than one after the
+	/// other. When a cache directory is provided, only the serial number and
+	/// firmware version are read from a sensor seen before; its model number
+	/// and hardware revision are loaded from a file in the directory named
+	/// after the serial number, which is written the first time the sensor is
+	/// seen.
+	///
+	/// \param[in] cacheDirectory The directory holding the cached registers,
+	///     or an empty string to always read every register.
+	/// \return The identity of the sensor.
+	SensorIdentity readIdentity(const std::string &cacheDirectory = std::string());
+
+	/// \brief Brings the output registers of the sensor to the provided
+	/// configuration.
+	///
+	/// The current registers are read back together and only the ones which
+	/// differ are written. Binary outputs which are turned off on both sides
+	/// are considered equal regardless of their remaining fields.
+	///
+	/// \param[in] configuration The desired output configuration.
+	/// \param[in] persist Indicates if a Write Settings command should be
+	///     issued when any register was written, so the sensor starts with
+	///     the configuration and later calls have nothing left to write.
+	/// \return The number of registers written.
+	size_t applyOutputConfiguration(const OutputConfiguration &configuration, bool persist = false);
+
 	/// \defgroup vnSensorEvents VnSensor Events
 	/// \brief This group of methods allow registering/unregistering for events
 	/// of the VnSensor.
@@ -428,6 +609,49 @@ public:
 	/// \brief Unregisters the registered callback method.
 	void unregisterErrorPacketReceivedHandler();
 
+	/// \brief Moves the checking and dispatch of asynchronous packets off the
+	/// serial port's thread.
+	///
+	/// The serial port's thread then only frames packets. Asynchronous
+	/// packets are copied into a lock-free queue for a worker thread and the
+	/// serial port's thread goes straight back to reading, so a slow
+	/// AsyncPacketReceivedHandler no longer delays reads from the port.
+	/// Responses and error packets are still handled on the serial port's
+	/// thread.
+	///
+	/// Each worker has its own queue. Packets of the same type always go to
+	/// the same worker, so they are dispatched in the order they were
+	/// received, but packets of different types may be dispatched
+	/// concurrently when there is more than one worker. When a worker falls
+	/// so far behind that its queue is full, further packets for it are
+	/// dropped and counted in pipelineStatistics. Exceptions thrown by the
+	/// handler on a worker are caught and counted there as well.
+	///
+	/// \param[in] queueCapacity The minimum number of packets each worker's
+	///     queue holds. It is rounded up to a power of two.
+	/// \param[in] numOfWorkers The number of worker threads.
+	/// \exception invalid_operation Thrown if the pipeline is already enabled.
+	void enablePipeline(size_t queueCapacity = 256, size_t numOfWorkers = 1);
+
+	/// \brief Returns the dispatch of asynchronous packets to the serial
+	/// port's thread. Packets still waiting in the queues are dispatched
+	/// before the workers stop.
+	///
+	/// \exception invalid_operation Thrown if the pipeline is not enabled.
+	void disablePipeline();
+
+	/// \brief Indicates if the packet pipeline is enabled.
+	///
+	/// \return <c>true</c> if the pipeline is enabled; otherwise <c>false</c>.
+	bool isPipelineEnabled();
+
+	/// \brief Returns the queue depth, drop and handler exception statistics
+	/// of the packet pipeline.
+	///
+	/// \return The statistics, which are all zero if the pipeline has not
+	///     been enabled.
+	PipelineStatistics pipelineStatistics();
+
 	/// \}
 
 	/// \defgroup registerAccessMethods Register Access Methods
@@ -443,6 +667,9 @@ public:
 
 	/// \brief Writes to the Binary Output 1 register.
 	///
+	/// See setRejectUnexpectedBinaryOutputs for only reporting binary packets
+	/// matching the written outputs.
+	///
 	/// \param[in] fields The register's fields.
 	/// \param[in] waitForReply Indicates if the method should wait for a response from the sensor.
 	void writeBinaryOutput1(BinaryOutputRegister &fields, bool waitForReply = true);
@@ -454,6 +681,9 @@ public:
 
 	/// \brief Writes to the Binary Output 2 register.
 	///
+	/// See setRejectUnexpectedBinaryOutputs for only reporting binary packets
+	/// matching the written outputs.
+	///
 	/// \param[in] fields The register's fields.
 	/// \param[in] waitForReply Indicates if the method should wait for a response from the sensor.
 	void writeBinaryOutput2(BinaryOutputRegister &fields, bool waitForReply = true);
@@ -465,6 +695,9 @@ public:
 
 	/// \brief Writes to the Binary Output 3 register.
 	///
+	/// See setRejectUnexpectedBinaryOutputs for only reporting binary packets
+	/// matching the written outputs.
+	///
 	/// \param[in] fields The register's fields.
 	/// \param[in] waitForReply Indicates if the method should wait for a response from the sensor.
 	void writeBinaryOutput3(BinaryOutputRegister &fields, bool waitForReply = true);
@@ -1546,6 +1779,7 @@ public:
 	#endif
 
 private:
+	friend class PendingTransaction;
 	struct Impl;
 	Impl *_pi;
 
@@ -2,6 +2,7 @@
 #define _VNPROTOCOL_UART_TYPES_H_
 
 #include "int.h"
+#include "compiler.h"
 
 namespace vn {
 namespace protocol {
@@ -658,45 +659,66 @@ struct GnssDop
 
 /// \brief Allows combining flags of the CommonGroup enum.
 ///
+/// The combining operators are constexpr where supported, so combined flags
+/// can be used as template arguments, for example for BinaryOutputDecoder.
+///
 /// \param[in] lhs Left-hand side enum value.
 /// \param[in] rhs Right-hand side enum value.
 /// \return The binary ORed value.
-CommonGroup operator|(CommonGroup lhs, CommonGroup rhs);
+inline VN_CONSTEXPR CommonGroup operator|(CommonGroup lhs, CommonGroup rhs)
+{
+	return CommonGroup(int(lhs) | int(rhs));
+}
 
 /// \brief Allows combining flags of the TimeGroup enum.
 ///
 /// \param[in] lhs Left-hand side enum value.
 /// \param[in] rhs Right-hand side enum value.
 /// \return The binary ORed value.
-TimeGroup operator|(TimeGroup lhs, TimeGroup rhs);
+inline VN_CONSTEXPR TimeGroup operator|(TimeGroup lhs, TimeGroup rhs)
+{
+	return TimeGroup(int(lhs) | int(rhs));
+}
 
 /// \brief Allows combining flags of the ImuGroup enum.
 ///
 /// \param[in] lhs Left-hand side enum value.
 /// \param[in] rhs Right-hand side enum value.
 /// \return The binary ORed value.
-ImuGroup operator|(ImuGroup lhs, ImuGroup rhs);
+inline VN_CONSTEXPR ImuGroup operator|(ImuGroup lhs, ImuGroup rhs)
+{
+	return ImuGroup(int(lhs) | int(rhs));
+}
 
 /// \brief Allows combining flags of the GpsGroup enum.
 ///
 /// \param[in] lhs Left-hand side enum value.
 /// \param[in] rhs Right-hand side enum value.
 /// \return The binary ORed value.
-GpsGroup operator|(GpsGroup lhs, GpsGroup rhs);
+inline VN_CONSTEXPR GpsGroup operator|(GpsGroup lhs, GpsGroup rhs)
+{
+	return GpsGroup(int(lhs) | int(rhs));
+}
 
 /// \brief Allows combining flags of the AttitudeGroup enum.
 ///
 /// \param[in] lhs Left-hand side enum value.
 /// \param[in] rhs Right-hand side enum value.
 /// \return The binary ORed value.
-AttitudeGroup operator|(AttitudeGroup lhs, AttitudeGroup rhs);
+inline VN_CONSTEXPR AttitudeGroup operator|(AttitudeGroup lhs, AttitudeGroup rhs)
+{
+	return AttitudeGroup(int(lhs) | int(rhs));
+}
 
 /// \brief Allows combining flags of the InsGroup enum.
 ///
 /// \param[in] lhs Left-hand side enum value.
 /// \param[in] rhs Right-hand side enum value.
 /// \return The binary ORed value.
-InsGroup operator|(InsGroup lhs, InsGroup rhs);
+inline VN_CONSTEXPR InsGroup operator|(InsGroup lhs, InsGroup rhs)
+{
+	return InsGroup(int(lhs) | int(rhs));
+}
 
 }
 }
@@ -0,0 +1,54 @@
+#include "allocations.test.h"
+
+#include <cstdlib>
+#include <new>
+
+#if (defined(_MSC_VER) && _MSC_VER >= 1700) || (__cplusplus >= 201103L)
+	#include <atomic>
+	static std::atomic<size_t> NumOfAllocations(0);
+#else
+	static volatile size_t NumOfAllocations = 0;
+#endif
+
+using namespace std;
+
+size_t numOfAllocations()
+{
+	return NumOfAllocations;
+}
+
+void* operator new(size_t size)
+{
+	NumOfAllocations++;
+
+	void* p = malloc(size == 0 ? 1 : size);
+	if (p == NULL)
+		throw bad_alloc();
+
+	return p;
+}
+
+void* operator new[](size_t size)
+{
+	return operator new(size);
+}
+
+void operator delete(void* p) throw()
+{
+	free(p);
+}
+
+void operator delete[](void* p) throw()
+{
+	free(p);
+}
+
+void operator delete(void* p, size_t) throw()
+{
+	free(p);
+}
+
+void operator delete[](void* p, size_t) throw()
+{
+	free(p);
+}
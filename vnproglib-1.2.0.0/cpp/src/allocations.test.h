@@ -0,0 +1,10 @@
+#ifndef _VN_ALLOCATIONS_TEST_H_
+#define _VN_ALLOCATIONS_TEST_H_
+
+#include <cstddef>
+
+// Returns the number of allocations the test program has made so far. Every
+// operator new is counted, on every thread.
+size_t numOfAllocations();
+
+#endif
@@ -0,0 +1,140 @@
+#include "gtest/gtest.h"
+
+#include "vn/compiler.h"
+
+#if VN_SUPPORTS_CONSTEXPR
+
+#include <cstring>
+
+#include "vn/binarydecoder.h"
+#include "vn/compositedata.h"
+
+using namespace vn::math;
+using namespace vn::protocol::uart;
+using namespace vn::sensors;
+
+namespace {
+
+// The layout the ROS node configures on binary output 1, with TimeStartup
+// included.
+typedef BinaryOutputDecoder<
+	COMMONGROUP_TIMESTARTUP | COMMONGROUP_YAWPITCHROLL | COMMONGROUP_QUATERNION | COMMONGROUP_ANGULARRATE |
+		COMMONGROUP_POSITION | COMMONGROUP_ACCEL | COMMONGROUP_MAGPRES,
+	TIMEGROUP_GPSTOW | TIMEGROUP_GPSWEEK | TIMEGROUP_TIMEUTC,
+	IMUGROUP_NONE,
+	GPSGROUP_NONE,
+	ATTITUDEGROUP_YPRU,
+	INSGROUP_INSSTATUS | INSGROUP_POSECEF | INSGROUP_VELBODY | INSGROUP_VELNED | INSGROUP_ACCELECEF |
+		INSGROUP_POSU | INSGROUP_VELU,
+	GPSGROUP_NONE> RosNodeDecoder;
+
+// A packet in that layout, including its CRC.
+const unsigned char RosNodePacket[] = {
+	0xFA, 0x33, 0x79, 0x05, 0x4C, 0x00, 0x00, 0x01, 0x9D, 0x06, 0x08, 0x1A, 0x99, 0xBE, 0x1C, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x35, 0xC2, 0x00, 0x00, 0x20, 0x40, 0x00, 0x00, 0xE0, 0xBF, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xEF, 0xC3, 0xBE, 0x66, 0x83, 0x6C, 0x3F, 0x0A, 0xD7,
+	0x23, 0x3C, 0x0A, 0xD7, 0xA3, 0xBC, 0x8F, 0xC2, 0xF5, 0x3C, 0xD0, 0xD5, 0x56, 0xEC, 0x2F, 0xE3,
+	0x42, 0x40, 0x50, 0xFC, 0x18, 0x73, 0xD7, 0x9A, 0x5E, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+	0x30, 0x40, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x80, 0xBE, 0x0A, 0xE8, 0x1C, 0xC1, 0xCD, 0xCC,
+	0x4C, 0x3E, 0xCD, 0xCC, 0x4C, 0x3D, 0x66, 0x66, 0xE6, 0x3E, 0x00, 0x00, 0xFC, 0x41, 0x66, 0xA6,
+	0xCA, 0x42, 0x00, 0x00, 0x3C, 0x45, 0x52, 0x3A, 0x01, 0x00, 0x52, 0x08, 0x14, 0x0A, 0x10, 0x0C,
+	0x22, 0x38, 0x15, 0x03, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x80, 0x3E, 0x9A, 0x99, 0x99, 0x3E,
+	0x06, 0x02, 0x00, 0x00, 0x00, 0x40, 0x7F, 0xA5, 0x44, 0xC1, 0x00, 0x00, 0x00, 0xD0, 0x30, 0x41,
+	0x50, 0xC1, 0x00, 0x00, 0x00, 0xE0, 0x4E, 0xA5, 0x4D, 0x41, 0x00, 0x00, 0x80, 0x3F, 0xCD, 0xCC,
+	0xCC, 0x3D, 0xCD, 0xCC, 0x4C, 0xBD, 0x33, 0x33, 0x33, 0x3F, 0x33, 0x33, 0x33, 0xBF, 0x0A, 0xD7,
+	0xA3, 0x3C, 0x9A, 0x99, 0x99, 0x3E, 0xCD, 0xCC, 0xCC, 0xBE, 0xC3, 0xF5, 0x1C, 0x41, 0x00, 0x00,
+	0x20, 0x40, 0x9A, 0x99, 0x19, 0x3E, 0x6E, 0xE6
+};
+
+}
+
+TEST(BinaryOutputDecoder, FieldLengthsMatchThePacketTables)
+{
+	for (size_t group = 0; group < 7; group++)
+	{
+		for (size_t bit = 0; bit < 15; bit++)
+			EXPECT_EQ(Packet::BinaryGroupLengths[group][bit], BinaryOutputFieldLengths[group][bit]);
+
+		EXPECT_EQ(0, BinaryOutputFieldLengths[group][15]);
+	}
+}
+
+TEST(BinaryOutputDecoder, DecodesAPacket)
+{
+	Packet packet(reinterpret_cast<const char*>(RosNodePacket), sizeof(RosNodePacket));
+	ASSERT_TRUE(packet.isValid());
+	ASSERT_EQ(sizeof(RosNodePacket), RosNodeDecoder::packetLength());
+
+	BinaryOutputData d;
+	ASSERT_TRUE(RosNodeDecoder::decode(packet, d));
+
+	EXPECT_EQ(123456789000u, d.timeStartup);
+	EXPECT_FLOAT_EQ(-45.25f, d.yawPitchRoll.x);
+	EXPECT_FLOAT_EQ(2.5f, d.yawPitchRoll.y);
+	EXPECT_FLOAT_EQ(-1.75f, d.yawPitchRoll.z);
+	EXPECT_FLOAT_EQ(0.92388f, d.quaternion.w);
+	EXPECT_FLOAT_EQ(0.03f, d.angularRate.z);
+	EXPECT_DOUBLE_EQ(37.7749, d.positionEstimatedLla.x);
+	EXPECT_DOUBLE_EQ(-122.4194, d.positionEstimatedLla.y);
+	EXPECT_FLOAT_EQ(-9.80665f, d.acceleration.z);
+	EXPECT_FLOAT_EQ(0.45f, d.magnetic.z);
+	EXPECT_FLOAT_EQ(31.5f, d.temperature);
+	EXPECT_FLOAT_EQ(101.325f, d.pressure);
+
+	EXPECT_EQ(345600000000000u, d.tow);
+	EXPECT_EQ(2130, d.week);
+	EXPECT_EQ(20, d.timeUtc.year);
+	EXPECT_EQ(10, d.timeUtc.month);
+	EXPECT_EQ(56, d.timeUtc.sec);
+	EXPECT_EQ(789, d.timeUtc.ms);
+
+	EXPECT_FLOAT_EQ(1.5f, d.attitudeUncertainty.x);
+
+	EXPECT_EQ(0x0206, d.insStatus);
+	EXPECT_DOUBLE_EQ(-2706174.5, d.positionEstimatedEcef.x);
+	EXPECT_DOUBLE_EQ(3885725.75, d.positionEstimatedEcef.z);
+	EXPECT_FLOAT_EQ(1.0f, d.velocityEstimatedBody.x);
+	EXPECT_FLOAT_EQ(-0.7f, d.velocityEstimatedNed.y);
+	EXPECT_FLOAT_EQ(9.81f, d.accelerationEcef.z);
+	EXPECT_FLOAT_EQ(2.5f, d.positionUncertaintyEstimated);
+	EXPECT_FLOAT_EQ(0.15f, d.velocityUncertaintyEstimated);
+}
+
+TEST(BinaryOutputDecoder, AgreesWithCompositeData)
+{
+	Packet packet(reinterpret_cast<const char*>(RosNodePacket), sizeof(RosNodePacket));
+
+	BinaryOutputData d;
+	ASSERT_TRUE(RosNodeDecoder::decode(packet, d));
+
+	CompositeData cd = CompositeData::parse(packet);
+
+	EXPECT_EQ(cd.timeStartup(), d.timeStartup);
+	EXPECT_EQ(cd.yawPitchRoll().y, d.yawPitchRoll.y);
+	EXPECT_EQ(cd.quaternion().z, d.quaternion.z);
+	EXPECT_EQ(cd.positionEstimatedLla().y, d.positionEstimatedLla.y);
+	EXPECT_EQ(cd.temperature(), d.temperature);
+	EXPECT_EQ(cd.week(), d.week);
+	EXPECT_EQ(cd.timeUtc().min, d.timeUtc.min);
+	EXPECT_EQ(cd.attitudeUncertainty().z, d.attitudeUncertainty.z);
+	EXPECT_EQ(cd.insStatus(), d.insStatus);
+	EXPECT_EQ(cd.positionEstimatedEcef().y, d.positionEstimatedEcef.y);
+	EXPECT_EQ(cd.velocityEstimatedBody().z, d.velocityEstimatedBody.z);
+	EXPECT_EQ(cd.accelerationEcef().x, d.accelerationEcef.x);
+	EXPECT_EQ(cd.velocityUncertaintyEstimated(), d.velocityUncertaintyEstimated);
+}
+
+TEST(BinaryOutputDecoder, RejectsAPacketWithAnotherLayout)
+{
+	unsigned char data[sizeof(RosNodePacket)];
+	memcpy(data, RosNodePacket, sizeof(data));
+
+	// Selects the INS Group's PosLla field instead of PosEcef.
+	data[8] = 0x9B;
+
+	BinaryOutputData d;
+	EXPECT_FALSE(RosNodeDecoder::decode(reinterpret_cast<const char*>(data), sizeof(data), d));
+	EXPECT_FALSE(RosNodeDecoder::decode(reinterpret_cast<const char*>(RosNodePacket), sizeof(RosNodePacket) - 1, d));
+}
+
+#endif
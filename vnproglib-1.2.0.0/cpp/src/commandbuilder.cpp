@@ -0,0 +1,424 @@
+#include "vn/commandbuilder.h"
+
+#include <cmath>
+#include <cstring>
+
+using namespace std;
+
+namespace vn {
+namespace protocol {
+namespace uart {
+
+namespace {
+
+// Enough 32-bit words for the largest integer needed to print a double
+// exactly, which is the 53-bit mantissa of the smallest subnormal multiplied
+// by 5^1074.
+const size_t MaxIntegerWords = 84;
+
+// Enough characters for every decimal digit of a double, plus the six zeros
+// and the carry which rounding may add.
+const size_t MaxDecimalDigits = 800;
+
+const char HexDigits[] = "0123456789ABCDEF";
+
+// Splits a double into its sign bit and its raw exponent and mantissa bits.
+void decomposeDouble(double value, bool &negative, uint32_t &biasedExponent, uint64_t &mantissa)
+{
+	uint64_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+
+	negative = (bits >> 63) != 0;
+	biasedExponent = static_cast<uint32_t>((bits >> 52) & 0x7FF);
+	mantissa = bits & ((static_cast<uint64_t>(1) << 52) - 1);
+}
+
+void multiplyInteger(uint32_t *words, size_t &count, uint32_t factor)
+{
+	uint64_t carry = 0;
+
+	for (size_t i = 0; i < count; i++)
+	{
+		carry += static_cast<uint64_t>(words[i]) * factor;
+		words[i] = static_cast<uint32_t>(carry);
+		carry >>= 32;
+	}
+
+	if (carry != 0)
+		words[count++] = static_cast<uint32_t>(carry);
+}
+
+void shiftIntegerLeft(uint32_t *words, size_t &count, size_t shift)
+{
+	size_t wordShift = shift / 32;
+	size_t bitShift = shift % 32;
+
+	if (bitShift != 0)
+	{
+		uint32_t carry = 0;
+
+		for (size_t i = 0; i < count; i++)
+		{
+			uint32_t word = words[i];
+			words[i] = (word << bitShift) | carry;
+			carry = word >> (32 - bitShift);
+		}
+
+		if (carry != 0)
+			words[count++] = carry;
+	}
+
+	if (wordShift != 0)
+	{
+		memmove(words + wordShift, words, count * sizeof(uint32_t));
+		memset(words, 0, wordShift * sizeof(uint32_t));
+		count += wordShift;
+	}
+}
+
+// Divides the integer in place and returns the remainder.
+uint32_t divideInteger(uint32_t *words, size_t &count, uint32_t divisor)
+{
+	uint64_t remainder = 0;
+
+	for (size_t i = count; i-- > 0; )
+	{
+		remainder = (remainder << 32) | words[i];
+		words[i] = static_cast<uint32_t>(remainder / divisor);
+		remainder %= divisor;
+	}
+
+	while (count > 0 && words[count - 1] == 0)
+		count--;
+
+	return static_cast<uint32_t>(remainder);
+}
+
+// Writes the exact decimal digits of a finite, positive value without
+// leading zeros. Every double is a finite decimal fraction, so no precision
+// is lost. Returns the number of digits written and sets decimalPoint to the
+// number of digits in front of the decimal point, which may be zero or
+// negative when the value is smaller than one.
+size_t exactDecimalDigits(uint32_t biasedExponent, uint64_t mantissa, char *digits, int &decimalPoint)
+{
+	// The value is mantissa * 2^exponent.
+	int exponent;
+
+	if (biasedExponent == 0)
+	{
+		exponent = -1074;
+	}
+	else
+	{
+		mantissa |= static_cast<uint64_t>(1) << 52;
+		exponent = static_cast<int>(biasedExponent) - 1075;
+	}
+
+	while ((mantissa & 1) == 0)
+	{
+		mantissa >>= 1;
+		exponent++;
+	}
+
+	uint32_t words[MaxIntegerWords];
+	size_t count = 0;
+
+	words[count++] = static_cast<uint32_t>(mantissa);
+	if ((mantissa >> 32) != 0)
+		words[count++] = static_cast<uint32_t>(mantissa >> 32);
+
+	if (exponent > 0)
+	{
+		shiftIntegerLeft(words, count, exponent);
+	}
+	else
+	{
+		// mantissa * 2^exponent is the integer mantissa * 5^-exponent scaled
+		// down by 10^-exponent.
+		int remaining = -exponent;
+
+		for (; remaining >= 13; remaining -= 13)
+			multiplyInteger(words, count, 1220703125);		// 5^13
+
+		uint32_t factor = 1;
+		for (; remaining > 0; remaining--)
+			factor *= 5;
+
+		multiplyInteger(words, count, factor);
+	}
+
+	// Peel off nine digits at a time, least significant first.
+	uint32_t chunks[MaxDecimalDigits / 9 + 1];
+	size_t chunkCount = 0;
+
+	while (count > 0)
+		chunks[chunkCount++] = divideInteger(words, count, 1000000000);
+
+	size_t length = 0;
+
+	for (uint32_t chunk = chunks[--chunkCount]; chunk != 0; chunk /= 10)
+		digits[length++] = static_cast<char>('0' + chunk % 10);
+
+	for (size_t i = 0, j = length - 1; i < j; i++, j--)
+	{
+		char digit = digits[i];
+		digits[i] = digits[j];
+		digits[j] = digit;
+	}
+
+	while (chunkCount > 0)
+	{
+		uint32_t chunk = chunks[--chunkCount];
+
+		for (size_t i = 9; i-- > 0; chunk /= 10)
+			digits[length + i] = static_cast<char>('0' + chunk % 10);
+
+		length += 9;
+	}
+
+	decimalPoint = static_cast<int>(length) + (exponent < 0 ? exponent : 0);
+
+	return length;
+}
+
+// Shortens the digits to the first keep digits, rounding half to even like
+// printf does. Digits past count are taken as zeros, and a keep of zero or
+// less leaves no digits. Returns true if the rounding carried out of the first
+// kept digit, in which case the kept digits are all zeros and a one belongs in
+// front of them.
+bool roundDigits(char *digits, size_t count, int keep)
+{
+	if (keep < 0)
+		return false;
+
+	size_t kept = static_cast<size_t>(keep);
+
+	if (kept >= count)
+	{
+		for (size_t i = count; i < kept; i++)
+			digits[i] = '0';
+
+		return false;
+	}
+
+	bool roundUp;
+
+	if (digits[kept] != '5')
+	{
+		roundUp = digits[kept] > '5';
+	}
+	else
+	{
+		roundUp = kept > 0 && ((digits[kept - 1] - '0') & 1) != 0;
+
+		for (size_t i = kept + 1; i < count && !roundUp; i++)
+			roundUp = digits[i] != '0';
+	}
+
+	if (!roundUp)
+		return false;
+
+	for (size_t i = kept; i-- > 0; )
+	{
+		if (digits[i] != '9')
+		{
+			digits[i]++;
+			return false;
+		}
+
+		digits[i] = '0';
+	}
+
+	return true;
+}
+
+}
+
+CommandBuilder::CommandBuilder(char *buffer, size_t size) :
+	_buffer(buffer),
+	_size(size),
+	_length(0)
+{
+	if (_size > 0)
+		_buffer[0] = '\0';
+}
+
+CommandBuilder& CommandBuilder::appendCharacters(const char *text, size_t length)
+{
+	if (_length + 1 >= _size)
+		return *this;
+
+	size_t available = _size - _length - 1;
+
+	if (length > available)
+		length = available;
+
+	memcpy(_buffer + _length, text, length);
+	_length += length;
+	_buffer[_length] = '\0';
+
+	return *this;
+}
+
+CommandBuilder& CommandBuilder::append(char character)
+{
+	return appendCharacters(&character, 1);
+}
+
+CommandBuilder& CommandBuilder::appendString(const char *text)
+{
+	return appendCharacters(text, strlen(text));
+}
+
+CommandBuilder& CommandBuilder::appendUnsigned(uint32_t value)
+{
+	char digits[10];
+	size_t start = sizeof(digits);
+
+	do
+	{
+		digits[--start] = static_cast<char>('0' + value % 10);
+		value /= 10;
+	} while (value != 0);
+
+	return appendCharacters(digits + start, sizeof(digits) - start);
+}
+
+CommandBuilder& CommandBuilder::appendSigned(int32_t value)
+{
+	if (value >= 0)
+		return appendUnsigned(static_cast<uint32_t>(value));
+
+	append('-');
+
+	return appendUnsigned(0u - static_cast<uint32_t>(value));
+}
+
+CommandBuilder& CommandBuilder::appendHex(uint32_t value, size_t width)
+{
+	char digits[8];
+	size_t start = sizeof(digits);
+
+	do
+	{
+		digits[--start] = HexDigits[value & 0xF];
+		value >>= 4;
+	} while (value != 0);
+
+	if (width > sizeof(digits))
+		width = sizeof(digits);
+
+	while (sizeof(digits) - start < width)
+		digits[--start] = '0';
+
+	return appendCharacters(digits + start, sizeof(digits) - start);
+}
+
+CommandBuilder& CommandBuilder::appendFixed(double value)
+{
+	bool negative;
+	uint32_t biasedExponent;
+	uint64_t mantissa;
+
+	decomposeDouble(value, negative, biasedExponent, mantissa);
+
+	if (negative)
+		append('-');
+
+	if (biasedExponent == 0x7FF)
+		return mantissa == 0 ? append("inf") : append("nan");
+
+	// One spare character in front of the digits takes the carry of rounding.
+	char buffer[MaxDecimalDigits + 1];
+	char *digits = buffer + 1;
+	size_t count = 0;
+	int decimalPoint = 0;
+
+	if (biasedExponent != 0 || mantissa != 0)
+		count = exactDecimalDigits(biasedExponent, mantissa, digits, decimalPoint);
+
+	// The kept digits are the value multiplied by 10^6.
+	int keep = decimalPoint + 6;
+	size_t length = keep > 0 ? static_cast<size_t>(keep) : 0;
+
+	if (roundDigits(digits, count, keep))
+	{
+		*--digits = '1';
+		length++;
+	}
+
+	if (length <= 6)
+	{
+		append("0.");
+
+		for (size_t i = length; i < 6; i++)
+			append('0');
+
+		return appendCharacters(digits, length);
+	}
+
+	appendCharacters(digits, length - 6);
+	append('.');
+
+	return appendCharacters(digits + length - 6, 6);
+}
+
+CommandBuilder& CommandBuilder::appendScientific(double value)
+{
+	bool negative;
+	uint32_t biasedExponent;
+	uint64_t mantissa;
+
+	decomposeDouble(value, negative, biasedExponent, mantissa);
+
+	if (negative)
+		append('-');
+
+	if (biasedExponent == 0x7FF)
+		return mantissa == 0 ? append("INF") : append("NAN");
+
+	char buffer[MaxDecimalDigits + 1];
+	char *digits = buffer + 1;
+	int exponent = 0;
+
+	if (biasedExponent != 0 || mantissa != 0)
+	{
+		int decimalPoint;
+		size_t count = exactDecimalDigits(biasedExponent, mantissa, digits, decimalPoint);
+
+		exponent = decimalPoint - 1;
+
+		if (roundDigits(digits, count, 7))
+		{
+			*--digits = '1';
+			exponent++;
+		}
+	}
+	else
+	{
+		memset(digits, '0', 7);
+	}
+
+	appendCharacters(digits, 1);
+	append('.');
+	appendCharacters(digits + 1, 6);
+
+	if (exponent < 0)
+	{
+		append("E-");
+		exponent = -exponent;
+	}
+	else
+	{
+		append("E+");
+	}
+
+	if (exponent < 10)
+		append('0');
+
+	return appendUnsigned(static_cast<uint32_t>(exponent));
+}
+
+}
+}
+}
@@ -1,6 +1,9 @@
 #include "vn/compositedata.h"
 #include "vn/conversions.h"
 
+#include <cstring>
+#include <new>
+
 using namespace std;
 using namespace vn::math;
 using namespace vn::protocol::uart;
@@ -8,7 +11,51 @@ using namespace vn::protocol::uart;
 namespace vn {
 namespace sensors {
 
-typedef vector<CompositeData*>::iterator cditer;
+typedef CompositeData* const* cditer;
+
+namespace {
+
+// Returns the number of fields in an ASCII asynchronous message of the type,
+// or zero if CompositeData does not parse the type.
+size_t asciiAsyncFieldCount(AsciiAsync type)
+{
+	switch (type)
+	{
+	case VNYPR: case VNMAG: case VNACC: case VNGYR:
+		return 3;
+	case VNQTN:
+		return 4;
+	case VNDTV:
+		return 7;
+	case VNMAR: case VNYBA: case VNYIA:
+		return 9;
+	case VNIMU:
+		return 11;
+	case VNYMR:
+		return 12;
+	case VNQMR:
+		return 13;
+	case VNGPS: case VNG2S: case VNGPE: case VNG2E:
+	case VNINS: case VNINE: case VNISL: case VNISE:
+		return 15;
+	#ifdef INTERNAL
+	case VNQTM: case VNQTA: case VNQTR: case VNSTV:
+		return 7;
+	case VNDCM:
+		return 9;
+	case VNQMA: case VNQAR: case VNCMV:
+		return 10;
+	case VNICM:
+		return 12;
+	case VNYCM:
+		return 13;
+	#endif
+	default:
+		return 0;
+	}
+}
+
+}
 
 struct CompositeData::Impl
 {
@@ -101,6 +148,85 @@ struct CompositeData::Impl
     CDVEU_Estimated
 	};
 
+	// Identifies each bit in hasFlags.
+	enum HasFlag
+	{
+		CDHAS_YawPitchRoll,
+		CDHAS_Quaternion,
+		CDHAS_DirectionCosineMatrix,
+		CDHAS_Magnetic,
+		CDHAS_MagneticUncompensated,
+		CDHAS_MagneticNed,
+		CDHAS_MagneticEcef,
+		CDHAS_Acceleration,
+		CDHAS_AccelerationLinearBody,
+		CDHAS_AccelerationUncompensated,
+		CDHAS_AccelerationLinearNed,
+		CDHAS_AccelerationLinearEcef,
+		CDHAS_AccelerationNed,
+		CDHAS_AccelerationEcef,
+		CDHAS_AngularRate,
+		CDHAS_AngularRateUncompensated,
+		CDHAS_Temperature,
+		CDHAS_Pressure,
+		CDHAS_PositionGpsLla,
+		CDHAS_PositionGps2Lla,
+		CDHAS_PositionGpsEcef,
+		CDHAS_PositionGps2Ecef,
+		CDHAS_PositionEstimatedLla,
+		CDHAS_PositionEstimatedEcef,
+		CDHAS_VelocityGpsNed,
+		CDHAS_VelocityGps2Ned,
+		CDHAS_VelocityGpsEcef,
+		CDHAS_VelocityGps2Ecef,
+		CDHAS_VelocityEstimatedNed,
+		CDHAS_VelocityEstimatedEcef,
+		CDHAS_VelocityEstimatedBody,
+		CDHAS_DeltaTime,
+		CDHAS_DeltaTheta,
+		CDHAS_DeltaVelocity,
+		CDHAS_TimeStartup,
+		CDHAS_TimeGps,
+		CDHAS_TimeGps2,
+		CDHAS_Tow,
+		CDHAS_Week,
+		CDHAS_GpsWeek,
+		CDHAS_Gps2Week,
+		CDHAS_NumSats,
+		CDHAS_NumSats2,
+		CDHAS_TimeSyncIn,
+		CDHAS_VpeStatus,
+		CDHAS_InsStatus,
+		CDHAS_SyncInCnt,
+		CDHAS_SyncOutCnt,
+		CDHAS_TimeStatus,
+		CDHAS_TimeGpsPps,
+		CDHAS_TimeGps2Pps,
+		CDHAS_GpsTow,
+		CDHAS_Gps2Tow,
+		CDHAS_TimeUtc,
+		CDHAS_TimeUtc2,
+		CDHAS_SensSat,
+		CDHAS_Fix,
+		CDHAS_Fix2,
+		CDHAS_PositionUncertaintyGpsNed,
+		CDHAS_PositionUncertaintyGps2Ned,
+		CDHAS_PositionUncertaintyGpsEcef,
+		CDHAS_PositionUncertaintyGps2Ecef,
+		CDHAS_PositionUncertaintyEstimated,
+		CDHAS_VelocityUncertaintyGps,
+		CDHAS_VelocityUncertaintyGps2,
+		CDHAS_VelocityUncertaintyEstimated,
+		CDHAS_TimeUncertainty,
+		CDHAS_TimeUncertainty2,
+		CDHAS_AttitudeUncertainty,
+		CDHAS_TimeInfo,
+		CDHAS_TimeInfo2,
+		CDHAS_Dop,
+		CDHAS_Dop2,
+		CDHAS_Count
+	};
+
 	AttitudeType mostRecentlyUpdatedAttitudeType;
 	MagneticType mostRecentlyUpdatedMagneticType;
 	AccelerationType mostRecentlyUpdatedAccelerationType;
@@ -111,19 +237,7 @@ struct CompositeData::Impl
 	VelocityType mostRecentlyUpdatedVelocityType;
 	PositionUncertaintyType mostRecentlyUpdatedPositionUncertaintyType;
 	VelocityUncertaintyType mostRecentlyUpdatedVelocityUncertaintyType;
-	bool hasYawPitchRoll, hasQuaternion, hasDirectionCosineMatrix,
-		hasMagnetic, hasMagneticUncompensated, hasMagneticNed, hasMagneticEcef,
-		hasAcceleration, hasAccelerationLinearBody, hasAccelerationUncompensated, hasAccelerationLinearNed, hasAccelerationLinearEcef, hasAccelerationNed, hasAccelerationEcef,
-		hasAngularRate, hasAngularRateUncompensated,
-		hasTemperature, hasPressure,
-    hasPositionGpsLla, hasPositionGps2Lla, hasPositionGpsEcef, hasPositionGps2Ecef, hasPositionEstimatedLla, hasPositionEstimatedEcef,
-    hasVelocityGpsNed, hasVelocityGps2Ned, hasVelocityGpsEcef, hasVelocityGps2Ecef, hasVelocityEstimatedNed, hasVelocityEstimatedEcef, hasVelocityEstimatedBody,
-		hasDeltaTime, hasDeltaTheta, hasDeltaVelocity,
-		hasTimeStartup, hasTimeGps, hasTimeGps2, hasTow, hasWeek, hasGpsWeek, hasGps2Week, hasNumSats, hasNumSats2, hasTimeSyncIn, hasVpeStatus, hasInsStatus,
-    hasSyncInCnt, hasSyncOutCnt, hasTimeStatus, hasTimeGpsPps, hasTimeGps2Pps, hasGpsTow, hasGps2Tow, hasTimeUtc, hasTimeUtc2, hasSensSat, hasFix, hasFix2,
-    hasPositionUncertaintyGpsNed, hasPositionUncertaintyGps2Ned, hasPositionUncertaintyGpsEcef, hasPositionUncertaintyGps2Ecef, hasPositionUncertaintyEstimated,
-    hasVelocityUncertaintyGps, hasVelocityUncertaintyGps2, hasVelocityUncertaintyEstimated, hasTimeUncertainty, hasTimeUncertainty2, hasAttitudeUncertainty,
-    hasTimeInfo, hasTimeInfo2, hasDop, hasDop2;
+	uint32_t hasFlags[(CDHAS_Count + 31) / 32];
 	vec3f yawPitchRoll,
 		magnetic, magneticUncompensated, magneticNed, magneticEcef,
 		acceleration, accelerationLinearBody, accelerationUncompensated, accelerationLinearNed, accelerationLinearEcef, accelerationNed, accelerationEcef,
@@ -152,166 +266,6 @@ struct CompositeData::Impl
   GnssDop dop;
   GnssDop dop2;
 
-	Impl& operator=(Impl& aImpl)
-	{
-		yawPitchRoll = aImpl.yawPitchRoll;
-		magnetic = aImpl.magnetic;
-		magneticUncompensated = aImpl.magneticUncompensated;
-		magneticNed = aImpl.magneticNed;
-		magneticEcef = aImpl.magneticEcef;
-		acceleration = aImpl.acceleration;
-		accelerationLinearBody = aImpl.accelerationLinearBody;
-		accelerationUncompensated = aImpl.accelerationUncompensated;
-		accelerationLinearNed = aImpl.accelerationLinearNed;
-		accelerationLinearEcef = aImpl.accelerationLinearEcef;
-		accelerationNed = aImpl.accelerationNed;
-		accelerationEcef = aImpl.accelerationEcef;
-		angularRate = aImpl.angularRate;
-		angularRateUncompensated = aImpl.angularRateUncompensated;
-    velocityGpsNed = aImpl.velocityGpsNed;
-    velocityGps2Ned = aImpl.velocityGps2Ned;
-    velocityGpsEcef = aImpl.velocityGpsEcef;
-    velocityGps2Ecef = aImpl.velocityGps2Ecef;
-    velocityEstimatedNed = aImpl.velocityEstimatedNed;
-		velocityEstimatedEcef = aImpl.velocityEstimatedEcef;
-		velocityEstimatedBody = aImpl.velocityEstimatedBody;
-		deltaTheta = aImpl.deltaTheta;
-		deltaVelocity = aImpl.deltaVelocity;
-    positionUncertaintyGpsNed = aImpl.positionUncertaintyGpsNed;
-    positionUncertaintyGps2Ned = aImpl.positionUncertaintyGps2Ned;
-    positionUncertaintyGpsEcef = aImpl.positionUncertaintyGpsEcef;
-    positionUncertaintyGps2Ecef = aImpl.positionUncertaintyGps2Ecef;
-    attitudeUncertainty = aImpl.attitudeUncertainty;
-    positionGpsLla = aImpl.positionGpsLla;
-    positionGps2Lla = aImpl.positionGps2Lla;
-    positionGpsEcef = aImpl.positionGpsEcef;
-    positionGps2Ecef = aImpl.positionGps2Ecef;
-    positionEstimatedLla = aImpl.positionEstimatedLla;
-		positionEstimatedEcef = aImpl.positionEstimatedEcef;
-		quaternion = aImpl.quaternion;
-		directionConsineMatrix = aImpl.directionConsineMatrix;
-
-		temperature = aImpl.temperature;
-		pressure = aImpl.pressure;
-		deltaTime = aImpl.deltaTime;
-		positionUncertaintyEstimated = aImpl.positionUncertaintyEstimated;
-    velocityUncertaintyGps = aImpl.velocityUncertaintyGps;
-    velocityUncertaintyGps2 = aImpl.velocityUncertaintyGps2;
-    velocityUncertaintyEstimated = aImpl.velocityUncertaintyEstimated;
-		timeStartup = aImpl.timeStartup;
-    timeGps = aImpl.timeGps;
-    timeGps2 = aImpl.timeGps2;
-    timeUtc = aImpl.timeUtc;
-    timeUtc2 = aImpl.timeUtc2;
-    timeSyncIn = aImpl.timeSyncIn;
-    timeGpsPps = aImpl.timeGpsPps;
-    timeGps2Pps = aImpl.timeGps2Pps;
-    gpsTow = aImpl.gpsTow;
-    gps2Tow = aImpl.gps2Tow;
-    tow = aImpl.tow;
-    week = aImpl.week;
-    gpsWeek = aImpl.gpsWeek;
-    gps2Week = aImpl.gps2Week;
-    numSats = aImpl.numSats;
-    numSats2 = aImpl.numSats2;
-    insStatus = aImpl.insStatus;
-		syncInCnt = aImpl.syncInCnt;
-    syncOutCnt = aImpl.syncOutCnt;
-    timeStatus = aImpl.timeStatus;
-    timeUncertainty = aImpl.timeUncertainty;
-    timeUncertainty2 = aImpl.timeUncertainty2;
-    fix = aImpl.fix;
-		sensSat = aImpl.sensSat;
-    timeInfo = aImpl.timeInfo;
-    dop = aImpl.dop;
-    dop2 = aImpl.dop2;
-
-		mostRecentlyUpdatedAttitudeType = aImpl.mostRecentlyUpdatedAttitudeType;
-		mostRecentlyUpdatedMagneticType = aImpl.mostRecentlyUpdatedMagneticType;
-		mostRecentlyUpdatedAccelerationType = aImpl.mostRecentlyUpdatedAccelerationType;
-		mostRecentlyUpdatedAngularRateType = aImpl.mostRecentlyUpdatedAngularRateType;
-		mostRecentlyUpdatedTemperatureType = aImpl.mostRecentlyUpdatedTemperatureType;
-		mostRecentlyUpdatePressureType = aImpl.mostRecentlyUpdatePressureType;
-		mostRecentlyUpdatedPositionType = aImpl.mostRecentlyUpdatedPositionType;
-		mostRecentlyUpdatedVelocityType = aImpl.mostRecentlyUpdatedVelocityType;
-		mostRecentlyUpdatedPositionUncertaintyType = aImpl.mostRecentlyUpdatedPositionUncertaintyType;
-		mostRecentlyUpdatedVelocityUncertaintyType = aImpl.mostRecentlyUpdatedVelocityUncertaintyType;
-		hasYawPitchRoll = aImpl.hasYawPitchRoll;
-		hasQuaternion = aImpl.hasQuaternion;
-		hasDirectionCosineMatrix = aImpl.hasDirectionCosineMatrix;
-		hasMagnetic = aImpl.hasMagnetic;
-		hasMagneticUncompensated = aImpl.hasMagneticUncompensated;
-		hasMagneticNed = aImpl.hasMagneticNed;
-		hasMagneticEcef = aImpl.hasMagneticEcef;
-		hasAcceleration = aImpl.hasAcceleration;
-		hasAccelerationLinearBody = aImpl.hasAccelerationLinearBody;
-		hasAccelerationUncompensated = aImpl.hasAccelerationUncompensated;
-		hasAccelerationLinearNed = aImpl.hasAccelerationLinearNed;
-		hasAccelerationLinearEcef = aImpl.hasAccelerationLinearEcef;
-		hasAccelerationNed = aImpl.hasAccelerationNed;
-		hasAccelerationEcef = aImpl.hasAccelerationEcef;
-		hasAngularRate = aImpl.hasAngularRate;
-		hasAngularRateUncompensated = aImpl.hasAngularRateUncompensated;
-		hasTemperature = aImpl.hasTemperature;
-		hasPressure = aImpl.hasPressure;
-    hasPositionGpsLla = aImpl.hasPositionGpsLla;
-    hasPositionGps2Lla = aImpl.hasPositionGps2Lla;
-    hasPositionGpsEcef = aImpl.hasPositionGpsEcef;
-    hasPositionGps2Ecef = aImpl.hasPositionGps2Ecef;
-    hasPositionEstimatedLla = aImpl.hasPositionEstimatedLla;
-		hasPositionEstimatedEcef = aImpl.hasPositionEstimatedEcef;
-    hasVelocityGpsNed = aImpl.hasVelocityGpsNed;
-    hasVelocityGps2Ned = aImpl.hasVelocityGps2Ned;
-    hasVelocityGpsEcef = aImpl.hasVelocityGpsEcef;
-    hasVelocityGps2Ecef = aImpl.hasVelocityGps2Ecef;
-    hasVelocityEstimatedNed = aImpl.hasVelocityEstimatedNed;
-		hasVelocityEstimatedEcef = aImpl.hasVelocityEstimatedEcef;
-		hasVelocityEstimatedBody = aImpl.hasVelocityEstimatedBody;
-		hasDeltaTime = aImpl.hasDeltaTime;
-		hasDeltaTheta = aImpl.hasDeltaTheta;
-		hasDeltaVelocity = aImpl.hasDeltaVelocity;
-		hasTimeStartup = aImpl.hasTimeStartup;
-    hasTimeGps = aImpl.hasTimeGps;
-    hasTimeGps2 = aImpl.hasTimeGps2;
-    hasTow = aImpl.hasTow;
-    hasWeek = aImpl.hasWeek;
-    hasGpsWeek = aImpl.hasGpsWeek;
-    hasGps2Week = aImpl.hasGps2Week;
-    hasNumSats = aImpl.hasNumSats;
-    hasNumSats2 = aImpl.hasNumSats2;
-    hasTimeSyncIn = aImpl.hasTimeSyncIn;
-		hasVpeStatus = aImpl.hasVpeStatus;
-		hasInsStatus = aImpl.hasInsStatus;
-		hasSyncInCnt = aImpl.hasSyncInCnt;
-    hasSyncOutCnt = aImpl.hasSyncOutCnt;
-    hasTimeStatus = aImpl.hasTimeStatus;
-    hasTimeGpsPps = aImpl.hasTimeGpsPps;
-    hasTimeGps2Pps = aImpl.hasTimeGps2Pps;
-    hasGpsTow = aImpl.hasGpsTow;
-    hasGps2Tow = aImpl.hasGps2Tow;
-    hasTimeUtc = aImpl.hasTimeUtc;
-    hasTimeUtc2 = aImpl.hasTimeUtc2;
-    hasSensSat = aImpl.hasSensSat;
-		hasFix = aImpl.hasFix;
-    hasPositionUncertaintyGpsNed = aImpl.hasPositionUncertaintyGpsNed;
-    hasPositionUncertaintyGps2Ned = aImpl.hasPositionUncertaintyGps2Ned;
-    hasPositionUncertaintyGpsEcef = aImpl.hasPositionUncertaintyGpsEcef;
-    hasPositionUncertaintyGps2Ecef = aImpl.hasPositionUncertaintyGps2Ecef;
-    hasPositionUncertaintyEstimated = aImpl.hasPositionUncertaintyEstimated;
-    hasVelocityUncertaintyGps = aImpl.hasVelocityUncertaintyGps;
-    hasVelocityUncertaintyGps2 = aImpl.hasVelocityUncertaintyGps2;
-    hasVelocityUncertaintyEstimated = aImpl.hasVelocityUncertaintyEstimated;
-    hasTimeUncertainty = aImpl.hasTimeUncertainty;
-    hasTimeUncertainty2 = aImpl.hasTimeUncertainty2;
-    hasAttitudeUncertainty = aImpl.hasAttitudeUncertainty;
-    hasTimeInfo = aImpl.hasTimeInfo;
-    hasTimeInfo2 = aImpl.hasTimeInfo2;
-    hasDop = aImpl.hasDop;
-    hasDop2 = aImpl.hasDop2;
-
-		return *this;
-	}
-
 	void reset()
 	{
 		mostRecentlyUpdatedAttitudeType = CDATT_None;
@@ -324,124 +278,65 @@ struct CompositeData::Impl
 		mostRecentlyUpdatedVelocityType = CDVEL_None;
 		mostRecentlyUpdatedPositionUncertaintyType = CDPOU_None;
 		mostRecentlyUpdatedVelocityUncertaintyType = CDVEU_None;
-		hasYawPitchRoll = false;
-		hasQuaternion = false;
-		hasDirectionCosineMatrix = false;
-		hasMagnetic = false;
-		hasMagneticUncompensated = false;
-		hasMagneticNed = false;
-		hasMagneticEcef = false;
-		hasAcceleration = false;
-		hasAccelerationLinearBody = false;
-		hasAccelerationUncompensated = false;
-		hasAccelerationLinearNed = false;
-		hasAccelerationLinearEcef = false;
-		hasAccelerationNed = false;
-		hasAccelerationEcef = false;
-		hasAngularRate = false;
-		hasAngularRateUncompensated = false;
-		hasTemperature = false;
-		hasPressure = false;
-    hasPositionGpsLla = false;
-    hasPositionGps2Lla = false;
-    hasPositionGpsEcef = false;
-    hasPositionGps2Ecef = false;
-    hasPositionEstimatedLla = false;
-		hasPositionEstimatedEcef = false;
-    hasVelocityGpsNed = false;
-    hasVelocityGps2Ned = false;
-    hasVelocityGpsEcef = false;
-    hasVelocityGps2Ecef = false;
-    hasVelocityEstimatedNed = false;
-		hasVelocityEstimatedEcef = false;
-		hasVelocityEstimatedBody = false;
-		hasDeltaTime = false;
-		hasDeltaTheta = false;
-		hasDeltaVelocity = false;
-		hasTimeStartup = false;
-    hasTimeGps = false;
-    hasTimeGps2 = false;
-    hasTow = false;
-    hasWeek = false;
-    hasGpsWeek = false;
-    hasGps2Week = false;
-    hasNumSats = false;
-    hasNumSats2 = false;
-    hasTimeSyncIn = false;
-		hasVpeStatus = false;
-		hasInsStatus = false;
-		hasSyncInCnt = false;
-    hasTimeGpsPps = false;
-    hasTimeGps2Pps = false;
-    hasGpsTow = false;
-    hasGps2Tow = false;
-    hasTimeUtc = false;
-    hasTimeUtc2 = false;
-    hasSensSat = false;
-		hasFix = false;
-    hasPositionUncertaintyGpsNed = false;
-    hasPositionUncertaintyGps2Ned = false;
-    hasPositionUncertaintyGpsEcef = false;
-    hasPositionUncertaintyGps2Ecef = false;
-    hasPositionUncertaintyEstimated = false;
-    hasVelocityUncertaintyGps = false;
-    hasVelocityUncertaintyGps2 = false;
-    hasVelocityUncertaintyEstimated = false;
-    hasTimeUncertainty = false;
-    hasTimeUncertainty2 = false;
-    hasAttitudeUncertainty = false;
-    hasTimeInfo = false;
-    hasTimeInfo2 = false;
-    hasDop = false;
-    hasDop2 = false;
-  }
+		memset(hasFlags, 0, sizeof(hasFlags));
+	}
+
+	bool has(HasFlag flag) const
+	{
+		return (hasFlags[flag / 32] & (1u << (flag % 32))) != 0;
+	}
+
+	void setHas(HasFlag flag)
+	{
+		hasFlags[flag / 32] |= 1u << (flag % 32);
+	}
 
 	void setYawPitchRoll(vec3f ypr)
 	{
 		mostRecentlyUpdatedAttitudeType = CDATT_YawPitchRoll;
-		hasYawPitchRoll = true;
+		setHas(CDHAS_YawPitchRoll);
 		yawPitchRoll = ypr;
 	}
 
 	void setQuaternion(vec4f quat)
 	{
 		mostRecentlyUpdatedAttitudeType = CDATT_Quaternion;
-		hasQuaternion = true;
+		setHas(CDHAS_Quaternion);
 		quaternion = quat;
 	}
 
 	void setDirectionConsineMatrix(mat3f dcm)
 	{
 		mostRecentlyUpdatedAttitudeType = CDATT_DirectionCosineMatrix;
-		hasDirectionCosineMatrix = true;
+		setHas(CDHAS_DirectionCosineMatrix);
 		directionConsineMatrix = dcm;
 	}
 
 	void setMagnetic(vec3f mag)
 	{
 		mostRecentlyUpdatedMagneticType = CDMAG_Normal;
-		hasMagnetic = true;
+		setHas(CDHAS_Magnetic);
 		magnetic = mag;
 	}
 
 	void setMagneticUncompensated(vec3f mag)
 	{
 		mostRecentlyUpdatedMagneticType = CDMAG_Uncompensated;
-		hasMagneticUncompensated = true;
+		setHas(CDHAS_MagneticUncompensated);
 		magneticUncompensated = mag;
 	}
 
 	void setMagneticNed(vec3f mag)
 	{
 		mostRecentlyUpdatedMagneticType = CDMAG_Ned;
-		hasMagneticNed = true;
+		setHas(CDHAS_MagneticNed);
 		magneticNed = mag;
 	}
 
 	void setMagneticEcef(vec3f mag)
 	{
 		mostRecentlyUpdatedMagneticType = CDMAG_Ecef;
-		hasMagneticEcef = true;
+		setHas(CDHAS_MagneticEcef);
 		magneticEcef = mag;
 	}
 
@@ -449,49 +344,49 @@ struct CompositeData::Impl
 	void setAcceleration(vec3f accel)
 	{
 		mostRecentlyUpdatedAccelerationType = CDACC_Normal;
-		hasAcceleration = true;
+		setHas(CDHAS_Acceleration);
 		acceleration = accel;
 	}
 
 	void setAccelerationLinearBody(vec3f accel)
 	{
 		mostRecentlyUpdatedAccelerationType = CDACC_LinearBody;
-		hasAccelerationLinearBody = true;
+		setHas(CDHAS_AccelerationLinearBody);
 		accelerationLinearBody = accel;
 	}
 
 	void setAccelerationUncompensated(vec3f accel)
 	{
 		mostRecentlyUpdatedAccelerationType = CDACC_Uncompensated;
-		hasAccelerationUncompensated = true;
+		setHas(CDHAS_AccelerationUncompensated);
 		accelerationUncompensated = accel;
 	}
 
 	void setAccelerationLinearNed(vec3f accel)
 	{
 		mostRecentlyUpdatedAccelerationType = CDACC_LinearNed;
-		hasAccelerationLinearNed = true;
+		setHas(CDHAS_AccelerationLinearNed);
 		accelerationLinearNed = accel;
 	}
 
 	void setAccelerationLinearEcef(vec3f accel)
 	{
 		mostRecentlyUpdatedAccelerationType = CDACC_LinearEcef;
-		hasAccelerationLinearEcef = true;
+		setHas(CDHAS_AccelerationLinearEcef);
 		accelerationLinearEcef = accel;
 	}
 
 	void setAccelerationNed(vec3f accel)
 	{
 		mostRecentlyUpdatedAccelerationType = CDACC_Ned;
-		hasAccelerationNed = true;
+		setHas(CDHAS_AccelerationNed);
 		accelerationNed = accel;
 	}
 
 	void setAccelerationEcef(vec3f accel)
 	{
 		mostRecentlyUpdatedAccelerationType = CDACC_Ecef;
-		hasAccelerationEcef = true;
+		setHas(CDHAS_AccelerationEcef);
 		accelerationEcef = accel;
 	}
 
@@ -499,14 +394,14 @@ struct CompositeData::Impl
 	void setAngularRate(vec3f ar)
 	{
 		mostRecentlyUpdatedAngularRateType = CDANR_Normal;
-		hasAngularRate = true;
+		setHas(CDHAS_AngularRate);
 		angularRate = ar;
 	}
 
 	void setAngularRateUncompensated(vec3f ar)
 	{
 		mostRecentlyUpdatedAngularRateType = CDANR_Uncompensated;
-		hasAngularRateUncompensated = true;
+		setHas(CDHAS_AngularRateUncompensated);
 		angularRateUncompensated = ar;
 	}
 
@@ -514,7 +409,7 @@ struct CompositeData::Impl
 	void setTemperature(float temp)
 	{
 		mostRecentlyUpdatedTemperatureType = CDTEM_Normal;
-		hasTemperature = true;
+		setHas(CDHAS_Temperature);
 		temperature = temp;
 	}
 
@@ -522,370 +417,370 @@ struct CompositeData::Impl
 	void setPressure(float pres)
 	{
 		mostRecentlyUpdatePressureType = CDPRE_Normal;
-		hasPressure = true;
+		setHas(CDHAS_Pressure);
 		pressure = pres;
 	}
 
   void setPositionGpsLla(vec3d pos)
   {
     mostRecentlyUpdatedPositionType = CDPOS_GpsLla;
-    hasPositionGpsLla = true;
+    setHas(CDHAS_PositionGpsLla);
     positionGpsLla = pos;
   }
 
   void setPositionGps2Lla(vec3d pos)
   {
     mostRecentlyUpdatedPositionType = CDPOS_Gps2Lla;
-    hasPositionGps2Lla = true;
+    setHas(CDHAS_PositionGps2Lla);
     positionGps2Lla = pos;
   }
 
   void setPositionGpsEcef(vec3d pos)
   {
     mostRecentlyUpdatedPositionType = CDPOS_GpsEcef;
-    hasPositionGpsEcef = true;
+    setHas(CDHAS_PositionGpsEcef);
     positionGpsEcef = pos;
   }
 
   void setPositionGps2Ecef(vec3d pos)
   {
     mostRecentlyUpdatedPositionType = CDPOS_Gps2Ecef;
-    hasPositionGps2Ecef = true;
+    setHas(CDHAS_PositionGps2Ecef);
     positionGps2Ecef = pos;
   }
 
   void setPositionEstimatedLla(vec3d pos)
 	{
 		mostRecentlyUpdatedPositionType = CDPOS_EstimatedLla;
-		hasPositionEstimatedLla = true;
+		setHas(CDHAS_PositionEstimatedLla);
 		positionEstimatedLla = pos;
 	}
 
 	void setPositionEstimatedEcef(vec3d pos)
 	{
 		mostRecentlyUpdatedPositionType = CDPOS_EstimatedEcef;
-		hasPositionEstimatedEcef = true;
+		setHas(CDHAS_PositionEstimatedEcef);
 		positionEstimatedEcef = pos;
 	}
 
   void setVelocityGpsNed(vec3f vel)
   {
     mostRecentlyUpdatedVelocityType = CDVEL_GpsNed;
-    hasVelocityGpsNed = true;
+    setHas(CDHAS_VelocityGpsNed);
     velocityGpsNed = vel;
   }
 
   void setVelocityGps2Ned(vec3f vel)
   {
     mostRecentlyUpdatedVelocityType = CDVEL_Gps2Ned;
-    hasVelocityGps2Ned = true;
+    setHas(CDHAS_VelocityGps2Ned);
     velocityGps2Ned = vel;
   }
 
   void setVelocityGpsEcef(vec3f vel)
   {
     mostRecentlyUpdatedVelocityType = CDVEL_GpsEcef;
-    hasVelocityGpsEcef = true;
+    setHas(CDHAS_VelocityGpsEcef);
     velocityGpsEcef = vel;
   }
 
   void setVelocityGps2Ecef(vec3f vel)
   {
     mostRecentlyUpdatedVelocityType = CDVEL_Gps2Ecef;
-    hasVelocityGps2Ecef = true;
+    setHas(CDHAS_VelocityGps2Ecef);
     velocityGps2Ecef = vel;
   }
 
   void setVelocityEstimatedNed(vec3f vel)
 	{
 		mostRecentlyUpdatedVelocityType = CDVEL_EstimatedNed;
-		hasVelocityEstimatedNed = true;
+		setHas(CDHAS_VelocityEstimatedNed);
 		velocityEstimatedNed = vel;
 	}
 
 	void setVelocityEstimatedEcef(vec3f vel)
 	{
 		mostRecentlyUpdatedVelocityType = CDVEL_EstimatedEcef;
-		hasVelocityEstimatedEcef = true;
+		setHas(CDHAS_VelocityEstimatedEcef);
 		velocityEstimatedEcef = vel;
 	}
 
 	void setVelocityEstimatedBody(vec3f vel)
 	{
 		mostRecentlyUpdatedVelocityType = CDVEL_EstimatedBody;
-		hasVelocityEstimatedBody = true;
+		setHas(CDHAS_VelocityEstimatedBody);
 		velocityEstimatedBody = vel;
 	}
 
 	void setDeltaTime(float time)
 	{
-		hasDeltaTime = true;
+		setHas(CDHAS_DeltaTime);
 		deltaTime = time;
 	}
 
 	void setDeltaTheta(vec3f theta)
 	{
-		hasDeltaTheta = true;
+		setHas(CDHAS_DeltaTheta);
 		deltaTheta = theta;
 	}
 
 	void setDeltaVelocity(vec3f vel)
 	{
-		hasDeltaVelocity = true;
+		setHas(CDHAS_DeltaVelocity);
 		deltaVelocity = vel;
 	}
 
 	void setTimeStartup(uint64_t ts)
 	{
-		hasTimeStartup = true;
+		setHas(CDHAS_TimeStartup);
 		timeStartup = ts;
 	}
 
   void setTimeGps(uint64_t time)
   {
-    hasTimeGps = true;
+    setHas(CDHAS_TimeGps);
     timeGps = time;
   }
 
   void setTimeGps2(uint64_t time)
   {
-    hasTimeGps2 = true;
+    setHas(CDHAS_TimeGps2);
     timeGps2 = time;
   }
 
   void setTow(double t)
   {
-    hasTow = true;
+    setHas(CDHAS_Tow);
     tow = t;
   }
 
   void setWeek(uint16_t w)
   {
-    hasWeek = true;
+    setHas(CDHAS_Week);
     week = w;
   }
 
   void setGpsWeek(uint16_t w)
   {
-    hasGpsWeek = true;
+    setHas(CDHAS_GpsWeek);
     gpsWeek = w;
   }
 
   void setGps2Week(uint16_t w)
   {
-    hasGps2Week = true;
+    setHas(CDHAS_Gps2Week);
     gps2Week = w;
   }
 
   void setNumSats(uint8_t s)
   {
-    hasNumSats = true;
+    setHas(CDHAS_NumSats);
     numSats = s;
   }
 
   void setNumSats2(uint8_t s)
   {
-    hasNumSats2 = true;
+    setHas(CDHAS_NumSats2);
     numSats2 = s;
   }
 
   void setTimeSyncIn(uint64_t t)
 	{
-		hasTimeSyncIn = true;
+		setHas(CDHAS_TimeSyncIn);
 		timeSyncIn = t;
 	}
 
 	void setVpeStatus(VpeStatus s)
 	{
-		hasVpeStatus = true;
+		setHas(CDHAS_VpeStatus);
 		vpeStatus = s;
 	}
 
 	void setInsStatus(InsStatus s)
 	{
-		hasInsStatus = true;
+		setHas(CDHAS_InsStatus);
 		insStatus = s;
 	}
 
 	void setSyncInCnt(uint32_t count)
 	{
-		hasSyncInCnt = true;
+		setHas(CDHAS_SyncInCnt);
 		syncInCnt = count;
 	}
 
   void setSyncOutCnt(uint32_t count)
   {
-    hasSyncOutCnt = true;
+    setHas(CDHAS_SyncOutCnt);
     syncOutCnt = count;
   }
 
   void setTimeStatus(uint8_t status)
   {
-    hasTimeStatus = true;
+    setHas(CDHAS_TimeStatus);
     timeStatus = status;
   }
 
   void setTimeGpsPps(uint64_t pps)
   {
-    hasTimeGpsPps = true;
+    setHas(CDHAS_TimeGpsPps);
     timeGpsPps = pps;
   }
 
   void setTimeGps2Pps(uint64_t pps)
   {
-    hasTimeGps2Pps = true;
+    setHas(CDHAS_TimeGps2Pps);
     timeGps2Pps = pps;
   }
 
   void setGpsTow(uint64_t tow)
   {
-    hasGpsTow = true;
+    setHas(CDHAS_GpsTow);
     gpsTow = tow;
   }
 
   void setGpsTow(double tow)
   {
-    hasGpsTow = true;
+    setHas(CDHAS_GpsTow);
     gpsTow = static_cast<uint64_t>(tow*1e9);
   }
 
   void setGps2Tow(uint64_t tow)
   {
-    hasGps2Tow = true;
+    setHas(CDHAS_Gps2Tow);
     gps2Tow = tow;
   }
 
   void setGps2Tow(double tow)
   {
-    hasGps2Tow = true;
+    setHas(CDHAS_Gps2Tow);
     gps2Tow = static_cast<uint64_t>(tow*1e9);
   }
 
   void setPositionUncertaintyGpsNed(vec3f u)
   {
     mostRecentlyUpdatedPositionUncertaintyType = CDPOU_GpsNed;
-    hasPositionUncertaintyGpsNed = true;
+    setHas(CDHAS_PositionUncertaintyGpsNed);
     positionUncertaintyGpsNed = u;
   }
 
   void setPositionUncertaintyGps2Ned(vec3f u)
   {
     mostRecentlyUpdatedPositionUncertaintyType = CDPOU_Gps2Ned;
-    hasPositionUncertaintyGps2Ned = true;
+    setHas(CDHAS_PositionUncertaintyGps2Ned);
     positionUncertaintyGps2Ned = u;
   }
 
   void setPositionUncertaintyGpsEcef(vec3f u)
 	{
 		mostRecentlyUpdatedPositionUncertaintyType = CDPOU_GpsEcef;
-		hasPositionUncertaintyGpsEcef = true;
+		setHas(CDHAS_PositionUncertaintyGpsEcef);
 		positionUncertaintyGpsEcef = u;
 	}
 
   void setPositionUncertaintyGps2Ecef(vec3f u)
   {
     mostRecentlyUpdatedPositionUncertaintyType = CDPOU_Gps2Ecef;
-    hasPositionUncertaintyGps2Ecef = true;
+    setHas(CDHAS_PositionUncertaintyGps2Ecef);
     positionUncertaintyGps2Ecef = u;
   }
 
   void setPositionUncertaintyEstimated(float u)
 	{
 		mostRecentlyUpdatedPositionUncertaintyType = CDPOU_Estimated;
-		hasPositionUncertaintyEstimated = true;
+		setHas(CDHAS_PositionUncertaintyEstimated);
 		positionUncertaintyEstimated = u;
 	}
 
   void setVelocityUncertaintyGps(float u)
   {
     mostRecentlyUpdatedVelocityUncertaintyType = CDVEU_Gps;
-    hasVelocityUncertaintyGps = true;
+    setHas(CDHAS_VelocityUncertaintyGps);
     velocityUncertaintyGps = u;
   }
 
   void setVelocityUncertaintyGps2(float u)
   {
     mostRecentlyUpdatedVelocityUncertaintyType = CDVEU_Gps2;
-    hasVelocityUncertaintyGps2 = true;
+    setHas(CDHAS_VelocityUncertaintyGps2);
     velocityUncertaintyGps2 = u;
   }
 
   void setVelocityUncertaintyEstimated(float u)
 	{
 		mostRecentlyUpdatedVelocityUncertaintyType = CDVEU_Estimated;
-		hasVelocityUncertaintyEstimated = true;
+		setHas(CDHAS_VelocityUncertaintyEstimated);
 		velocityUncertaintyEstimated = u;
 	}
 
   void setTimeUncertainty(uint32_t u)
   {
-    hasTimeUncertainty = true;
+    setHas(CDHAS_TimeUncertainty);
     timeUncertainty = u;
   }
 
   void setTimeUncertainty2(uint32_t u)
   {
-    hasTimeUncertainty2 = true;
+    setHas(CDHAS_TimeUncertainty2);
     timeUncertainty2 = u;
   }
 
   void setAttitudeUncertainty(vec3f u)
 	{
-		hasAttitudeUncertainty = true;
+		setHas(CDHAS_AttitudeUncertainty);
 		attitudeUncertainty = u;
 	}
 
   void setFix(GpsFix f)
   {
-    hasFix = true;
+    setHas(CDHAS_Fix);
     fix = f;
   }
 
   void setFix2(GpsFix f)
   {
-    hasFix2 = true;
+    setHas(CDHAS_Fix2);
     fix2 = f;
   }
 
   void setTimeUtc(TimeUtc t)
   {
-    hasTimeUtc = true;
+    setHas(CDHAS_TimeUtc);
     timeUtc = t;
   }
 
   void setTimeUtc2(TimeUtc t)
   {
-    hasTimeUtc2 = true;
+    setHas(CDHAS_TimeUtc2);
     timeUtc2 = t;
   }
 
   void setSensSat(SensSat s)
 	{
-		hasSensSat = true;
+		setHas(CDHAS_SensSat);
 		sensSat = s;
 	}
 
   void setGnssDop(GnssDop d)
   {
-    hasDop = true;
+    setHas(CDHAS_Dop);
     dop = d;
   }
 
   void setGnssDop2(GnssDop d)
   {
-    hasDop2 = true;
+    setHas(CDHAS_Dop2);
     dop2 = d;
   }
 
   void setTimeInfo(TimeInfo t)
   {
-    hasTimeInfo = true;
+    setHas(CDHAS_TimeInfo);
     timeInfo = t;
   }
 
   void setTimeInfo2(TimeInfo t)
   {
-    hasTimeInfo2 = true;
+    setHas(CDHAS_TimeInfo2);
     timeInfo2 = t;
   }
 };
@@ -893,43 +788,35 @@ struct CompositeData::Impl
 
 
 CompositeData::CompositeData() :
-_i(new Impl)
+_i(new (_storage) Impl)
 {
+	// Fails to compile if the Impl no longer fits in _storage.
+	enum { ImplFitsInStorage = sizeof(char[sizeof(Impl) <= ImplStorageSize ? 1 : -1]) };
+
 	_i->reset();
 }
 
 CompositeData::CompositeData(const CompositeData& cd) :
-_i(NULL)
+_i(new (_storage) Impl(*cd._i))
 {
-	(*this) = cd;
 }
 
-
 CompositeData::~CompositeData()
 {
-	if (NULL != _i)
-	{
-		delete _i;
-		_i = NULL;
-	}
+	// The Impl is trivially destructible and lives in _storage, so there is
+	// nothing to release.
 }
 
 CompositeData& CompositeData::operator=(const CompositeData& RHS)
 {
-	if (NULL != _i)
-	{
-		delete _i;
-	}
-
-	_i = new Impl();
-	(*_i) = (*RHS._i);
+	memcpy(_storage, RHS._storage, sizeof(Impl));
 
 	return *this;
 }
 
 bool CompositeData::hasYawPitchRoll()
 {
-	return _i->hasYawPitchRoll;
+	return _i->has(Impl::CDHAS_YawPitchRoll);
 }
 
 vec3f CompositeData::yawPitchRoll()
@@ -940,9 +827,19 @@ vec3f CompositeData::yawPitchRoll()
 	return _i->yawPitchRoll;
 }
 
+bool CompositeData::tryYawPitchRoll(vec3f& value) VN_NOEXCEPT
+{
+	if (!hasYawPitchRoll())
+		return false;
+
+	value = _i->yawPitchRoll;
+
+	return true;
+}
+
 bool CompositeData::hasQuaternion()
 {
-	return _i->hasQuaternion;
+	return _i->has(Impl::CDHAS_Quaternion);
 }
 
 vec4f CompositeData::quaternion()
@@ -953,9 +850,19 @@ vec4f CompositeData::quaternion()
 	return _i->quaternion;
 }
 
+bool CompositeData::tryQuaternion(vec4f& value) VN_NOEXCEPT
+{
+	if (!hasQuaternion())
+		return false;
+
+	value = _i->quaternion;
+
+	return true;
+}
+
 bool CompositeData::hasDirectionCosineMatrix()
 {
-	return _i->hasDirectionCosineMatrix;
+	return _i->has(Impl::CDHAS_DirectionCosineMatrix);
 }
 
 mat3f CompositeData::directionCosineMatrix()
@@ -966,6 +873,16 @@ mat3f CompositeData::directionCosineMatrix()
 	return _i->directionConsineMatrix;
 }
 
+bool CompositeData::tryDirectionCosineMatrix(mat3f& value) VN_NOEXCEPT
+{
+	if (!hasDirectionCosineMatrix())
+		return false;
+
+	value = _i->directionConsineMatrix;
+
+	return true;
+}
+
 bool CompositeData::hasAnyMagnetic()
 {
 	return _i->mostRecentlyUpdatedMagneticType != Impl::CDMAG_None;
@@ -990,9 +907,32 @@ vec3f CompositeData::anyMagnetic()
 	}
 }
 
+bool CompositeData::tryAnyMagnetic(vec3f& value) VN_NOEXCEPT
+{
+	switch (_i->mostRecentlyUpdatedMagneticType)
+	{
+	case Impl::CDMAG_None:
+		return false;
+	case Impl::CDMAG_Normal:
+		value = _i->magnetic;
+		return true;
+	case Impl::CDMAG_Uncompensated:
+		value = _i->magneticUncompensated;
+		return true;
+	case Impl::CDMAG_Ned:
+		value = _i->magneticNed;
+		return true;
+	case Impl::CDMAG_Ecef:
+		value = _i->magneticEcef;
+		return true;
+	default:
+		return false;
+	}
+}
+
 bool CompositeData::hasMagnetic()
 {
-	return _i->hasMagnetic;
+	return _i->has(Impl::CDHAS_Magnetic);
 }
 
 vec3f CompositeData::magnetic()
@@ -1003,9 +943,19 @@ vec3f CompositeData::magnetic()
 	return _i->magnetic;
 }
 
+bool CompositeData::tryMagnetic(vec3f& value) VN_NOEXCEPT
+{
+	if (!hasMagnetic())
+		return false;
+
+	value = _i->magnetic;
+
+	return true;
+}
+
 bool CompositeData::hasMagneticUncompensated()
 {
-	return _i->hasMagneticUncompensated;
+	return _i->has(Impl::CDHAS_MagneticUncompensated);
 }
 
 vec3f CompositeData::magneticUncompensated()
@@ -1016,9 +966,19 @@ vec3f CompositeData::magneticUncompensated()
 	return _i->magneticUncompensated;
 }
 
+bool CompositeData::tryMagneticUncompensated(vec3f& value) VN_NOEXCEPT
+{
+	if (!hasMagneticUncompensated())
+		return false;
+
+	value = _i->magneticUncompensated;
+
+	return true;
+}
+
 bool CompositeData::hasMagneticNed()
 {
-	return _i->hasMagneticNed;
+	return _i->has(Impl::CDHAS_MagneticNed);
 }
 
 vec3f CompositeData::magneticNed()
@@ -1029,9 +989,19 @@ vec3f CompositeData::magneticNed()
 	return _i->magneticNed;
 }
 
+bool CompositeData::tryMagneticNed(vec3f& value) VN_NOEXCEPT
+{
+	if (!hasMagneticNed())
+		return false;
+
+	value = _i->magneticNed;
+
+	return true;
+}
+
 bool CompositeData::hasMagneticEcef()
 {
-	return _i->hasMagneticEcef;
+	return _i->has(Impl::CDHAS_MagneticEcef);
 }
 
 vec3f CompositeData::magneticEcef()
@@ -1042,6 +1012,16 @@ vec3f CompositeData::magneticEcef()
 	return _i->magneticEcef;
 }
 
+bool CompositeData::tryMagneticEcef(vec3f& value) VN_NOEXCEPT
+{
+	if (!hasMagneticEcef())
+		return false;
+
+	value = _i->magneticEcef;
+
+	return true;
+}
+
 
 bool CompositeData::hasAnyAcceleration()
 {
@@ -1073,9 +1053,41 @@ vec3f CompositeData::anyAcceleration()
 	}
 }
 
+bool CompositeData::tryAnyAcceleration(vec3f& value) VN_NOEXCEPT
+{
+	switch (_i->mostRecentlyUpdatedAccelerationType)
+	{
+	case Impl::CDACC_None:
+		return false;
+	case Impl::CDACC_Normal:
+		value = _i->acceleration;
+		return true;
+	case Impl::CDACC_LinearBody:
+		value = _i->accelerationLinearBody;
+		return true;
+	case Impl::CDACC_Uncompensated:
+		value = _i->accelerationUncompensated;
+		return true;
+	case Impl::CDACC_LinearNed:
+		value = _i->accelerationLinearNed;
+		return true;
+	case Impl::CDACC_Ned:
+		value = _i->accelerationNed;
+		return true;
+	case Impl::CDACC_Ecef:
+		value = _i->accelerationEcef;
+		return true;
+	case Impl::CDACC_LinearEcef:
+		value = _i->accelerationLinearEcef;
+		return true;
+	default:
+		return false;
+	}
+}
+
 bool CompositeData::hasAcceleration()
 {
-	return _i->hasAcceleration;
+	return _i->has(Impl::CDHAS_Acceleration);
 }
 
 vec3f CompositeData::acceleration()
@@ -1086,9 +1098,19 @@ vec3f CompositeData::acceleration()
 	return _i->acceleration;
 }
 
+bool CompositeData::tryAcceleration(vec3f& value) VN_NOEXCEPT
+{
+	if (!hasAcceleration())
+		return false;
+
+	value = _i->acceleration;
+
+	return true;
+}
+
 bool CompositeData::hasAccelerationLinearBody()
 {
-	return _i->hasAccelerationLinearBody;
+	return _i->has(Impl::CDHAS_AccelerationLinearBody);
 }
 
 vec3f CompositeData::accelerationLinearBody()
@@ -1099,9 +1121,19 @@ vec3f CompositeData::accelerationLinearBody()
 	return _i->accelerationLinearBody;
 }
 
+bool CompositeData::tryAccelerationLinearBody(vec3f& value) VN_NOEXCEPT
+{
+	if (!hasAccelerationLinearBody())
+		return false;
+
+	value = _i->accelerationLinearBody;
+
+	return true;
+}
+
 bool CompositeData::hasAccelerationUncompensated()
 {
-	return _i->hasAccelerationUncompensated;
+	return _i->has(Impl::CDHAS_AccelerationUncompensated);
 }
 
 vec3f CompositeData::accelerationUncompensated()
@@ -1112,9 +1144,19 @@ vec3f CompositeData::accelerationUncompensated()
 	return _i->accelerationUncompensated;
 }
 
+bool CompositeData::tryAccelerationUncompensated(vec3f& value) VN_NOEXCEPT
+{
+	if (!hasAccelerationUncompensated())
+		return false;
+
+	value = _i->accelerationUncompensated;
+
+	return true;
+}
+
 bool CompositeData::hasAccelerationLinearNed()
 {
-	return _i->hasAccelerationLinearNed;
+	return _i->has(Impl::CDHAS_AccelerationLinearNed);
 }
 
 vec3f CompositeData::accelerationLinearNed()
@@ -1125,9 +1167,19 @@ vec3f CompositeData::accelerationLinearNed()
 	return _i->accelerationLinearNed;
 }
 
+bool CompositeData::tryAccelerationLinearNed(vec3f& value) VN_NOEXCEPT
+{
+	if (!hasAccelerationLinearNed())
+		return false;
+
+	value = _i->accelerationLinearNed;
+
+	return true;
+}
+
 bool CompositeData::hasAccelerationLinearEcef()
 {
-	return _i->hasAccelerationLinearEcef;
+	return _i->has(Impl::CDHAS_AccelerationLinearEcef);
 }
 
 vec3f CompositeData::accelerationLinearEcef()
@@ -1138,9 +1190,19 @@ vec3f CompositeData::accelerationLinearEcef()
 	return _i->accelerationLinearEcef;
 }
 
+bool CompositeData::tryAccelerationLinearEcef(vec3f& value) VN_NOEXCEPT
+{
+	if (!hasAccelerationLinearEcef())
+		return false;
+
+	value = _i->accelerationLinearEcef;
+
+	return true;
+}
+
 bool CompositeData::hasAccelerationNed()
 {
-	return _i->hasAccelerationNed;
+	return _i->has(Impl::CDHAS_AccelerationNed);
 }
 
 vec3f CompositeData::accelerationNed()
@@ -1151,9 +1213,19 @@ vec3f CompositeData::accelerationNed()
 	return _i->accelerationNed;
 }
 
+bool CompositeData::tryAccelerationNed(vec3f& value) VN_NOEXCEPT
+{
+	if (!hasAccelerationNed())
+		return false;
+
+	value = _i->accelerationNed;
+
+	return true;
+}
+
 bool CompositeData::hasAccelerationEcef()
 {
-	return _i->hasAccelerationEcef;
+	return _i->has(Impl::CDHAS_AccelerationEcef);
 }
 
 vec3f CompositeData::accelerationEcef()
@@ -1164,6 +1236,16 @@ vec3f CompositeData::accelerationEcef()
 	return _i->accelerationEcef;
 }
 
+bool CompositeData::tryAccelerationEcef(vec3f& value) VN_NOEXCEPT
+{
+	if (!hasAccelerationEcef())
+		return false;
+
+	value = _i->accelerationEcef;
+
+	return true;
+}
+
 
 bool CompositeData::hasAnyAngularRate()
 {
@@ -1185,9 +1267,26 @@ vec3f CompositeData::anyAngularRate()
 	}
 }
 
+bool CompositeData::tryAnyAngularRate(vec3f& value) VN_NOEXCEPT
+{
+	switch (_i->mostRecentlyUpdatedAngularRateType)
+	{
+	case Impl::CDANR_None:
+		return false;
+	case Impl::CDANR_Normal:
+		value = _i->angularRate;
+		return true;
+	case Impl::CDANR_Uncompensated:
+		value = _i->angularRateUncompensated;
+		return true;
+	default:
+		return false;
+	}
+}
+
 bool CompositeData::hasAngularRate()
 {
-	return _i->hasAngularRate;
+	return _i->has(Impl::CDHAS_AngularRate);
 }
 
 vec3f CompositeData::angularRate()
@@ -1198,9 +1297,19 @@ vec3f CompositeData::angularRate()
 	return _i->angularRate;
 }
 
+bool CompositeData::tryAngularRate(vec3f& value) VN_NOEXCEPT
+{
+	if (!hasAngularRate())
+		return false;
+
+	value = _i->angularRate;
+
+	return true;
+}
+
 bool CompositeData::hasAngularRateUncompensated()
 {
-	return _i->hasAngularRateUncompensated;
+	return _i->has(Impl::CDHAS_AngularRateUncompensated);
 }
 
 vec3f CompositeData::angularRateUncompensated()
@@ -1211,6 +1320,16 @@ vec3f CompositeData::angularRateUncompensated()
 	return _i->angularRateUncompensated;
 }
 
+bool CompositeData::tryAngularRateUncompensated(vec3f& value) VN_NOEXCEPT
+{
+	if (!hasAngularRateUncompensated())
+		return false;
+
+	value = _i->angularRateUncompensated;
+
+	return true;
+}
+
 
 bool CompositeData::hasAnyTemperature()
 {
@@ -1230,9 +1349,23 @@ float CompositeData::anyTemperature()
 	}
 }
 
+bool CompositeData::tryAnyTemperature(float& value) VN_NOEXCEPT
+{
+	switch (_i->mostRecentlyUpdatedTemperatureType)
+	{
+	case Impl::CDTEM_None:
+		return false;
+	case Impl::CDTEM_Normal:
+		value = _i->temperature;
+		return true;
+	default:
+		return false;
+	}
+}
+
 bool CompositeData::hasTemperature()
 {
-	return _i->hasTemperature;
+	return _i->has(Impl::CDHAS_Temperature);
 }
 
 float CompositeData::temperature()
@@ -1243,6 +1376,16 @@ float CompositeData::temperature()
 	return _i->temperature;
 }
 
+bool CompositeData::tryTemperature(float& value) VN_NOEXCEPT
+{
+	if (!hasTemperature())
+		return false;
+
+	value = _i->temperature;
+
+	return true;
+}
+
 
 bool CompositeData::hasAnyPressure()
 {
@@ -1262,9 +1405,23 @@ float CompositeData::anyPressure()
 	}
 }
 
+bool CompositeData::tryAnyPressure(float& value) VN_NOEXCEPT
+{
+	switch (_i->mostRecentlyUpdatePressureType)
+	{
+	case Impl::CDPRE_None:
+		return false;
+	case Impl::CDPRE_Normal:
+		value = _i->pressure;
+		return true;
+	default:
+		return false;
+	}
+}
+
 bool CompositeData::hasPressure()
 {
-	return _i->hasPressure;
+	return _i->has(Impl::CDHAS_Pressure);
 }
 
 float CompositeData::pressure()
@@ -1275,6 +1432,16 @@ float CompositeData::pressure()
 	return _i->pressure;
 }
 
+bool CompositeData::tryPressure(float& value) VN_NOEXCEPT
+{
+	if (!hasPressure())
+		return false;
+
+	value = _i->pressure;
+
+	return true;
+}
+
 bool CompositeData::hasAnyPosition()
 {
 	return _i->mostRecentlyUpdatedPositionType != Impl::CDPOS_None;
@@ -1303,14 +1470,43 @@ PositionD CompositeData::anyPosition()
 	}
 }
 
+bool CompositeData::tryAnyPosition(PositionD& value) VN_NOEXCEPT
+{
+	switch (_i->mostRecentlyUpdatedPositionType)
+	{
+	case Impl::CDPOS_None:
+		return false;
+	case Impl::CDPOS_GpsLla:
+		value = PositionD::fromLla(_i->positionGpsLla);
+		return true;
+	case Impl::CDPOS_Gps2Lla:
+		value = PositionD::fromLla(_i->positionGps2Lla);
+		return true;
+	case Impl::CDPOS_GpsEcef:
+		value = PositionD::fromEcef(_i->positionGpsEcef);
+		return true;
+	case Impl::CDPOS_Gps2Ecef:
+		value = PositionD::fromEcef(_i->positionGps2Ecef);
+		return true;
+	case Impl::CDPOS_EstimatedLla:
+		value = PositionD::fromLla(_i->positionEstimatedLla);
+		return true;
+	case Impl::CDPOS_EstimatedEcef:
+		value = PositionD::fromEcef(_i->positionEstimatedEcef);
+		return true;
+	default:
+		return false;
+	}
+}
+
 bool CompositeData::hasPositionGpsLla()
 {
-  return _i->hasPositionGpsLla;
+  return _i->has(Impl::CDHAS_PositionGpsLla);
 }
 
 bool CompositeData::hasPositionGps2Lla()
 {
-  return _i->hasPositionGps2Lla;
+  return _i->has(Impl::CDHAS_PositionGps2Lla);
 }
 
 vec3d CompositeData::positionGpsLla()
@@ -1321,6 +1517,16 @@ vec3d CompositeData::positionGpsLla()
   return _i->positionGpsLla;
 }
 
+bool CompositeData::tryPositionGpsLla(vec3d& value) VN_NOEXCEPT
+{
+	if (!hasPositionGpsLla())
+		return false;
+
+	value = _i->positionGpsLla;
+
+	return true;
+}
+
 vec3d CompositeData::positionGps2Lla()
 {
   if(!hasPositionGps2Lla())
@@ -1329,14 +1535,24 @@ vec3d CompositeData::positionGps2Lla()
   return _i->positionGps2Lla;
 }
 
+bool CompositeData::tryPositionGps2Lla(vec3d& value) VN_NOEXCEPT
+{
+	if (!hasPositionGps2Lla())
+		return false;
+
+	value = _i->positionGps2Lla;
+
+	return true;
+}
+
 bool CompositeData::hasPositionGpsEcef()
 {
-  return _i->hasPositionGpsEcef;
+  return _i->has(Impl::CDHAS_PositionGpsEcef);
 }
 
 bool CompositeData::hasPositionGps2Ecef()
 {
-  return _i->hasPositionGps2Ecef;
+  return _i->has(Impl::CDHAS_PositionGps2Ecef);
 }
 
 vec3d CompositeData::positionGpsEcef()
@@ -1346,6 +1562,17 @@ vec3d CompositeData::positionGpsEcef()
 
 	return _i->positionGpsEcef;
 }
+
+bool CompositeData::tryPositionGpsEcef(vec3d& value) VN_NOEXCEPT
+{
+	if (!hasPositionGpsEcef())
+		return false;
+
+	value = _i->positionGpsEcef;
+
+	return true;
+}
+
 vec3d CompositeData::positionGps2Ecef()
 {
 	if (!hasPositionGps2Ecef())
@@ -1354,9 +1581,19 @@ vec3d CompositeData::positionGps2Ecef()
 	return _i->positionGps2Ecef;
 }
 
+bool CompositeData::tryPositionGps2Ecef(vec3d& value) VN_NOEXCEPT
+{
+	if (!hasPositionGps2Ecef())
+		return false;
+
+	value = _i->positionGps2Ecef;
+
+	return true;
+}
+
 bool CompositeData::hasPositionEstimatedLla()
 {
-	return _i->hasPositionEstimatedLla;
+	return _i->has(Impl::CDHAS_PositionEstimatedLla);
 }
 
 vec3d CompositeData::positionEstimatedLla()
@@ -1367,9 +1604,19 @@ vec3d CompositeData::positionEstimatedLla()
 	return _i->positionEstimatedLla;
 }
 
+bool CompositeData::tryPositionEstimatedLla(vec3d& value) VN_NOEXCEPT
+{
+	if (!hasPositionEstimatedLla())
+		return false;
+
+	value = _i->positionEstimatedLla;
+
+	return true;
+}
+
 bool CompositeData::hasPositionEstimatedEcef()
 {
-	return _i->hasPositionEstimatedEcef;
+	return _i->has(Impl::CDHAS_PositionEstimatedEcef);
 }
 
 vec3d CompositeData::positionEstimatedEcef()
@@ -1380,6 +1627,16 @@ vec3d CompositeData::positionEstimatedEcef()
 	return _i->positionEstimatedEcef;
 }
 
+bool CompositeData::tryPositionEstimatedEcef(vec3d& value) VN_NOEXCEPT
+{
+	if (!hasPositionEstimatedEcef())
+		return false;
+
+	value = _i->positionEstimatedEcef;
+
+	return true;
+}
+
 bool CompositeData::hasAnyVelocity()
 {
 	return _i->mostRecentlyUpdatedVelocityType != Impl::CDVEL_None;
@@ -1410,14 +1667,46 @@ vec3f CompositeData::anyVelocity()
 	}
 }
 
+bool CompositeData::tryAnyVelocity(vec3f& value) VN_NOEXCEPT
+{
+	switch (_i->mostRecentlyUpdatedVelocityType)
+	{
+	case Impl::CDVEL_None:
+		return false;
+	case Impl::CDVEL_GpsNed:
+		value = _i->velocityGpsNed;
+		return true;
+	case Impl::CDVEL_Gps2Ned:
+		value = _i->velocityGps2Ned;
+		return true;
+	case Impl::CDVEL_GpsEcef:
+		value = _i->velocityGpsEcef;
+		return true;
+	case Impl::CDVEL_Gps2Ecef:
+		value = _i->velocityGps2Ecef;
+		return true;
+	case Impl::CDVEL_EstimatedNed:
+		value = _i->velocityEstimatedNed;
+		return true;
+	case Impl::CDVEL_EstimatedEcef:
+		value = _i->velocityEstimatedEcef;
+		return true;
+	case Impl::CDVEL_EstimatedBody:
+		value = _i->velocityEstimatedBody;
+		return true;
+	default:
+		return false;
+	}
+}
+
 bool CompositeData::hasVelocityGpsNed()
 {
-  return _i->hasVelocityGpsNed;
+  return _i->has(Impl::CDHAS_VelocityGpsNed);
 }
 
 bool CompositeData::hasVelocityGps2Ned()
 {
-  return _i->hasVelocityGps2Ned;
+  return _i->has(Impl::CDHAS_VelocityGps2Ned);
 }
 
 vec3f CompositeData::velocityGpsNed()
@@ -1428,6 +1717,16 @@ vec3f CompositeData::velocityGpsNed()
   return _i->velocityGpsNed;
 }
 
+bool CompositeData::tryVelocityGpsNed(vec3f& value) VN_NOEXCEPT
+{
+	if (!hasVelocityGpsNed())
+		return false;
+
+	value = _i->velocityGpsNed;
+
+	return true;
+}
+
 vec3f CompositeData::velocityGps2Ned()
 {
   if(!hasVelocityGps2Ned())
@@ -1436,14 +1735,24 @@ vec3f CompositeData::velocityGps2Ned()
   return _i->velocityGps2Ned;
 }
 
+bool CompositeData::tryVelocityGps2Ned(vec3f& value) VN_NOEXCEPT
+{
+	if (!hasVelocityGps2Ned())
+		return false;
+
+	value = _i->velocityGps2Ned;
+
+	return true;
+}
+
 bool CompositeData::hasVelocityGpsEcef()
 {
-  return _i->hasVelocityGpsEcef;
+  return _i->has(Impl::CDHAS_VelocityGpsEcef);
 }
 
 bool CompositeData::hasVelocityGps2Ecef()
 {
-  return _i->hasVelocityGps2Ecef;
+  return _i->has(Impl::CDHAS_VelocityGps2Ecef);
 }
 
 vec3f CompositeData::velocityGpsEcef()
@@ -1454,6 +1763,16 @@ vec3f CompositeData::velocityGpsEcef()
   return _i->velocityGpsEcef;
 }
 
+bool CompositeData::tryVelocityGpsEcef(vec3f& value) VN_NOEXCEPT
+{
+	if (!hasVelocityGpsEcef())
+		return false;
+
+	value = _i->velocityGpsEcef;
+
+	return true;
+}
+
 vec3f CompositeData::velocityGps2Ecef()
 {
   if(!hasVelocityGps2Ecef())
@@ -1462,9 +1781,19 @@ vec3f CompositeData::velocityGps2Ecef()
   return _i->velocityGps2Ecef;
 }
 
+bool CompositeData::tryVelocityGps2Ecef(vec3f& value) VN_NOEXCEPT
+{
+	if (!hasVelocityGps2Ecef())
+		return false;
+
+	value = _i->velocityGps2Ecef;
+
+	return true;
+}
+
 bool CompositeData::hasVelocityEstimatedNed()
 {
-	return _i->hasVelocityEstimatedNed;
+	return _i->has(Impl::CDHAS_VelocityEstimatedNed);
 }
 
 vec3f CompositeData::velocityEstimatedNed()
@@ -1475,9 +1804,19 @@ vec3f CompositeData::velocityEstimatedNed()
 	return _i->velocityEstimatedNed;
 }
 
+bool CompositeData::tryVelocityEstimatedNed(vec3f& value) VN_NOEXCEPT
+{
+	if (!hasVelocityEstimatedNed())
+		return false;
+
+	value = _i->velocityEstimatedNed;
+
+	return true;
+}
+
 bool CompositeData::hasVelocityEstimatedEcef()
 {
-	return _i->hasVelocityEstimatedEcef;
+	return _i->has(Impl::CDHAS_VelocityEstimatedEcef);
 }
 
 vec3f CompositeData::velocityEstimatedEcef()
@@ -1488,9 +1827,19 @@ vec3f CompositeData::velocityEstimatedEcef()
 	return _i->velocityEstimatedEcef;
 }
 
+bool CompositeData::tryVelocityEstimatedEcef(vec3f& value) VN_NOEXCEPT
+{
+	if (!hasVelocityEstimatedEcef())
+		return false;
+
+	value = _i->velocityEstimatedEcef;
+
+	return true;
+}
+
 bool CompositeData::hasVelocityEstimatedBody()
 {
-	return _i->hasVelocityEstimatedBody;
+	return _i->has(Impl::CDHAS_VelocityEstimatedBody);
 }
 
 vec3f CompositeData::velocityEstimatedBody()
@@ -1501,9 +1850,19 @@ vec3f CompositeData::velocityEstimatedBody()
 	return _i->velocityEstimatedBody;
 }
 
+bool CompositeData::tryVelocityEstimatedBody(vec3f& value) VN_NOEXCEPT
+{
+	if (!hasVelocityEstimatedBody())
+		return false;
+
+	value = _i->velocityEstimatedBody;
+
+	return true;
+}
+
 bool CompositeData::hasDeltaTime()
 {
-	return _i->hasDeltaTime;
+	return _i->has(Impl::CDHAS_DeltaTime);
 }
 
 float CompositeData::deltaTime()
@@ -1514,9 +1873,19 @@ float CompositeData::deltaTime()
 	return _i->deltaTime;
 }
 
+bool CompositeData::tryDeltaTime(float& value) VN_NOEXCEPT
+{
+	if (!hasDeltaTime())
+		return false;
+
+	value = _i->deltaTime;
+
+	return true;
+}
+
 bool CompositeData::hasDeltaTheta()
 {
-	return _i->hasDeltaTheta;
+	return _i->has(Impl::CDHAS_DeltaTheta);
 }
 
 vec3f CompositeData::deltaTheta()
@@ -1527,9 +1896,19 @@ vec3f CompositeData::deltaTheta()
 	return _i->deltaTheta;
 }
 
+bool CompositeData::tryDeltaTheta(vec3f& value) VN_NOEXCEPT
+{
+	if (!hasDeltaTheta())
+		return false;
+
+	value = _i->deltaTheta;
+
+	return true;
+}
+
 bool CompositeData::hasDeltaVelocity()
 {
-	return _i->hasDeltaVelocity;
+	return _i->has(Impl::CDHAS_DeltaVelocity);
 }
 
 vec3f CompositeData::deltaVelocity()
@@ -1540,9 +1919,19 @@ vec3f CompositeData::deltaVelocity()
 	return _i->deltaVelocity;
 }
 
+bool CompositeData::tryDeltaVelocity(vec3f& value) VN_NOEXCEPT
+{
+	if (!hasDeltaVelocity())
+		return false;
+
+	value = _i->deltaVelocity;
+
+	return true;
+}
+
 bool CompositeData::hasTimeStartup()
 {
-	return _i->hasTimeStartup;
+	return _i->has(Impl::CDHAS_TimeStartup);
 }
 
 uint64_t CompositeData::timeStartup()
@@ -1553,14 +1942,24 @@ uint64_t CompositeData::timeStartup()
 	return _i->timeStartup;
 }
 
+bool CompositeData::tryTimeStartup(uint64_t& value) VN_NOEXCEPT
+{
+	if (!hasTimeStartup())
+		return false;
+
+	value = _i->timeStartup;
+
+	return true;
+}
+
 bool CompositeData::hasTimeGps()
 {
-  return _i->hasTimeGps;
+  return _i->has(Impl::CDHAS_TimeGps);
 }
 
 bool CompositeData::hasTimeGps2()
 {
-  return _i->hasTimeGps2;
+  return _i->has(Impl::CDHAS_TimeGps2);
 }
 
 uint64_t CompositeData::timeGps()
@@ -1571,6 +1970,16 @@ uint64_t CompositeData::timeGps()
   return _i->timeGps;
 }
 
+bool CompositeData::tryTimeGps(uint64_t& value) VN_NOEXCEPT
+{
+	if (!hasTimeGps())
+		return false;
+
+	value = _i->timeGps;
+
+	return true;
+}
+
 uint64_t CompositeData::timeGps2()
 {
   if(!hasTimeGps2())
@@ -1579,9 +1988,19 @@ uint64_t CompositeData::timeGps2()
   return _i->timeGps2;
 }
 
+bool CompositeData::tryTimeGps2(uint64_t& value) VN_NOEXCEPT
+{
+	if (!hasTimeGps2())
+		return false;
+
+	value = _i->timeGps2;
+
+	return true;
+}
+
 bool CompositeData::hasTow()
 {
-  return _i->hasTow;
+  return _i->has(Impl::CDHAS_Tow);
 }
 
 double CompositeData::tow()
@@ -1592,9 +2011,19 @@ double CompositeData::tow()
   return _i->tow;
 }
 
+bool CompositeData::tryTow(double& value) VN_NOEXCEPT
+{
+	if (!hasTow())
+		return false;
+
+	value = _i->tow;
+
+	return true;
+}
+
 bool CompositeData::hasWeek()
 {
-	return _i->hasWeek;
+	return _i->has(Impl::CDHAS_Week);
 }
 
 uint16_t CompositeData::week()
@@ -1605,9 +2034,19 @@ uint16_t CompositeData::week()
 	return _i->week;
 }
 
+bool CompositeData::tryWeek(uint16_t& value) VN_NOEXCEPT
+{
+	if (!hasWeek())
+		return false;
+
+	value = _i->week;
+
+	return true;
+}
+
 bool CompositeData::hasNumSats()
 {
-	return _i->hasNumSats;
+	return _i->has(Impl::CDHAS_NumSats);
 }
 
 uint8_t CompositeData::numSats()
@@ -1618,9 +2057,19 @@ uint8_t CompositeData::numSats()
 	return _i->numSats;
 }
 
+bool CompositeData::tryNumSats(uint8_t& value) VN_NOEXCEPT
+{
+	if (!hasNumSats())
+		return false;
+
+	value = _i->numSats;
+
+	return true;
+}
+
 bool CompositeData::hasTimeSyncIn()
 {
-	return _i->hasTimeSyncIn;
+	return _i->has(Impl::CDHAS_TimeSyncIn);
 }
 
 uint64_t CompositeData::timeSyncIn()
@@ -1631,9 +2080,19 @@ uint64_t CompositeData::timeSyncIn()
 	return _i->timeSyncIn;
 }
 
+bool CompositeData::tryTimeSyncIn(uint64_t& value) VN_NOEXCEPT
+{
+	if (!hasTimeSyncIn())
+		return false;
+
+	value = _i->timeSyncIn;
+
+	return true;
+}
+
 bool CompositeData::hasVpeStatus()
 {
-	return _i->hasVpeStatus;
+	return _i->has(Impl::CDHAS_VpeStatus);
 }
 
 VpeStatus CompositeData::vpeStatus()
@@ -1644,9 +2103,19 @@ VpeStatus CompositeData::vpeStatus()
 	return _i->vpeStatus;
 }
 
+bool CompositeData::tryVpeStatus(VpeStatus& value) VN_NOEXCEPT
+{
+	if (!hasVpeStatus())
+		return false;
+
+	value = _i->vpeStatus;
+
+	return true;
+}
+
 bool CompositeData::hasInsStatus()
 {
-	return _i->hasInsStatus;
+	return _i->has(Impl::CDHAS_InsStatus);
 }
 
 InsStatus CompositeData::insStatus()
@@ -1657,9 +2126,19 @@ InsStatus CompositeData::insStatus()
 	return _i->insStatus;
 }
 
+bool CompositeData::tryInsStatus(InsStatus& value) VN_NOEXCEPT
+{
+	if (!hasInsStatus())
+		return false;
+
+	value = _i->insStatus;
+
+	return true;
+}
+
 bool CompositeData::hasSyncInCnt()
 {
-	return _i->hasSyncInCnt;
+	return _i->has(Impl::CDHAS_SyncInCnt);
 }
 
 uint32_t CompositeData::syncInCnt()
@@ -1670,9 +2149,19 @@ uint32_t CompositeData::syncInCnt()
 	return _i->syncInCnt;
 }
 
+bool CompositeData::trySyncInCnt(uint32_t& value) VN_NOEXCEPT
+{
+	if (!hasSyncInCnt())
+		return false;
+
+	value = _i->syncInCnt;
+
+	return true;
+}
+
 bool CompositeData::hasSyncOutCnt()
 {
-  return _i->hasSyncOutCnt;
+  return _i->has(Impl::CDHAS_SyncOutCnt);
 }
 
 uint32_t CompositeData::syncOutCnt()
@@ -1683,9 +2172,19 @@ uint32_t CompositeData::syncOutCnt()
   return _i->syncOutCnt;
 }
 
+bool CompositeData::trySyncOutCnt(uint32_t& value) VN_NOEXCEPT
+{
+	if (!hasSyncOutCnt())
+		return false;
+
+	value = _i->syncOutCnt;
+
+	return true;
+}
+
 bool CompositeData::hasTimeStatus()
 {
-  return _i->hasTimeStatus;
+  return _i->has(Impl::CDHAS_TimeStatus);
 }
 
 uint8_t CompositeData::timeStatus()
@@ -1696,14 +2195,24 @@ uint8_t CompositeData::timeStatus()
   return _i->timeStatus;
 }
 
+bool CompositeData::tryTimeStatus(uint8_t& value) VN_NOEXCEPT
+{
+	if (!hasTimeStatus())
+		return false;
+
+	value = _i->timeStatus;
+
+	return true;
+}
+
 bool CompositeData::hasTimeGpsPps()
 {
-  return _i->hasTimeGpsPps;
+  return _i->has(Impl::CDHAS_TimeGpsPps);
 }
 
 bool CompositeData::hasTimeGps2Pps()
 {
-  return _i->hasTimeGps2Pps;
+  return _i->has(Impl::CDHAS_TimeGps2Pps);
 }
 
 uint64_t CompositeData::timeGpsPps()
@@ -1714,6 +2223,16 @@ uint64_t CompositeData::timeGpsPps()
 	return _i->timeGpsPps;
 }
 
+bool CompositeData::tryTimeGpsPps(uint64_t& value) VN_NOEXCEPT
+{
+	if (!hasTimeGpsPps())
+		return false;
+
+	value = _i->timeGpsPps;
+
+	return true;
+}
+
 uint64_t CompositeData::timeGps2Pps()
 {
   if(!hasTimeGps2Pps())
@@ -1722,14 +2241,24 @@ uint64_t CompositeData::timeGps2Pps()
   return _i->timeGps2Pps;
 }
 
+bool CompositeData::tryTimeGps2Pps(uint64_t& value) VN_NOEXCEPT
+{
+	if (!hasTimeGps2Pps())
+		return false;
+
+	value = _i->timeGps2Pps;
+
+	return true;
+}
+
 bool CompositeData::hasGpsTow()
 {
-  return _i->hasGpsTow;
+  return _i->has(Impl::CDHAS_GpsTow);
 }
 
 bool CompositeData::hasGps2Tow()
 {
-  return _i->hasGps2Tow;
+  return _i->has(Impl::CDHAS_Gps2Tow);
 }
 
 uint64_t CompositeData::gpsTow()
@@ -1740,6 +2269,16 @@ uint64_t CompositeData::gpsTow()
   return _i->gpsTow;
 }
 
+bool CompositeData::tryGpsTow(uint64_t& value) VN_NOEXCEPT
+{
+	if (!hasGpsTow())
+		return false;
+
+	value = _i->gpsTow;
+
+	return true;
+}
+
 uint64_t CompositeData::gps2Tow()
 {
   if(!hasGps2Tow())
@@ -1748,9 +2287,19 @@ uint64_t CompositeData::gps2Tow()
   return _i->gps2Tow;
 }
 
+bool CompositeData::tryGps2Tow(uint64_t& value) VN_NOEXCEPT
+{
+	if (!hasGps2Tow())
+		return false;
+
+	value = _i->gps2Tow;
+
+	return true;
+}
+
 bool CompositeData::hasTimeUtc()
 {
-	return _i->hasTimeUtc;
+	return _i->has(Impl::CDHAS_TimeUtc);
 }
 
 TimeUtc CompositeData::timeUtc()
@@ -1761,9 +2310,19 @@ TimeUtc CompositeData::timeUtc()
 	return _i->timeUtc;
 }
 
+bool CompositeData::tryTimeUtc(TimeUtc& value) VN_NOEXCEPT
+{
+	if (!hasTimeUtc())
+		return false;
+
+	value = _i->timeUtc;
+
+	return true;
+}
+
 bool CompositeData::hasSensSat()
 {
-	return _i->hasSensSat;
+	return _i->has(Impl::CDHAS_SensSat);
 }
 
 SensSat CompositeData::sensSat()
@@ -1774,14 +2333,24 @@ SensSat CompositeData::sensSat()
 	return _i->sensSat;
 }
 
+bool CompositeData::trySensSat(SensSat& value) VN_NOEXCEPT
+{
+	if (!hasSensSat())
+		return false;
+
+	value = _i->sensSat;
+
+	return true;
+}
+
 bool CompositeData::hasFix()
 {
-  return _i->hasFix;
+  return _i->has(Impl::CDHAS_Fix);
 }
 
 bool CompositeData::hasFix2()
 {
-  return _i->hasFix2;
+  return _i->has(Impl::CDHAS_Fix2);
 }
 
 GpsFix CompositeData::fix()
@@ -1792,6 +2361,16 @@ GpsFix CompositeData::fix()
   return _i->fix;
 }
 
+bool CompositeData::tryFix(GpsFix& value) VN_NOEXCEPT
+{
+	if (!hasFix())
+		return false;
+
+	value = _i->fix;
+
+	return true;
+}
+
 GpsFix CompositeData::fix2()
 {
   if(!hasFix2())
@@ -1800,6 +2379,16 @@ GpsFix CompositeData::fix2()
   return _i->fix2;
 }
 
+bool CompositeData::tryFix2(GpsFix& value) VN_NOEXCEPT
+{
+	if (!hasFix2())
+		return false;
+
+	value = _i->fix2;
+
+	return true;
+}
+
 bool CompositeData::hasAnyPositionUncertainty()
 {
 	return _i->mostRecentlyUpdatedPositionUncertaintyType != Impl::CDPOU_None;
@@ -1826,14 +2415,40 @@ vec3f CompositeData::anyPositionUncertainty()
 	}
 }
 
+bool CompositeData::tryAnyPositionUncertainty(vec3f& value) VN_NOEXCEPT
+{
+	switch (_i->mostRecentlyUpdatedPositionUncertaintyType)
+	{
+	case Impl::CDPOU_None:
+		return false;
+	case Impl::CDPOU_GpsNed:
+		value = _i->positionUncertaintyGpsNed;
+		return true;
+	case Impl::CDPOU_Gps2Ned:
+		value = _i->positionUncertaintyGps2Ned;
+		return true;
+	case Impl::CDPOU_GpsEcef:
+		value = _i->positionUncertaintyGpsEcef;
+		return true;
+	case Impl::CDPOU_Gps2Ecef:
+		value = _i->positionUncertaintyGps2Ecef;
+		return true;
+	case Impl::CDPOU_Estimated:
+		value = vec3f(_i->positionUncertaintyEstimated);
+		return true;
+	default:
+		return false;
+	}
+}
+
 bool CompositeData::hasPositionUncertaintyGpsNed()
 {
-  return _i->hasPositionUncertaintyGpsNed;
+  return _i->has(Impl::CDHAS_PositionUncertaintyGpsNed);
 }
 
 bool CompositeData::hasPositionUncertaintyGps2Ned()
 {
-  return _i->hasPositionUncertaintyGps2Ned;
+  return _i->has(Impl::CDHAS_PositionUncertaintyGps2Ned);
 }
 
 vec3f CompositeData::positionUncertaintyGpsNed()
@@ -1844,6 +2459,16 @@ vec3f CompositeData::positionUncertaintyGpsNed()
   return _i->positionUncertaintyGpsNed;
 }
 
+bool CompositeData::tryPositionUncertaintyGpsNed(vec3f& value) VN_NOEXCEPT
+{
+	if (!hasPositionUncertaintyGpsNed())
+		return false;
+
+	value = _i->positionUncertaintyGpsNed;
+
+	return true;
+}
+
 vec3f CompositeData::positionUncertaintyGps2Ned()
 {
   if(!hasPositionUncertaintyGps2Ned())
@@ -1852,14 +2477,24 @@ vec3f CompositeData::positionUncertaintyGps2Ned()
   return _i->positionUncertaintyGps2Ned;
 }
 
+bool CompositeData::tryPositionUncertaintyGps2Ned(vec3f& value) VN_NOEXCEPT
+{
+	if (!hasPositionUncertaintyGps2Ned())
+		return false;
+
+	value = _i->positionUncertaintyGps2Ned;
+
+	return true;
+}
+
 bool CompositeData::hasPositionUncertaintyGpsEcef()
 {
-  return _i->hasPositionUncertaintyGpsEcef;
+  return _i->has(Impl::CDHAS_PositionUncertaintyGpsEcef);
 }
 
 bool CompositeData::hasPositionUncertaintyGps2Ecef()
 {
-  return _i->hasPositionUncertaintyGps2Ecef;
+  return _i->has(Impl::CDHAS_PositionUncertaintyGps2Ecef);
 }
 
 vec3f CompositeData::positionUncertaintyGpsEcef()
@@ -1870,6 +2505,16 @@ vec3f CompositeData::positionUncertaintyGpsEcef()
   return _i->positionUncertaintyGpsEcef;
 }
 
+bool CompositeData::tryPositionUncertaintyGpsEcef(vec3f& value) VN_NOEXCEPT
+{
+	if (!hasPositionUncertaintyGpsEcef())
+		return false;
+
+	value = _i->positionUncertaintyGpsEcef;
+
+	return true;
+}
+
 vec3f CompositeData::positionUncertaintyGps2Ecef()
 {
   if(!hasPositionUncertaintyGps2Ecef())
@@ -1878,9 +2523,19 @@ vec3f CompositeData::positionUncertaintyGps2Ecef()
   return _i->positionUncertaintyGps2Ecef;
 }
 
+bool CompositeData::tryPositionUncertaintyGps2Ecef(vec3f& value) VN_NOEXCEPT
+{
+	if (!hasPositionUncertaintyGps2Ecef())
+		return false;
+
+	value = _i->positionUncertaintyGps2Ecef;
+
+	return true;
+}
+
 bool CompositeData::hasPositionUncertaintyEstimated()
 {
-	return _i->hasPositionUncertaintyEstimated;
+	return _i->has(Impl::CDHAS_PositionUncertaintyEstimated);
 }
 
 float CompositeData::positionUncertaintyEstimated()
@@ -1891,6 +2546,16 @@ float CompositeData::positionUncertaintyEstimated()
 	return _i->positionUncertaintyEstimated;
 }
 
+bool CompositeData::tryPositionUncertaintyEstimated(float& value) VN_NOEXCEPT
+{
+	if (!hasPositionUncertaintyEstimated())
+		return false;
+
+	value = _i->positionUncertaintyEstimated;
+
+	return true;
+}
+
 bool CompositeData::hasAnyVelocityUncertainty()
 {
 	return _i->mostRecentlyUpdatedVelocityUncertaintyType != Impl::CDVEU_None;
@@ -1913,14 +2578,34 @@ float CompositeData::anyVelocityUncertainty()
 	}
 }
 
+bool CompositeData::tryAnyVelocityUncertainty(float& value) VN_NOEXCEPT
+{
+	switch (_i->mostRecentlyUpdatedVelocityUncertaintyType)
+	{
+	case Impl::CDVEU_None:
+		return false;
+	case Impl::CDVEU_Gps:
+		value = _i->velocityUncertaintyGps;
+		return true;
+	case Impl::CDVEU_Gps2:
+		value = _i->velocityUncertaintyGps2;
+		return true;
+	case Impl::CDVEU_Estimated:
+		value = _i->velocityUncertaintyEstimated;
+		return true;
+	default:
+		return false;
+	}
+}
+
 bool CompositeData::hasVelocityUncertaintyGps()
 {
-  return _i->hasVelocityUncertaintyGps;
+  return _i->has(Impl::CDHAS_VelocityUncertaintyGps);
 }
 
 bool CompositeData::hasVelocityUncertaintyGps2()
 {
-  return _i->hasVelocityUncertaintyGps2;
+  return _i->has(Impl::CDHAS_VelocityUncertaintyGps2);
 }
 
 float CompositeData::velocityUncertaintyGps()
@@ -1931,6 +2616,16 @@ float CompositeData::velocityUncertaintyGps()
 	return _i->velocityUncertaintyGps;
 }
 
+bool CompositeData::tryVelocityUncertaintyGps(float& value) VN_NOEXCEPT
+{
+	if (!hasVelocityUncertaintyGps())
+		return false;
+
+	value = _i->velocityUncertaintyGps;
+
+	return true;
+}
+
 float CompositeData::velocityUncertaintyGps2()
 {
   if(!hasVelocityUncertaintyGps2())
@@ -1939,9 +2634,19 @@ float CompositeData::velocityUncertaintyGps2()
   return _i->velocityUncertaintyGps2;
 }
 
+bool CompositeData::tryVelocityUncertaintyGps2(float& value) VN_NOEXCEPT
+{
+	if (!hasVelocityUncertaintyGps2())
+		return false;
+
+	value = _i->velocityUncertaintyGps2;
+
+	return true;
+}
+
 bool CompositeData::hasVelocityUncertaintyEstimated()
 {
-	return _i->hasVelocityUncertaintyEstimated;
+	return _i->has(Impl::CDHAS_VelocityUncertaintyEstimated);
 }
 
 float CompositeData::velocityUncertaintyEstimated()
@@ -1952,9 +2657,19 @@ float CompositeData::velocityUncertaintyEstimated()
 	return _i->velocityUncertaintyEstimated;
 }
 
+bool CompositeData::tryVelocityUncertaintyEstimated(float& value) VN_NOEXCEPT
+{
+	if (!hasVelocityUncertaintyEstimated())
+		return false;
+
+	value = _i->velocityUncertaintyEstimated;
+
+	return true;
+}
+
 bool CompositeData::hasTimeUncertainty()
 {
-	return _i->hasTimeUncertainty;
+	return _i->has(Impl::CDHAS_TimeUncertainty);
 }
 
 uint32_t CompositeData::timeUncertainty()
@@ -1965,9 +2680,19 @@ uint32_t CompositeData::timeUncertainty()
 	return _i->timeUncertainty;
 }
 
+bool CompositeData::tryTimeUncertainty(uint32_t& value) VN_NOEXCEPT
+{
+	if (!hasTimeUncertainty())
+		return false;
+
+	value = _i->timeUncertainty;
+
+	return true;
+}
+
 bool CompositeData::hasAttitudeUncertainty()
 {
-	return _i->hasAttitudeUncertainty;
+	return _i->has(Impl::CDHAS_AttitudeUncertainty);
 }
 
 vec3f CompositeData::attitudeUncertainty()
@@ -1978,6 +2703,16 @@ vec3f CompositeData::attitudeUncertainty()
 	return _i->attitudeUncertainty;
 }
 
+bool CompositeData::tryAttitudeUncertainty(vec3f& value) VN_NOEXCEPT
+{
+	if (!hasAttitudeUncertainty())
+		return false;
+
+	value = _i->attitudeUncertainty;
+
+	return true;
+}
+
 bool CompositeData::hasCourseOverGround()
 {
   return _i->mostRecentlyUpdatedVelocityType != Impl::CDVEL_None
@@ -2005,6 +2740,27 @@ float CompositeData::courseOverGround()
 	}
 }
 
+bool CompositeData::tryCourseOverGround(float& value) VN_NOEXCEPT
+{
+	if (!hasCourseOverGround())
+		return false;
+
+	switch (_i->mostRecentlyUpdatedVelocityType)
+	{
+	case Impl::CDVEL_GpsNed:
+		value = course_over_ground(_i->velocityGpsNed);
+		return true;
+	case Impl::CDVEL_Gps2Ned:
+		value = course_over_ground(_i->velocityGps2Ned);
+		return true;
+	case Impl::CDVEL_EstimatedNed:
+		value = course_over_ground(_i->velocityEstimatedNed);
+		return true;
+	default:
+		return false;
+	}
+}
+
 bool CompositeData::hasSpeedOverGround()
 {
   return _i->mostRecentlyUpdatedVelocityType != Impl::CDVEL_None
@@ -2032,9 +2788,30 @@ float CompositeData::speedOverGround()
 	}
 }
 
+bool CompositeData::trySpeedOverGround(float& value) VN_NOEXCEPT
+{
+	if (!hasSpeedOverGround())
+		return false;
+
+	switch (_i->mostRecentlyUpdatedVelocityType)
+	{
+	case Impl::CDVEL_GpsNed:
+		value = speed_over_ground(_i->velocityGpsNed);
+		return true;
+	case Impl::CDVEL_Gps2Ned:
+		value = speed_over_ground(_i->velocityGps2Ned);
+		return true;
+	case Impl::CDVEL_EstimatedNed:
+		value = speed_over_ground(_i->velocityEstimatedNed);
+		return true;
+	default:
+		return false;
+	}
+}
+
 bool CompositeData::hasTimeInfo()
 {
-  return _i->hasTimeInfo;
+  return _i->has(Impl::CDHAS_TimeInfo);
 }
 
 TimeInfo CompositeData::timeInfo()
@@ -2045,9 +2822,42 @@ TimeInfo CompositeData::timeInfo()
   return _i->timeInfo;
 }
 
+bool CompositeData::tryTimeInfo(TimeInfo& value) VN_NOEXCEPT
+{
+	if (!hasTimeInfo())
+		return false;
+
+	value = _i->timeInfo;
+
+	return true;
+}
+
+bool CompositeData::hasTimeInfo2()
+{
+  return _i->has(Impl::CDHAS_TimeInfo2);
+}
+
+TimeInfo CompositeData::timeInfo2()
+{
+  if (!hasTimeInfo2())
+    throw invalid_operation();
+
+  return _i->timeInfo2;
+}
+
+bool CompositeData::tryTimeInfo2(TimeInfo& value) VN_NOEXCEPT
+{
+	if (!hasTimeInfo2())
+		return false;
+
+	value = _i->timeInfo2;
+
+	return true;
+}
+
 bool CompositeData::hasDop()
 {
-  return _i->hasDop;
+  return _i->has(Impl::CDHAS_Dop);
 }
 
 GnssDop CompositeData::dop()
@@ -2058,7 +2868,17 @@ GnssDop CompositeData::dop()
   return _i->dop;
 }
 
-CompositeData CompositeData::parse(Packet& p)
+bool CompositeData::tryDop(GnssDop& value) VN_NOEXCEPT
+{
+	if (!hasDop())
+		return false;
+
+	value = _i->dop;
+
+	return true;
+}
+
+CompositeData CompositeData::parse(PacketView& p)
 {
 	CompositeData o;
 
@@ -2067,22 +2887,110 @@ CompositeData CompositeData::parse(Packet& p)
 	return o;
 }
 
-void CompositeData::parse(Packet& p, CompositeData& o)
+void CompositeData::parse(PacketView& p, CompositeData& o)
+{
+	CompositeData* t = &o;
+
+	parse(p, &t, 1);
+}
+
+void CompositeData::parse(PacketView& p, CompositeData& o1, CompositeData& o2)
+{
+	CompositeData* t[2] = { &o1, &o2 };
+
+	parse(p, t, 2);
+}
+
+void CompositeData::parse(PacketView& p, CompositeData* const* o, size_t count)
+{
+	if (tryParse(p, o, count))
+		return;
+
+	if (p.type() == Packet::TYPE_BINARY)
+		// The packet is too short to hold the fields it announces.
+		throw invalid_operation();
+
+	if (p.type() == Packet::TYPE_ASCII)
+	{
+		// Throws if the packet is not an ASCII asynchronous message at all.
+		AsciiAsync type = p.determineAsciiAsyncType();
+
+		if (p.countAsciiFields() < asciiAsyncFieldCount(type))
+			// The message is missing some of its fields.
+			throw invalid_operation();
+	}
+
+	throw not_supported();
+}
+
+void CompositeData::parse(PacketView& p, vector<CompositeData*>& o)
+{
+	parse(p, o.empty() ? NULL : &o[0], o.size());
+}
+
+bool CompositeData::tryParse(PacketView& p, CompositeData& o) VN_NOEXCEPT
+{
+	CompositeData* t = &o;
+
+	return tryParse(p, &t, 1);
+}
+
+bool CompositeData::tryParse(PacketView& p, CompositeData& o1, CompositeData& o2) VN_NOEXCEPT
 {
-	vector<CompositeData*> v;
-	v.push_back(&o);
+	CompositeData* t[2] = { &o1, &o2 };
 
-	parse(p, v);
+	return tryParse(p, t, 2);
 }
 
-void CompositeData::parse(Packet& p, vector<CompositeData*>& o)
+bool CompositeData::tryParse(PacketView& p, CompositeData* const* o, size_t count) VN_NOEXCEPT
 {
+	if (p.length() == 0)
+		return false;
+
+	Targets t(o, count);
+
 	if (p.type() == Packet::TYPE_ASCII)
-		parseAscii(p, o);
-	else if (p.type() == Packet::TYPE_BINARY)
-		parseBinary(p, o);
-	else
-		throw not_supported();
+		return parseAscii(p, t);
+
+	if (p.type() == Packet::TYPE_BINARY && hasCompleteBinaryPayload(p))
+	{
+		// Every field has been checked to be within the packet so none of
+		// the extractions can fail, as long as they start from the first
+		// field even if the packet has been extracted from before.
+		p.setExtractLocation(0);
+
+		parseBinary(p, t);
+
+		return true;
+	}
+
+	return false;
+}
+
+bool CompositeData::hasCompleteBinaryPayload(PacketView& p)
+{
+	uint8_t groups = p.groups();
+
+	// The payload starts after the sync byte, the groups byte and a group
+	// field for every group present.
+	size_t length = 2;
+	for (uint8_t g = groups; g != 0; g &= g - 1)
+		length += sizeof(uint16_t);
+
+	// Make sure the group fields are present before reading them.
+	if (length + 2 > p.length())
+		return false;
+
+	size_t curGroupFieldIndex = 0;
+
+	for (size_t group = 0; group < 8; group++)
+	{
+		if (groups & (1 << group))
+			length += Packet::computeNumOfBytesForBinaryGroupPayload(static_cast<BinaryGroup>(1 << group), p.groupField(curGroupFieldIndex++));
+	}
+
+	// The payload must leave room for the trailing CRC.
+	return length + 2 <= p.length();
 }
 
 void CompositeData::reset()
@@ -2112,9 +3020,39 @@ AttitudeF CompositeData::anyAttitude()
 	}
 }
 
-void CompositeData::parseAscii(Packet& p, vector<CompositeData*>& o)
+bool CompositeData::tryAnyAttitude(AttitudeF& value) VN_NOEXCEPT
+{
+	switch (_i->mostRecentlyUpdatedAttitudeType)
+	{
+	case Impl::CDATT_None:
+		return false;
+	case Impl::CDATT_YawPitchRoll:
+		value = AttitudeF::fromYprInDegs(_i->yawPitchRoll);
+		return true;
+	case Impl::CDATT_Quaternion:
+		value = AttitudeF::fromQuat(_i->quaternion);
+		return true;
+	case Impl::CDATT_DirectionCosineMatrix:
+		value = AttitudeF::fromDcm(_i->directionConsineMatrix);
+		return true;
+	default:
+		return false;
+	}
+}
+
+bool CompositeData::parseAscii(PacketView& p, const Targets& o)
 {
-	switch (p.determineAsciiAsyncType())
+	AsciiAsync type;
+
+	if (!p.tryDetermineAsciiAsyncType(type))
+		return false;
+
+	// The parse routines stop at the first missing field, so leave the
+	// targets alone unless the message holds every field.
+	if (p.countAsciiFields() < asciiAsyncFieldCount(type))
+		return false;
+
+	switch (type)
 	{
 
 	case VNYPR:
@@ -2141,6 +3079,90 @@ void CompositeData::parseAscii(Packet& p, vector<CompositeData*>& o)
 		break;
 	}
 
+	#ifdef INTERNAL
+	case VNQTM:
+	{
+		vec4f quat;
+		vec3f mag;
+
+		p.parseVNQTM(&quat, &mag);
+
+		for (cditer i = o.begin(); i != o.end(); ++i)
+		{
+			(*i)->_i->setQuaternion(quat);
+			(*i)->_i->setMagnetic(mag);
+		}
+
+		break;
+	}
+
+	case VNQTA:
+	{
+		vec4f quat;
+		vec3f accel;
+
+		p.parseVNQTA(&quat, &accel);
+
+		for (cditer i = o.begin(); i != o.end(); ++i)
+		{
+			(*i)->_i->setQuaternion(quat);
+			(*i)->_i->setAcceleration(accel);
+		}
+
+		break;
+	}
+
+	case VNQTR:
+	{
+		vec4f quat;
+		vec3f ar;
+
+		p.parseVNQTR(&quat, &ar);
+
+		for (cditer i = o.begin(); i != o.end(); ++i)
+		{
+			(*i)->_i->setQuaternion(quat);
+			(*i)->_i->setAngularRate(ar);
+		}
+
+		break;
+	}
+
+	case VNQMA:
+	{
+		vec4f quat;
+		vec3f mag, accel;
+
+		p.parseVNQMA(&quat, &mag, &accel);
+
+		for (cditer i = o.begin(); i != o.end(); ++i)
+		{
+			(*i)->_i->setQuaternion(quat);
+			(*i)->_i->setMagnetic(mag);
+			(*i)->_i->setAcceleration(accel);
+		}
+
+		break;
+	}
+
+	case VNQAR:
+	{
+		vec4f quat;
+		vec3f accel, ar;
+
+		p.parseVNQAR(&quat, &accel, &ar);
+
+		for (cditer i = o.begin(); i != o.end(); ++i)
+		{
+			(*i)->_i->setQuaternion(quat);
+			(*i)->_i->setAcceleration(accel);
+			(*i)->_i->setAngularRate(ar);
+		}
+
+		break;
+	}
+	#endif
+
 
 	case VNQMR:
 	{
@@ -2160,6 +3182,20 @@ void CompositeData::parseAscii(Packet& p, vector<CompositeData*>& o)
 		break;
 	}
 
+	#ifdef INTERNAL
+	case VNDCM:
+	{
+		mat3f dcm;
+
+		p.parseVNDCM(&dcm);
+
+		for (cditer i = o.begin(); i != o.end(); ++i)
+			(*i)->_i->setDirectionConsineMatrix(dcm);
+
+		break;
+	}
+	#endif
+
 
 	case VNMAG:
 	{
@@ -2230,6 +3266,27 @@ void CompositeData::parseAscii(Packet& p, vector<CompositeData*>& o)
 		break;
 	}
 
+	#ifdef INTERNAL
+	case VNYCM:
+	{
+		vec3f ypr, mag, accel, ar;
+		float temp;
+
+		p.parseVNYCM(&ypr, &mag, &accel, &ar, &temp);
+
+		for (cditer i = o.begin(); i != o.end(); ++i)
+		{
+			(*i)->_i->setYawPitchRoll(ypr);
+			(*i)->_i->setMagnetic(mag);
+			(*i)->_i->setAcceleration(accel);
+			(*i)->_i->setAngularRate(ar);
+			(*i)->_i->setTemperature(temp);
+		}
+
+		break;
+	}
+	#endif
+
 
 	case VNYBA:
 	{
@@ -2263,6 +3320,25 @@ void CompositeData::parseAscii(Packet& p, vector<CompositeData*>& o)
 		break;
 	}
 
+	#ifdef INTERNAL
+	case VNICM:
+	{
+		vec3f ypr, mag, accel, ar;
+
+		p.parseVNICM(&ypr, &mag, &accel, &ar);
+
+		for (cditer i = o.begin(); i != o.end(); ++i)
+		{
+			(*i)->_i->setYawPitchRoll(ypr);
+			(*i)->_i->setMagneticNed(mag);
+			(*i)->_i->setAccelerationNed(accel);
+			(*i)->_i->setAngularRate(ar);
+		}
+
+		break;
+	}
+	#endif
+
 
 	case VNIMU:
 	{
@@ -2500,14 +3576,50 @@ void CompositeData::parseAscii(Packet& p, vector<CompositeData*>& o)
 		break;
 	}
 
+	#ifdef INTERNAL
+	case VNCMV:
+	{
+		vec3f mag, accel, ar;
+		float temp;
+
+		p.parseVNCMV(&mag, &accel, &ar, &temp);
+
+		for (cditer i = o.begin(); i != o.end(); ++i)
+		{
+			(*i)->_i->setMagneticUncompensated(mag);
+			(*i)->_i->setAccelerationUncompensated(accel);
+			(*i)->_i->setAngularRateUncompensated(ar);
+			(*i)->_i->setTemperature(temp);
+		}
+
+		break;
+	}
+
+	case VNSTV:
+	{
+		vec4f quat;
+		vec3f arBias;
+
+		p.parseVNSTV(&quat, &arBias);
+
+		// There is no field for the angular rate bias estimate.
+		for (cditer i = o.begin(); i != o.end(); ++i)
+			(*i)->_i->setQuaternion(quat);
+
+		break;
+	}
+	#endif
+
 
 	default:
-		throw not_supported();
+		return false;
 
 	}
+
+	return true;
 }
 
-void CompositeData::parseBinary(Packet& p, vector<CompositeData*>& o)
+void CompositeData::parseBinary(PacketView& p, const Targets& o)
 {
 	BinaryGroup groups = static_cast<BinaryGroup>(p.groups());
 	size_t curGroupFieldIndex = 0;
@@ -2528,7 +3640,7 @@ void CompositeData::parseBinary(Packet& p, vector<CompositeData*>& o)
     parseBinaryPacketGps2Group(p, GpsGroup(p.groupField(curGroupFieldIndex++)), o);
 }
 
-void CompositeData::parseBinaryPacketCommonGroup(Packet& p, CommonGroup gf, vector<CompositeData*>& o)
+void CompositeData::parseBinaryPacketCommonGroup(PacketView& p, CommonGroup gf, const Targets& o)
 {
 	if (gf & COMMONGROUP_TIMESTARTUP)
 		setValues(p.extractUint64(), o, &Impl::setTimeStartup);
@@ -2594,7 +3706,7 @@ void CompositeData::parseBinaryPacketCommonGroup(Packet& p, CommonGroup gf, vect
 
 }
 
-void CompositeData::parseBinaryPacketTimeGroup(Packet& p, TimeGroup gf, vector<CompositeData*>& o)
+void CompositeData::parseBinaryPacketTimeGroup(PacketView& p, TimeGroup gf, const Targets& o)
 {
 	if (gf & TIMEGROUP_TIMESTARTUP)
 		setValues(p.extractUint64(), o, &Impl::setTimeStartup);
@@ -2639,7 +3751,7 @@ void CompositeData::parseBinaryPacketTimeGroup(Packet& p, TimeGroup gf, vector<C
     setValues(p.extractUint8(), o, &Impl::setTimeStatus);
 }
 
-void CompositeData::parseBinaryPacketImuGroup(Packet& p, ImuGroup gf, vector<CompositeData*>& o)
+void CompositeData::parseBinaryPacketImuGroup(PacketView& p, ImuGroup gf, const Targets& o)
 {
 	if (gf & IMUGROUP_IMUSTATUS)
 		// This field is currently reserved.
@@ -2683,7 +3795,7 @@ void CompositeData::parseBinaryPacketImuGroup(Packet& p, ImuGroup gf, vector<Com
 
 }
 
-void CompositeData::parseBinaryPacketGpsGroup(Packet& p, GpsGroup gf, vector<CompositeData*>& o)
+void CompositeData::parseBinaryPacketGpsGroup(PacketView& p, GpsGroup gf, const Targets& o)
 {
 	if (gf & GPSGROUP_UTC)
 	{
@@ -2759,7 +3871,7 @@ void CompositeData::parseBinaryPacketGpsGroup(Packet& p, GpsGroup gf, vector<Com
   }
 }
 
-void CompositeData::parseBinaryPacketAttitudeGroup(Packet& p, AttitudeGroup gf, vector<CompositeData*>& o)
+void CompositeData::parseBinaryPacketAttitudeGroup(PacketView& p, AttitudeGroup gf, const Targets& o)
 {
 	if (gf & ATTITUDEGROUP_VPESTATUS)
 		setValues(VpeStatus(p.extractUint16()), o, &Impl::setVpeStatus);
@@ -2790,7 +3902,7 @@ void CompositeData::parseBinaryPacketAttitudeGroup(Packet& p, AttitudeGroup gf,
 
 }
 
-void CompositeData::parseBinaryPacketInsGroup(Packet& p, InsGroup gf, vector<CompositeData*>& o)
+void CompositeData::parseBinaryPacketInsGroup(PacketView& p, InsGroup gf, const Targets& o)
 {
 	if (gf & INSGROUP_INSSTATUS)
 		setValues(InsStatus(p.extractUint16()), o, &Impl::setInsStatus);
@@ -2827,7 +3939,7 @@ void CompositeData::parseBinaryPacketInsGroup(Packet& p, InsGroup gf, vector<Com
 
 }
 
-void CompositeData::parseBinaryPacketGps2Group(Packet& p, GpsGroup gf, vector<CompositeData*>& o)
+void CompositeData::parseBinaryPacketGps2Group(PacketView& p, GpsGroup gf, const Targets& o)
 {
   if(gf & GPSGROUP_UTC) {
     TimeUtc t;
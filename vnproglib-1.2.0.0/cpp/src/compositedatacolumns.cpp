@@ -0,0 +1,674 @@
+#include "vn/compositedatacolumns.h"
+#include "vn/lazycompositedata.h"
+#include "vn/packet.h"
+#include "vn/utilities.h"
+#include "vn/exceptions.h"
+
+#include <cstring>
+
+using namespace std;
+using namespace vn::protocol::uart;
+
+namespace vn {
+namespace sensors {
+
+namespace {
+
+enum ColumnKind
+{
+	COLUMN_UINT8,
+	COLUMN_UINT16,
+	COLUMN_UINT32,
+	COLUMN_UINT64,
+	COLUMN_FLOAT,
+	COLUMN_DOUBLE,
+	COLUMN_TOW,
+	COLUMN_VPESTATUS,
+	COLUMN_INSSTATUS,
+	COLUMN_SENSSAT,
+	COLUMN_GPSFIX,
+	COLUMN_TIMEUTC,
+	COLUMN_TIMEINFO,
+	COLUMN_GNSSDOP
+};
+
+// A single array to fill, and the offset of its value in every packet.
+struct Column
+{
+	size_t offset;
+	ColumnKind kind;
+	void* values;
+
+	Column(size_t offset, ColumnKind kind, void* values) :
+		offset(offset),
+		kind(kind),
+		values(values)
+	{ }
+};
+
+// Returns the number of bytes in the header of a binary packet, or zero if
+// the data is not a binary packet or is too short to hold its header.
+size_t binaryHeaderLength(const char* packet, size_t length)
+{
+	if (length < 2 || packet[0] != (char) 0xFA)
+		return 0;
+
+	size_t headerLength = 2;
+	for (uint8_t g = static_cast<uint8_t>(packet[1]); g != 0; g &= g - 1)
+		headerLength += sizeof(uint16_t);
+
+	return length < headerLength ? 0 : headerLength;
+}
+
+template<typename T>
+void addComponents(vector<Column>& plan, size_t offset, ColumnKind kind, vector<T>* components, size_t count)
+{
+	for (size_t i = 0; i < count; i++)
+		plan.push_back(Column(offset + i * sizeof(T), kind, &components[i]));
+}
+
+template<typename T>
+T readRaw(const char* data)
+{
+	T v;
+
+	memcpy(&v, data, sizeof(T));
+
+	return v;
+}
+
+// Copies a value which is sent in the host's format, the same way the
+// Packet floating point extractors do.
+template<typename T>
+void decodeRaw(const char* const* packets, size_t count, size_t offset, void* values)
+{
+	vector<T>& c = *static_cast<vector<T>*>(values);
+
+	c.resize(count);
+
+	for (size_t i = 0; i < count; i++)
+		memcpy(&c[i], packets[i] + offset, sizeof(T));
+}
+
+// Copies an integer value, converting it from the sensor's byte order.
+template<typename T>
+void decodeInteger(const char* const* packets, size_t count, size_t offset, void* values)
+{
+	vector<T>& c = *static_cast<vector<T>*>(values);
+
+	c.resize(count);
+
+	for (size_t i = 0; i < count; i++)
+		c[i] = stoh(readRaw<T>(packets[i] + offset));
+}
+
+template<typename T, typename R>
+void decodeConverted(const char* const* packets, size_t count, size_t offset, void* values)
+{
+	vector<T>& c = *static_cast<vector<T>*>(values);
+
+	c.resize(count);
+
+	for (size_t i = 0; i < count; i++)
+		c[i] = T(stoh(readRaw<R>(packets[i] + offset)));
+}
+
+void decodeColumn(const char* const* packets, size_t count, const Column& column)
+{
+	size_t offset = column.offset;
+
+	switch (column.kind)
+	{
+	case COLUMN_UINT8:
+		decodeRaw<uint8_t>(packets, count, offset, column.values);
+		break;
+
+	case COLUMN_UINT16:
+		decodeInteger<uint16_t>(packets, count, offset, column.values);
+		break;
+
+	case COLUMN_UINT32:
+		decodeInteger<uint32_t>(packets, count, offset, column.values);
+		break;
+
+	case COLUMN_UINT64:
+		decodeInteger<uint64_t>(packets, count, offset, column.values);
+		break;
+
+	case COLUMN_FLOAT:
+		decodeRaw<float>(packets, count, offset, column.values);
+		break;
+
+	case COLUMN_DOUBLE:
+		decodeRaw<double>(packets, count, offset, column.values);
+		break;
+
+	case COLUMN_TOW:
+	{
+		vector<double>& c = *static_cast<vector<double>*>(column.values);
+
+		c.resize(count);
+
+		for (size_t i = 0; i < count; i++)
+			c[i] = (double)stoh(readRaw<uint64_t>(packets[i] + offset)) / 1000000000;
+
+		break;
+	}
+
+	case COLUMN_VPESTATUS:
+		decodeConverted<VpeStatus, uint16_t>(packets, count, offset, column.values);
+		break;
+
+	case COLUMN_INSSTATUS:
+		decodeConverted<InsStatus, uint16_t>(packets, count, offset, column.values);
+		break;
+
+	case COLUMN_SENSSAT:
+		decodeConverted<SensSat, uint16_t>(packets, count, offset, column.values);
+		break;
+
+	case COLUMN_GPSFIX:
+	{
+		vector<GpsFix>& c = *static_cast<vector<GpsFix>*>(column.values);
+
+		c.resize(count);
+
+		for (size_t i = 0; i < count; i++)
+			c[i] = GpsFix(readRaw<uint8_t>(packets[i] + offset));
+
+		break;
+	}
+
+	case COLUMN_TIMEUTC:
+	{
+		vector<TimeUtc>& c = *static_cast<vector<TimeUtc>*>(column.values);
+
+		c.resize(count);
+
+		for (size_t i = 0; i < count; i++)
+		{
+			const char* d = packets[i] + offset;
+
+			c[i].year = readRaw<int8_t>(d);
+			c[i].month = readRaw<uint8_t>(d + 1);
+			c[i].day = readRaw<uint8_t>(d + 2);
+			c[i].hour = readRaw<uint8_t>(d + 3);
+			c[i].min = readRaw<uint8_t>(d + 4);
+			c[i].sec = readRaw<uint8_t>(d + 5);
+			c[i].ms = stoh(readRaw<uint16_t>(d + 6));
+		}
+
+		break;
+	}
+
+	case COLUMN_TIMEINFO:
+	{
+		vector<TimeInfo>& c = *static_cast<vector<TimeInfo>*>(column.values);
+
+		c.resize(count);
+
+		for (size_t i = 0; i < count; i++)
+		{
+			c[i].timeStatus = readRaw<uint8_t>(packets[i] + offset);
+			c[i].leapSecs = readRaw<int8_t>(packets[i] + offset + 1);
+		}
+
+		break;
+	}
+
+	case COLUMN_GNSSDOP:
+	{
+		vector<GnssDop>& c = *static_cast<vector<GnssDop>*>(column.values);
+
+		c.resize(count);
+
+		for (size_t i = 0; i < count; i++)
+		{
+			const char* d = packets[i] + offset;
+
+			c[i].gDop = readRaw<float>(d);
+			c[i].pDop = readRaw<float>(d + 4);
+			c[i].tDop = readRaw<float>(d + 8);
+			c[i].vDop = readRaw<float>(d + 12);
+			c[i].hDop = readRaw<float>(d + 16);
+			c[i].nDop = readRaw<float>(d + 20);
+			c[i].eDop = readRaw<float>(d + 24);
+		}
+
+		break;
+	}
+	}
+}
+
+}
+
+CompositeDataColumns::CompositeDataColumns() :
+	_size(0)
+{
+}
+
+size_t CompositeDataColumns::size() const
+{
+	return _size;
+}
+
+void CompositeDataColumns::clear()
+{
+	for (size_t i = 0; i < 3; i++)
+		yawPitchRoll[i].clear();
+	for (size_t i = 0; i < 4; i++)
+		quaternion[i].clear();
+	for (size_t i = 0; i < 9; i++)
+		directionCosineMatrix[i].clear();
+	for (size_t i = 0; i < 3; i++)
+		magnetic[i].clear();
+	for (size_t i = 0; i < 3; i++)
+		magneticUncompensated[i].clear();
+	for (size_t i = 0; i < 3; i++)
+		magneticNed[i].clear();
+	for (size_t i = 0; i < 3; i++)
+		magneticEcef[i].clear();
+	for (size_t i = 0; i < 3; i++)
+		acceleration[i].clear();
+	for (size_t i = 0; i < 3; i++)
+		accelerationLinearBody[i].clear();
+	for (size_t i = 0; i < 3; i++)
+		accelerationUncompensated[i].clear();
+	for (size_t i = 0; i < 3; i++)
+		accelerationLinearNed[i].clear();
+	for (size_t i = 0; i < 3; i++)
+		accelerationLinearEcef[i].clear();
+	for (size_t i = 0; i < 3; i++)
+		accelerationNed[i].clear();
+	for (size_t i = 0; i < 3; i++)
+		accelerationEcef[i].clear();
+	for (size_t i = 0; i < 3; i++)
+		angularRate[i].clear();
+	for (size_t i = 0; i < 3; i++)
+		angularRateUncompensated[i].clear();
+	temperature.clear();
+	pressure.clear();
+	for (size_t i = 0; i < 3; i++)
+		positionGpsLla[i].clear();
+	for (size_t i = 0; i < 3; i++)
+		positionGps2Lla[i].clear();
+	for (size_t i = 0; i < 3; i++)
+		positionGpsEcef[i].clear();
+	for (size_t i = 0; i < 3; i++)
+		positionGps2Ecef[i].clear();
+	for (size_t i = 0; i < 3; i++)
+		positionEstimatedLla[i].clear();
+	for (size_t i = 0; i < 3; i++)
+		positionEstimatedEcef[i].clear();
+	for (size_t i = 0; i < 3; i++)
+		velocityGpsNed[i].clear();
+	for (size_t i = 0; i < 3; i++)
+		velocityGps2Ned[i].clear();
+	for (size_t i = 0; i < 3; i++)
+		velocityGpsEcef[i].clear();
+	for (size_t i = 0; i < 3; i++)
+		velocityGps2Ecef[i].clear();
+	for (size_t i = 0; i < 3; i++)
+		velocityEstimatedNed[i].clear();
+	for (size_t i = 0; i < 3; i++)
+		velocityEstimatedEcef[i].clear();
+	for (size_t i = 0; i < 3; i++)
+		velocityEstimatedBody[i].clear();
+	deltaTime.clear();
+	for (size_t i = 0; i < 3; i++)
+		deltaTheta[i].clear();
+	for (size_t i = 0; i < 3; i++)
+		deltaVelocity[i].clear();
+	timeStartup.clear();
+	timeGps.clear();
+	tow.clear();
+	week.clear();
+	numSats.clear();
+	timeSyncIn.clear();
+	vpeStatus.clear();
+	insStatus.clear();
+	syncInCnt.clear();
+	syncOutCnt.clear();
+	timeStatus.clear();
+	timeGpsPps.clear();
+	gpsTow.clear();
+	gps2Tow.clear();
+	timeUtc.clear();
+	sensSat.clear();
+	fix.clear();
+	fix2.clear();
+	for (size_t i = 0; i < 3; i++)
+		positionUncertaintyGpsNed[i].clear();
+	for (size_t i = 0; i < 3; i++)
+		positionUncertaintyGps2Ned[i].clear();
+	positionUncertaintyEstimated.clear();
+	velocityUncertaintyGps.clear();
+	velocityUncertaintyGps2.clear();
+	velocityUncertaintyEstimated.clear();
+	timeUncertainty.clear();
+	for (size_t i = 0; i < 3; i++)
+		attitudeUncertainty[i].clear();
+	timeInfo.clear();
+	timeInfo2.clear();
+	dop.clear();
+	packetIndex.clear();
+
+	_size = 0;
+}
+
+size_t CompositeDataColumns::parse(const char* const* packets, const size_t* lengths, size_t count, CompositeDataColumns& o)
+{
+	o.clear();
+
+	vector<const char*> accepted;
+	accepted.reserve(count);
+	o.packetIndex.reserve(count);
+
+	const char* reference = NULL;
+	size_t referenceHeaderLength = 0;
+
+	for (size_t i = 0; i < count; i++)
+	{
+		size_t headerLength = binaryHeaderLength(packets[i], lengths[i]);
+
+		if (headerLength == 0 || Packet::computeBinaryPacketLength(packets[i]) != lengths[i])
+			continue;
+
+		if (reference == NULL)
+		{
+			reference = packets[i];
+			referenceHeaderLength = headerLength;
+		}
+		else if (headerLength != referenceHeaderLength || memcmp(packets[i], reference, headerLength) != 0)
+		{
+			continue;
+		}
+
+		accepted.push_back(packets[i]);
+		o.packetIndex.push_back(i);
+	}
+
+	if (accepted.empty())
+		return count;
+
+	// The value offsets are the same in every accepted packet, so they are
+	// determined once from the first one.
+	Packet first(accepted[0], lengths[o.packetIndex[0]]);
+	LazyCompositeData index;
+	LazyCompositeData::parse(first, index);
+
+	vector<Column> plan;
+
+	for (size_t f = 0; f < LazyCompositeData::LCD_Count; f++)
+	{
+		size_t offset = index._offsets[f];
+
+		if (offset == 0)
+			continue;
+
+		switch (f)
+		{
+		case LazyCompositeData::LCD_YawPitchRoll:
+			addComponents(plan, offset, COLUMN_FLOAT, o.yawPitchRoll, 3);
+			break;
+
+		case LazyCompositeData::LCD_Quaternion:
+			addComponents(plan, offset, COLUMN_FLOAT, o.quaternion, 4);
+			break;
+
+		case LazyCompositeData::LCD_DirectionCosineMatrix:
+			addComponents(plan, offset, COLUMN_FLOAT, o.directionCosineMatrix, 9);
+			break;
+
+		case LazyCompositeData::LCD_Magnetic:
+			addComponents(plan, offset, COLUMN_FLOAT, o.magnetic, 3);
+			break;
+
+		case LazyCompositeData::LCD_MagneticUncompensated:
+			addComponents(plan, offset, COLUMN_FLOAT, o.magneticUncompensated, 3);
+			break;
+
+		case LazyCompositeData::LCD_MagneticNed:
+			addComponents(plan, offset, COLUMN_FLOAT, o.magneticNed, 3);
+			break;
+
+		case LazyCompositeData::LCD_MagneticEcef:
+			addComponents(plan, offset, COLUMN_FLOAT, o.magneticEcef, 3);
+			break;
+
+		case LazyCompositeData::LCD_Acceleration:
+			addComponents(plan, offset, COLUMN_FLOAT, o.acceleration, 3);
+			break;
+
+		case LazyCompositeData::LCD_AccelerationLinearBody:
+			addComponents(plan, offset, COLUMN_FLOAT, o.accelerationLinearBody, 3);
+			break;
+
+		case LazyCompositeData::LCD_AccelerationUncompensated:
+			addComponents(plan, offset, COLUMN_FLOAT, o.accelerationUncompensated, 3);
+			break;
+
+		case LazyCompositeData::LCD_AccelerationLinearNed:
+			addComponents(plan, offset, COLUMN_FLOAT, o.accelerationLinearNed, 3);
+			break;
+
+		case LazyCompositeData::LCD_AccelerationLinearEcef:
+			addComponents(plan, offset, COLUMN_FLOAT, o.accelerationLinearEcef, 3);
+			break;
+
+		case LazyCompositeData::LCD_AccelerationNed:
+			addComponents(plan, offset, COLUMN_FLOAT, o.accelerationNed, 3);
+			break;
+
+		case LazyCompositeData::LCD_AccelerationEcef:
+			addComponents(plan, offset, COLUMN_FLOAT, o.accelerationEcef, 3);
+			break;
+
+		case LazyCompositeData::LCD_AngularRate:
+			addComponents(plan, offset, COLUMN_FLOAT, o.angularRate, 3);
+			break;
+
+		case LazyCompositeData::LCD_AngularRateUncompensated:
+			addComponents(plan, offset, COLUMN_FLOAT, o.angularRateUncompensated, 3);
+			break;
+
+		case LazyCompositeData::LCD_Temperature:
+			plan.push_back(Column(offset, COLUMN_FLOAT, &o.temperature));
+			break;
+
+		case LazyCompositeData::LCD_Pressure:
+			plan.push_back(Column(offset, COLUMN_FLOAT, &o.pressure));
+			break;
+
+		case LazyCompositeData::LCD_PositionGpsLla:
+			addComponents(plan, offset, COLUMN_DOUBLE, o.positionGpsLla, 3);
+			break;
+
+		case LazyCompositeData::LCD_PositionGps2Lla:
+			addComponents(plan, offset, COLUMN_DOUBLE, o.positionGps2Lla, 3);
+			break;
+
+		case LazyCompositeData::LCD_PositionGpsEcef:
+			addComponents(plan, offset, COLUMN_DOUBLE, o.positionGpsEcef, 3);
+			break;
+
+		case LazyCompositeData::LCD_PositionGps2Ecef:
+			addComponents(plan, offset, COLUMN_DOUBLE, o.positionGps2Ecef, 3);
+			break;
+
+		case LazyCompositeData::LCD_PositionEstimatedLla:
+			addComponents(plan, offset, COLUMN_DOUBLE, o.positionEstimatedLla, 3);
+			break;
+
+		case LazyCompositeData::LCD_PositionEstimatedEcef:
+			addComponents(plan, offset, COLUMN_DOUBLE, o.positionEstimatedEcef, 3);
+			break;
+
+		case LazyCompositeData::LCD_VelocityGpsNed:
+			addComponents(plan, offset, COLUMN_FLOAT, o.velocityGpsNed, 3);
+			break;
+
+		case LazyCompositeData::LCD_VelocityGps2Ned:
+			addComponents(plan, offset, COLUMN_FLOAT, o.velocityGps2Ned, 3);
+			break;
+
+		case LazyCompositeData::LCD_VelocityGpsEcef:
+			addComponents(plan, offset, COLUMN_FLOAT, o.velocityGpsEcef, 3);
+			break;
+
+		case LazyCompositeData::LCD_VelocityGps2Ecef:
+			addComponents(plan, offset, COLUMN_FLOAT, o.velocityGps2Ecef, 3);
+			break;
+
+		case LazyCompositeData::LCD_VelocityEstimatedNed:
+			addComponents(plan, offset, COLUMN_FLOAT, o.velocityEstimatedNed, 3);
+			break;
+
+		case LazyCompositeData::LCD_VelocityEstimatedEcef:
+			addComponents(plan, offset, COLUMN_FLOAT, o.velocityEstimatedEcef, 3);
+			break;
+
+		case LazyCompositeData::LCD_VelocityEstimatedBody:
+			addComponents(plan, offset, COLUMN_FLOAT, o.velocityEstimatedBody, 3);
+			break;
+
+		case LazyCompositeData::LCD_DeltaTime:
+			plan.push_back(Column(offset, COLUMN_FLOAT, &o.deltaTime));
+			break;
+
+		case LazyCompositeData::LCD_DeltaTheta:
+			addComponents(plan, offset, COLUMN_FLOAT, o.deltaTheta, 3);
+			break;
+
+		case LazyCompositeData::LCD_DeltaVelocity:
+			addComponents(plan, offset, COLUMN_FLOAT, o.deltaVelocity, 3);
+			break;
+
+		case LazyCompositeData::LCD_TimeStartup:
+			plan.push_back(Column(offset, COLUMN_UINT64, &o.timeStartup));
+			break;
+
+		case LazyCompositeData::LCD_TimeGps:
+			plan.push_back(Column(offset, COLUMN_UINT64, &o.timeGps));
+			break;
+
+		case LazyCompositeData::LCD_Tow:
+			plan.push_back(Column(offset, COLUMN_TOW, &o.tow));
+			break;
+
+		case LazyCompositeData::LCD_Week:
+			plan.push_back(Column(offset, COLUMN_UINT16, &o.week));
+			break;
+
+		case LazyCompositeData::LCD_NumSats:
+			plan.push_back(Column(offset, COLUMN_UINT8, &o.numSats));
+			break;
+
+		case LazyCompositeData::LCD_TimeSyncIn:
+			plan.push_back(Column(offset, COLUMN_UINT64, &o.timeSyncIn));
+			break;
+
+		case LazyCompositeData::LCD_VpeStatus:
+			plan.push_back(Column(offset, COLUMN_VPESTATUS, &o.vpeStatus));
+			break;
+
+		case LazyCompositeData::LCD_InsStatus:
+			plan.push_back(Column(offset, COLUMN_INSSTATUS, &o.insStatus));
+			break;
+
+		case LazyCompositeData::LCD_SyncInCnt:
+			plan.push_back(Column(offset, COLUMN_UINT32, &o.syncInCnt));
+			break;
+
+		case LazyCompositeData::LCD_SyncOutCnt:
+			plan.push_back(Column(offset, COLUMN_UINT32, &o.syncOutCnt));
+			break;
+
+		case LazyCompositeData::LCD_TimeStatus:
+			plan.push_back(Column(offset, COLUMN_UINT8, &o.timeStatus));
+			break;
+
+		case LazyCompositeData::LCD_TimeGpsPps:
+			plan.push_back(Column(offset, COLUMN_UINT64, &o.timeGpsPps));
+			break;
+
+		case LazyCompositeData::LCD_GpsTow:
+			plan.push_back(Column(offset, COLUMN_UINT64, &o.gpsTow));
+			break;
+
+		case LazyCompositeData::LCD_Gps2Tow:
+			plan.push_back(Column(offset, COLUMN_UINT64, &o.gps2Tow));
+			break;
+
+		case LazyCompositeData::LCD_TimeUtc:
+			plan.push_back(Column(offset, COLUMN_TIMEUTC, &o.timeUtc));
+			break;
+
+		case LazyCompositeData::LCD_SensSat:
+			plan.push_back(Column(offset, COLUMN_SENSSAT, &o.sensSat));
+			break;
+
+		case LazyCompositeData::LCD_Fix:
+			plan.push_back(Column(offset, COLUMN_GPSFIX, &o.fix));
+			break;
+
+		case LazyCompositeData::LCD_Fix2:
+			plan.push_back(Column(offset, COLUMN_GPSFIX, &o.fix2));
+			break;
+
+		case LazyCompositeData::LCD_PositionUncertaintyGpsNed:
+			addComponents(plan, offset, COLUMN_FLOAT, o.positionUncertaintyGpsNed, 3);
+			break;
+
+		case LazyCompositeData::LCD_PositionUncertaintyGps2Ned:
+			addComponents(plan, offset, COLUMN_FLOAT, o.positionUncertaintyGps2Ned, 3);
+			break;
+
+		case LazyCompositeData::LCD_PositionUncertaintyEstimated:
+			plan.push_back(Column(offset, COLUMN_FLOAT, &o.positionUncertaintyEstimated));
+			break;
+
+		case LazyCompositeData::LCD_VelocityUncertaintyGps:
+			plan.push_back(Column(offset, COLUMN_FLOAT, &o.velocityUncertaintyGps));
+			break;
+
+		case LazyCompositeData::LCD_VelocityUncertaintyGps2:
+			plan.push_back(Column(offset, COLUMN_FLOAT, &o.velocityUncertaintyGps2));
+			break;
+
+		case LazyCompositeData::LCD_VelocityUncertaintyEstimated:
+			plan.push_back(Column(offset, COLUMN_FLOAT, &o.velocityUncertaintyEstimated));
+			break;
+
+		case LazyCompositeData::LCD_TimeUncertainty:
+			plan.push_back(Column(offset, COLUMN_UINT32, &o.timeUncertainty));
+			break;
+
+		case LazyCompositeData::LCD_AttitudeUncertainty:
+			addComponents(plan, offset, COLUMN_FLOAT, o.attitudeUncertainty, 3);
+			break;
+
+		case LazyCompositeData::LCD_TimeInfo:
+			plan.push_back(Column(offset, COLUMN_TIMEINFO, &o.timeInfo));
+			break;
+
+		case LazyCompositeData::LCD_TimeInfo2:
+			plan.push_back(Column(offset, COLUMN_TIMEINFO, &o.timeInfo2));
+			break;
+
+		case LazyCompositeData::LCD_Dop:
+			plan.push_back(Column(offset, COLUMN_GNSSDOP, &o.dop));
+			break;
+		}
+	}
+
+	for (vector<Column>::const_iterator c = plan.begin(); c != plan.end(); ++c)
+		decodeColumn(&accepted[0], accepted.size(), *c);
+
+	o._size = accepted.size();
+
+	return count - accepted.size();
+}
+
+}
+}
@@ -0,0 +1,149 @@
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "vn/compositedatacolumns.h"
+#include "vn/error_detection.h"
+
+using namespace std;
+using namespace vn::sensors;
+using namespace vn::data::integrity;
+
+namespace {
+
+template<typename T>
+void append(string& p, T value)
+{
+	// The sensor sends little-endian values, the same as the test hosts.
+	char bytes[sizeof(T)];
+	memcpy(bytes, &value, sizeof(T));
+	p.append(bytes, sizeof(T));
+}
+
+string withCrc(string p)
+{
+	uint16_t crc = Crc16::compute(p.data() + 1, p.size() - 1);
+	p += static_cast<char>(crc >> 8);
+	p += static_cast<char>(crc & 0xFF);
+
+	return p;
+}
+
+// Builds a binary packet with the Common group's TimeStartup and YawPitchRoll
+// fields.
+string timeAndAttitudePacket(uint64_t timeStartup, float yaw)
+{
+	string p;
+	p += '\xFA';
+	p += '\x01';
+	p += '\x09';
+	p += '\x00';
+	append(p, timeStartup);
+	append(p, yaw);
+	append(p, 1.5f);
+	append(p, -2.5f);
+
+	return withCrc(p);
+}
+
+// Builds a binary packet with only the Common group's TimeStartup field.
+string timePacket(uint64_t timeStartup)
+{
+	string p;
+	p += '\xFA';
+	p += '\x01';
+	p += '\x01';
+	p += '\x00';
+	append(p, timeStartup);
+
+	return withCrc(p);
+}
+
+}
+
+TEST(CompositeDataColumns, DecodesABatch)
+{
+	vector<string> data;
+	for (int i = 0; i < 4; i++)
+		data.push_back(timeAndAttitudePacket(1000 * i, 10.0f * i));
+
+	vector<const char*> packets;
+	vector<size_t> lengths;
+	for (size_t i = 0; i < data.size(); i++)
+	{
+		packets.push_back(data[i].data());
+		lengths.push_back(data[i].size());
+	}
+
+	CompositeDataColumns c;
+	EXPECT_EQ(0u, CompositeDataColumns::parse(&packets[0], &lengths[0], packets.size(), c));
+
+	ASSERT_EQ(4u, c.size());
+	ASSERT_EQ(4u, c.timeStartup.size());
+	ASSERT_EQ(4u, c.yawPitchRoll[0].size());
+	EXPECT_TRUE(c.quaternion[0].empty());
+
+	for (size_t i = 0; i < 4; i++)
+	{
+		EXPECT_EQ(i, c.packetIndex[i]);
+		EXPECT_EQ(1000 * i, c.timeStartup[i]);
+		EXPECT_FLOAT_EQ(10.0f * i, c.yawPitchRoll[0][i]);
+		EXPECT_FLOAT_EQ(1.5f, c.yawPitchRoll[1][i]);
+		EXPECT_FLOAT_EQ(-2.5f, c.yawPitchRoll[2][i]);
+	}
+}
+
+TEST(CompositeDataColumns, SkipsPacketsWhichDoNotMatchTheBatch)
+{
+	string ascii = "$VNYMR,+010.000,+001.000,-002.000*6A\r\n";
+	string good1 = timeAndAttitudePacket(1, 1.0f);
+	string truncated = timeAndAttitudePacket(2, 2.0f);
+	string otherLayout = timePacket(3);
+	string good2 = timeAndAttitudePacket(4, 4.0f);
+	string header = good1.substr(0, 3);
+
+	const char* packets[] = {
+		ascii.data(),
+		good1.data(),
+		truncated.data(),
+		otherLayout.data(),
+		header.data(),
+		good2.data()
+	};
+	size_t lengths[] = {
+		ascii.size(),
+		good1.size(),
+		truncated.size() - 4,
+		otherLayout.size(),
+		header.size(),
+		good2.size()
+	};
+
+	CompositeDataColumns c;
+	EXPECT_EQ(4u, CompositeDataColumns::parse(packets, lengths, 6, c));
+
+	ASSERT_EQ(2u, c.size());
+	ASSERT_EQ(2u, c.packetIndex.size());
+	EXPECT_EQ(1u, c.packetIndex[0]);
+	EXPECT_EQ(5u, c.packetIndex[1]);
+	ASSERT_EQ(2u, c.timeStartup.size());
+	EXPECT_EQ(1u, c.timeStartup[0]);
+	EXPECT_EQ(4u, c.timeStartup[1]);
+	EXPECT_FLOAT_EQ(4.0f, c.yawPitchRoll[0][1]);
+}
+
+TEST(CompositeDataColumns, LeavesColumnsEmptyWithoutBinaryPackets)
+{
+	string ascii = "$VNYMR,+010.000,+001.000,-002.000*6A\r\n";
+	const char* packets[] = { ascii.data() };
+	size_t lengths[] = { ascii.size() };
+
+	CompositeDataColumns c;
+	EXPECT_EQ(1u, CompositeDataColumns::parse(packets, lengths, 1, c));
+
+	EXPECT_EQ(0u, c.size());
+	EXPECT_TRUE(c.packetIndex.empty());
+	EXPECT_TRUE(c.timeStartup.empty());
+}
@@ -0,0 +1,62 @@
+#include "hayai.hpp"
+
+#include <cstdlib>
+#include <vector>
+
+#include "vn/error_detection.h"
+
+using namespace std;
+using namespace vn::data::integrity;
+
+namespace {
+
+// A typical binary packet, without its sync byte, and a large block.
+const size_t PacketLength = 160;
+const size_t BlockLength = 64 * 1024;
+
+vector<char> randomData(size_t length)
+{
+	vector<char> data(length);
+
+	srand(6);
+	for (size_t i = 0; i < data.size(); i++)
+		data[i] = static_cast<char>(rand());
+
+	return data;
+}
+
+vector<char> Block = randomData(BlockLength);
+
+volatile uint16_t Result;
+
+}
+
+BENCHMARK(Crc16, BitwisePacket, 10, 10000)
+{
+	Result = Crc16::computeBitwise(&Block[0], PacketLength);
+}
+
+BENCHMARK(Crc16, SliceBy8Packet, 10, 10000)
+{
+	Result = Crc16::computeSliceBy8(&Block[0], PacketLength);
+}
+
+BENCHMARK(Crc16, ClmulPacket, 10, 10000)
+{
+	Result = Crc16::computeClmul(&Block[0], PacketLength);
+}
+
+BENCHMARK(Crc16, BitwiseBlock, 10, 100)
+{
+	Result = Crc16::computeBitwise(&Block[0], BlockLength);
+}
+
+BENCHMARK(Crc16, SliceBy8Block, 10, 100)
+{
+	Result = Crc16::computeSliceBy8(&Block[0], BlockLength);
+}
+
+BENCHMARK(Crc16, ClmulBlock, 10, 100)
+{
+	Result = Crc16::computeClmul(&Block[0], BlockLength);
+}
@@ -1,12 +1,188 @@
 #include "vn/error_detection.h"
+#include "vn/compiler.h"
+#include "vn/exceptions.h"
 
 #include <iostream>
+
+// The carry-less multiply implementation is compiled for x86 processors
+// with compilers that can target PCLMULQDQ for a single function, and only
+// used when the processor reports support for it.
+#if VN_HAVE_SSE2 && (defined(__GNUC__) || defined(_MSC_VER))
+	#define VN_HAVE_CRC16_CLMUL 1
+	#include <emmintrin.h>
+	#include <tmmintrin.h>
+	#include <wmmintrin.h>
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+	#else
+		#include <cpuid.h>
+	#endif
+#else
+	#define VN_HAVE_CRC16_CLMUL 0
+#endif
+
+#if VN_HAVE_CRC16_CLMUL && defined(__GNUC__)
+	#define VN_TARGET_CLMUL __attribute__((target("pclmul,ssse3")))
+#else
+	#define VN_TARGET_CLMUL
+#endif
+
 using namespace std;
 
 namespace vn {
 namespace data {
 namespace integrity {
 
+namespace {
+
+// The CRC16-CCITT polynomial x^16 + x^12 + x^5 + 1 used by the sensor.
+const uint16_t Crc16Polynomial = 0x1021;
+
+// Lookup tables for the slice-by-8 implementation. Entry [k][b] is the CRC of
+// the byte b followed by k zero bytes.
+struct Crc16Tables
+{
+	uint16_t t[8][256];
+
+	Crc16Tables()
+	{
+		for (uint32_t b = 0; b < 256; b++)
+		{
+			uint16_t crc = static_cast<uint16_t>(b << 8);
+
+			for (int bit = 0; bit < 8; bit++)
+				crc = static_cast<uint16_t>((crc & 0x8000) ? (crc << 1) ^ Crc16Polynomial : crc << 1);
+
+			t[0][b] = crc;
+		}
+
+		for (int k = 1; k < 8; k++)
+			for (uint32_t b = 0; b < 256; b++)
+				t[k][b] = static_cast<uint16_t>((t[k - 1][b] << 8) ^ t[0][t[k - 1][b] >> 8]);
+	}
+};
+
+const Crc16Tables& crc16Tables()
+{
+	static const Crc16Tables tables;
+
+	return tables;
+}
+
+uint16_t crc16SliceBy8(uint16_t crc, const uint8_t* data, size_t length)
+{
+	const Crc16Tables& tables = crc16Tables();
+
+	for (; length >= 8; data += 8, length -= 8)
+	{
+		crc = static_cast<uint16_t>(
+			tables.t[7][data[0] ^ (crc >> 8)] ^
+			tables.t[6][data[1] ^ (crc & 0xFF)] ^
+			tables.t[5][data[2]] ^
+			tables.t[4][data[3]] ^
+			tables.t[3][data[4]] ^
+			tables.t[2][data[5]] ^
+			tables.t[1][data[6]] ^
+			tables.t[0][data[7]]);
+	}
+
+	for (; length > 0; data++, length--)
+		crc = static_cast<uint16_t>((crc << 8) ^ tables.t[0][(crc >> 8) ^ *data]);
+
+	return crc;
+}
+
+uint16_t crc16Table(const char data[], size_t length)
+{
+	return crc16SliceBy8(0, reinterpret_cast<const uint8_t*>(data), length);
+}
+
+#if VN_HAVE_CRC16_CLMUL
+
+// Computes x^n mod P for the CRC16 polynomial.
+uint64_t xPowModPolynomial(size_t n)
+{
+	uint32_t r = 1;
+
+	for (size_t i = 0; i < n; i++)
+	{
+		r <<= 1;
+		if (r & 0x10000)
+			r ^= 0x10000 | Crc16Polynomial;
+	}
+
+	return r;
+}
+
+bool processorSupportsClmul()
+{
+	// CPUID leaf 1, ECX bit 1 is PCLMULQDQ and bit 9 is SSSE3.
+	#if defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 1);
+	uint32_t ecx = static_cast<uint32_t>(info[2]);
+	#else
+	unsigned int eax, ebx, ecx, edx;
+	if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+		return false;
+	#endif
+
+	return (ecx & (1u << 1)) && (ecx & (1u << 9));
+}
+
+// Folds the data 16 bytes at a time with carry-less multiplies, leaving a
+// 16 byte remainder with the same CRC as the folded data, which is then
+// finished off with the tables along with any trailing bytes.
+VN_TARGET_CLMUL uint16_t crc16Clmul(const char data[], size_t length)
+{
+	if (length < 32)
+		return crc16Table(data, length);
+
+	// Moving a 128-bit block forward by 128 bits multiplies its upper half
+	// by x^192 and its lower half by x^128.
+	static const uint64_t foldLow = xPowModPolynomial(128);
+	static const uint64_t foldHigh = xPowModPolynomial(192);
+
+	// Reverses the bytes so the first byte of a block is most significant.
+	const __m128i byteReverse = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+	const __m128i foldConstants = _mm_set_epi64x(static_cast<int64_t>(foldHigh), static_cast<int64_t>(foldLow));
+
+	const uint8_t* p = reinterpret_cast<const uint8_t*>(data);
+	__m128i remainder = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), byteReverse);
+	p += 16;
+	length -= 16;
+
+	for (; length >= 16; p += 16, length -= 16)
+	{
+		__m128i block = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), byteReverse);
+		__m128i high = _mm_clmulepi64_si128(remainder, foldConstants, 0x11);
+		__m128i low = _mm_clmulepi64_si128(remainder, foldConstants, 0x00);
+
+		remainder = _mm_xor_si128(_mm_xor_si128(high, low), block);
+	}
+
+	uint8_t remainderBytes[16];
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(remainderBytes), _mm_shuffle_epi8(remainder, byteReverse));
+
+	return crc16SliceBy8(crc16SliceBy8(0, remainderBytes, 16), p, length);
+}
+
+#endif
+
+typedef uint16_t (*Crc16Function)(const char data[], size_t length);
+
+Crc16Function selectCrc16Function()
+{
+	#if VN_HAVE_CRC16_CLMUL
+	if (processorSupportsClmul())
+		return crc16Clmul;
+	#endif
+
+	return crc16Table;
+}
+
+}
+
 uint8_t Checksum8::compute(char const data[], size_t length)
 {
 	if (length > 1000)
@@ -23,6 +199,30 @@ uint8_t Checksum8::compute(char const data[], size_t length)
 }
 
 uint16_t Crc16::compute(char const data[], size_t length)
+{
+	static const Crc16Function implementation = selectCrc16Function();
+
+	return implementation(data, length);
+}
+
+uint16_t Crc16::computeSliceBy8(char const data[], size_t length)
+{
+	return crc16Table(data, length);
+}
+
+uint16_t Crc16::computeClmul(char const data[], size_t length)
+{
+	#if VN_HAVE_CRC16_CLMUL
+	static const bool isSupported = processorSupportsClmul();
+
+	if (isSupported)
+		return crc16Clmul(data, length);
+	#endif
+
+	throw not_supported();
+}
+
+uint16_t Crc16::computeBitwise(char const data[], size_t length)
 {
 	uint32_t i;
 	uint16_t crc = 0;
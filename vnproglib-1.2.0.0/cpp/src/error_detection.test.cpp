@@ -0,0 +1,91 @@
+#include "gtest/gtest.h"
+
+#include <cstdlib>
+#include <vector>
+
+#include "vn/error_detection.h"
+#include "vn/exceptions.h"
+
+using namespace std;
+using namespace vn::data::integrity;
+
+namespace {
+
+// Random data with room to start at every offset within a 16 byte block.
+vector<char> randomData(size_t length)
+{
+	vector<char> data(length + 16);
+
+	srand(6);
+	for (size_t i = 0; i < data.size(); i++)
+		data[i] = static_cast<char>(rand());
+
+	return data;
+}
+
+bool isClmulSupported()
+{
+	try
+	{
+		Crc16::computeClmul("", 0);
+		return true;
+	}
+	catch (vn::not_supported&)
+	{
+		return false;
+	}
+}
+
+}
+
+TEST(Crc16, MatchesTheCcittCheckValue)
+{
+	const char check[] = "123456789";
+
+	EXPECT_EQ(0x31C3, Crc16::computeBitwise(check, 9));
+	EXPECT_EQ(0x31C3, Crc16::computeSliceBy8(check, 9));
+	EXPECT_EQ(0x31C3, Crc16::compute(check, 9));
+}
+
+TEST(Crc16, SliceBy8IsBitExactWithTheBitwiseReference)
+{
+	vector<char> data = randomData(1024);
+
+	for (size_t offset = 0; offset < 16; offset++)
+		for (size_t length = 0; length <= 1024; length++)
+			ASSERT_EQ(Crc16::computeBitwise(&data[offset], length), Crc16::computeSliceBy8(&data[offset], length))
+				<< "offset " << offset << ", length " << length;
+}
+
+TEST(Crc16, ClmulIsBitExactWithTheBitwiseReference)
+{
+	if (!isClmulSupported())
+		return;
+
+	vector<char> data = randomData(1024);
+
+	for (size_t offset = 0; offset < 16; offset++)
+		for (size_t length = 0; length <= 1024; length++)
+			ASSERT_EQ(Crc16::computeBitwise(&data[offset], length), Crc16::computeClmul(&data[offset], length))
+				<< "offset " << offset << ", length " << length;
+}
+
+TEST(Crc16, SelectedImplementationIsBitExactWithTheBitwiseReference)
+{
+	vector<char> data = randomData(1024);
+
+	for (size_t length = 0; length <= 1024; length++)
+		ASSERT_EQ(Crc16::computeBitwise(&data[0], length), Crc16::compute(&data[0], length))
+			<< "length " << length;
+}
+
+TEST(Crc16, DataFollowedByItsCrcHasAZeroCrc)
+{
+	vector<char> data = randomData(200);
+
+	uint16_t crc = Crc16::compute(&data[0], 198);
+	data[198] = static_cast<char>(crc >> 8);
+	data[199] = static_cast<char>(crc & 0xFF);
+
+	EXPECT_EQ(0, Crc16::compute(&data[0], 200));
+}
@@ -12,24 +12,20 @@ namespace sensors {
 	#pragma warning(disable:4100)
 #endif
 
-void EzAsyncData::asyncPacketReceivedHandler(void* userData, protocol::uart::Packet& p, size_t index)
+void EzAsyncData::asyncPacketReceivedHandler(void* userData, protocol::uart::PacketView& p, size_t index)
 {
 	EzAsyncData* ez = static_cast<EzAsyncData*>(userData);
 
 	CompositeData nd;
 
-	#if VN_SUPPORTS_INITIALIZER_LIST
-	vector<CompositeData*> d({ &ez->_persistentData, &nd });
-	#else
-	vector<CompositeData*> d(2);
-	d[0] = &ez->_persistentData;
-	d[1] = &nd;
-	#endif
-
 	ez->_mainCS.enter();
-	CompositeData::parse(p, d);
+	bool parsed = CompositeData::tryParse(p, ez->_persistentData, nd);
 	ez->_mainCS.leave();
 
+	if (!parsed)
+		// Ignore packets which are malformed or not supported.
+		return;
+
 	ez->_copyCS.enter();
 	ez->_nextData = nd;
 	ez->_copyCS.leave();
@@ -0,0 +1,658 @@
+#include "vn/lazycompositedata.h"
+#include "vn/exceptions.h"
+#include "vn/utilities.h"
+#include "vn/conversions.h"
+
+#include <cstring>
+
+using namespace std;
+using namespace vn::math;
+using namespace vn::protocol::uart;
+
+namespace vn {
+namespace sensors {
+
+namespace {
+
+template<typename T>
+T readRaw(const char* data)
+{
+	T v;
+
+	memcpy(&v, data, sizeof(T));
+
+	return v;
+}
+
+// Decodes a value from its place in a binary packet. Integers are converted
+// from the sensor's byte order, while floating point values are copied as
+// they are, the same way the Packet extractors do.
+
+void decode(const char* d, uint8_t& value)
+{
+	value = readRaw<uint8_t>(d);
+}
+
+void decode(const char* d, uint16_t& value)
+{
+	value = stoh(readRaw<uint16_t>(d));
+}
+
+void decode(const char* d, uint32_t& value)
+{
+	value = stoh(readRaw<uint32_t>(d));
+}
+
+void decode(const char* d, uint64_t& value)
+{
+	value = stoh(readRaw<uint64_t>(d));
+}
+
+void decode(const char* d, float& value)
+{
+	memcpy(&value, d, sizeof(float));
+}
+
+// The only scalar double is the GPS time of week, which is sent in
+// nanoseconds and provided in seconds.
+void decode(const char* d, double& value)
+{
+	value = (double)stoh(readRaw<uint64_t>(d)) / 1000000000;
+}
+
+void decode(const char* d, vec3f& value)
+{
+	memcpy(&value.x, d, sizeof(float));
+	memcpy(&value.y, d + sizeof(float), sizeof(float));
+	memcpy(&value.z, d + 2 * sizeof(float), sizeof(float));
+}
+
+void decode(const char* d, vec4f& value)
+{
+	memcpy(&value.x, d, sizeof(float));
+	memcpy(&value.y, d + sizeof(float), sizeof(float));
+	memcpy(&value.z, d + 2 * sizeof(float), sizeof(float));
+	memcpy(&value.w, d + 3 * sizeof(float), sizeof(float));
+}
+
+void decode(const char* d, vec3d& value)
+{
+	memcpy(&value.x, d, sizeof(double));
+	memcpy(&value.y, d + sizeof(double), sizeof(double));
+	memcpy(&value.z, d + 2 * sizeof(double), sizeof(double));
+}
+
+// The matrix is sent in column-major order.
+void decode(const char* d, mat3f& value)
+{
+	memcpy(&value.e00, d, sizeof(float));
+	memcpy(&value.e10, d + sizeof(float), sizeof(float));
+	memcpy(&value.e20, d + 2 * sizeof(float), sizeof(float));
+	memcpy(&value.e01, d + 3 * sizeof(float), sizeof(float));
+	memcpy(&value.e11, d + 4 * sizeof(float), sizeof(float));
+	memcpy(&value.e21, d + 5 * sizeof(float), sizeof(float));
+	memcpy(&value.e02, d + 6 * sizeof(float), sizeof(float));
+	memcpy(&value.e12, d + 7 * sizeof(float), sizeof(float));
+	memcpy(&value.e22, d + 8 * sizeof(float), sizeof(float));
+}
+
+void decode(const char* d, VpeStatus& value)
+{
+	value = VpeStatus(stoh(readRaw<uint16_t>(d)));
+}
+
+void decode(const char* d, InsStatus& value)
+{
+	value = InsStatus(stoh(readRaw<uint16_t>(d)));
+}
+
+void decode(const char* d, SensSat& value)
+{
+	value = SensSat(stoh(readRaw<uint16_t>(d)));
+}
+
+void decode(const char* d, GpsFix& value)
+{
+	value = GpsFix(readRaw<uint8_t>(d));
+}
+
+void decode(const char* d, TimeUtc& value)
+{
+	value.year = readRaw<int8_t>(d);
+	value.month = readRaw<uint8_t>(d + 1);
+	value.day = readRaw<uint8_t>(d + 2);
+	value.hour = readRaw<uint8_t>(d + 3);
+	value.min = readRaw<uint8_t>(d + 4);
+	value.sec = readRaw<uint8_t>(d + 5);
+	value.ms = stoh(readRaw<uint16_t>(d + 6));
+}
+
+void decode(const char* d, TimeInfo& value)
+{
+	value.timeStatus = readRaw<uint8_t>(d);
+	value.leapSecs = readRaw<int8_t>(d + 1);
+}
+
+void decode(const char* d, GnssDop& value)
+{
+	memcpy(&value.gDop, d, sizeof(float));
+	memcpy(&value.pDop, d + sizeof(float), sizeof(float));
+	memcpy(&value.tDop, d + 2 * sizeof(float), sizeof(float));
+	memcpy(&value.vDop, d + 3 * sizeof(float), sizeof(float));
+	memcpy(&value.hDop, d + 4 * sizeof(float), sizeof(float));
+	memcpy(&value.nDop, d + 5 * sizeof(float), sizeof(float));
+	memcpy(&value.eDop, d + 6 * sizeof(float), sizeof(float));
+}
+
+}
+
+// TimeGps2, TimeGps2Pps and the ECEF GPS position uncertainties are not
+// carried by any binary field, as with CompositeData, so they never appear in
+// the table and their accessors always report that there is no data.
+
+const LazyCompositeData::FieldTarget LazyCompositeData::FieldTargets[7][16][3] =
+{
+	// Common group.
+	{
+		{ { LCD_TimeStartup, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// COMMONGROUP_TIMESTARTUP
+		{ { LCD_TimeGps, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// COMMONGROUP_TIMEGPS
+		{ { LCD_TimeSyncIn, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// COMMONGROUP_TIMESYNCIN
+		{ { LCD_YawPitchRoll, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// COMMONGROUP_YAWPITCHROLL
+		{ { LCD_Quaternion, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// COMMONGROUP_QUATERNION
+		{ { LCD_AngularRate, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// COMMONGROUP_ANGULARRATE
+		{ { LCD_PositionEstimatedLla, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// COMMONGROUP_POSITION
+		{ { LCD_VelocityEstimatedNed, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// COMMONGROUP_VELOCITY
+		{ { LCD_Acceleration, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// COMMONGROUP_ACCEL
+		{ { LCD_AccelerationUncompensated, 0 }, { LCD_AngularRateUncompensated, 12 }, { LCD_Count, 0 } },	// COMMONGROUP_IMU
+		{ { LCD_Magnetic, 0 }, { LCD_Temperature, 12 }, { LCD_Pressure, 16 } },	// COMMONGROUP_MAGPRES
+		{ { LCD_DeltaTime, 0 }, { LCD_DeltaTheta, 4 }, { LCD_DeltaVelocity, 16 } },	// COMMONGROUP_DELTATHETA
+		{ { LCD_VpeStatus, 0 }, { LCD_InsStatus, 0 }, { LCD_Count, 0 } },	// COMMONGROUP_INSSTATUS
+		{ { LCD_SyncInCnt, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// COMMONGROUP_SYNCINCNT
+		{ { LCD_TimeGpsPps, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// COMMONGROUP_TIMEGPSPPS
+		{ { LCD_Count, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },
+	},
+	// Time group.
+	{
+		{ { LCD_TimeStartup, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// TIMEGROUP_TIMESTARTUP
+		{ { LCD_TimeGps, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// TIMEGROUP_TIMEGPS
+		{ { LCD_Tow, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// TIMEGROUP_GPSTOW
+		{ { LCD_Week, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// TIMEGROUP_GPSWEEK
+		{ { LCD_TimeSyncIn, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// TIMEGROUP_TIMESYNCIN
+		{ { LCD_TimeGpsPps, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// TIMEGROUP_TIMEGPSPPS
+		{ { LCD_TimeUtc, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// TIMEGROUP_TIMEUTC
+		{ { LCD_SyncInCnt, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// TIMEGROUP_SYNCINCNT
+		{ { LCD_SyncOutCnt, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// TIMEGROUP_SYNCOUTCNT
+		{ { LCD_TimeStatus, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// TIMEGROUP_TIMESTATUS
+		{ { LCD_Count, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },
+		{ { LCD_Count, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },
+		{ { LCD_Count, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },
+		{ { LCD_Count, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },
+		{ { LCD_Count, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },
+		{ { LCD_Count, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },
+	},
+	// IMU group.
+	{
+		{ { LCD_Count, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// IMUGROUP_IMUSTATUS
+		{ { LCD_MagneticUncompensated, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// IMUGROUP_UNCOMPMAG
+		{ { LCD_AccelerationUncompensated, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// IMUGROUP_UNCOMPACCEL
+		{ { LCD_AngularRateUncompensated, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// IMUGROUP_UNCOMPGYRO
+		{ { LCD_Temperature, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// IMUGROUP_TEMP
+		{ { LCD_Pressure, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// IMUGROUP_PRES
+		{ { LCD_DeltaTime, 0 }, { LCD_DeltaTheta, 4 }, { LCD_Count, 0 } },	// IMUGROUP_DELTATHETA
+		{ { LCD_DeltaVelocity, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// IMUGROUP_DELTAVEL
+		{ { LCD_Magnetic, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// IMUGROUP_MAG
+		{ { LCD_Acceleration, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// IMUGROUP_ACCEL
+		{ { LCD_AngularRate, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// IMUGROUP_ANGULARRATE
+		{ { LCD_SensSat, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// IMUGROUP_SENSSAT
+		{ { LCD_Count, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },
+		{ { LCD_Count, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },
+		{ { LCD_Count, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },
+		{ { LCD_Count, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },
+	},
+	// GPS group.
+	{
+		{ { LCD_TimeUtc, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// GPSGROUP_UTC
+		{ { LCD_GpsTow, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// GPSGROUP_TOW
+		{ { LCD_Count, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// GPSGROUP_WEEK
+		{ { LCD_NumSats, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// GPSGROUP_NUMSATS
+		{ { LCD_Fix, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// GPSGROUP_FIX
+		{ { LCD_PositionGpsLla, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// GPSGROUP_POSLLA
+		{ { LCD_PositionGpsEcef, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// GPSGROUP_POSECEF
+		{ { LCD_VelocityGpsNed, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// GPSGROUP_VELNED
+		{ { LCD_VelocityGpsEcef, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// GPSGROUP_VELECEF
+		{ { LCD_PositionUncertaintyGpsNed, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// GPSGROUP_POSU
+		{ { LCD_VelocityUncertaintyGps, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// GPSGROUP_VELU
+		{ { LCD_TimeUncertainty, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// GPSGROUP_TIMEU
+		{ { LCD_TimeInfo, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// GPSGROUP_TIMEINFO
+		{ { LCD_Dop, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// GPSGROUP_DOP
+		{ { LCD_Count, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },
+		{ { LCD_Count, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },
+	},
+	// Attitude group.
+	{
+		{ { LCD_VpeStatus, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// ATTITUDEGROUP_VPESTATUS
+		{ { LCD_YawPitchRoll, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// ATTITUDEGROUP_YAWPITCHROLL
+		{ { LCD_Quaternion, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// ATTITUDEGROUP_QUATERNION
+		{ { LCD_DirectionCosineMatrix, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// ATTITUDEGROUP_DCM
+		{ { LCD_MagneticNed, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// ATTITUDEGROUP_MAGNED
+		{ { LCD_AccelerationNed, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// ATTITUDEGROUP_ACCELNED
+		{ { LCD_AccelerationLinearBody, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// ATTITUDEGROUP_LINEARACCELBODY
+		{ { LCD_AccelerationLinearNed, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// ATTITUDEGROUP_LINEARACCELNED
+		{ { LCD_AttitudeUncertainty, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// ATTITUDEGROUP_YPRU
+		{ { LCD_Count, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },
+		{ { LCD_Count, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },
+		{ { LCD_Count, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },
+		{ { LCD_Count, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },
+		{ { LCD_Count, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },
+		{ { LCD_Count, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },
+		{ { LCD_Count, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },
+	},
+	// INS group.
+	{
+		{ { LCD_InsStatus, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// INSGROUP_INSSTATUS
+		{ { LCD_PositionEstimatedLla, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// INSGROUP_POSLLA
+		{ { LCD_PositionEstimatedEcef, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// INSGROUP_POSECEF
+		{ { LCD_VelocityEstimatedBody, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// INSGROUP_VELBODY
+		{ { LCD_VelocityEstimatedNed, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// INSGROUP_VELNED
+		{ { LCD_VelocityEstimatedEcef, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// INSGROUP_VELECEF
+		{ { LCD_MagneticEcef, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// INSGROUP_MAGECEF
+		{ { LCD_AccelerationEcef, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// INSGROUP_ACCELECEF
+		{ { LCD_AccelerationLinearEcef, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// INSGROUP_LINEARACCELECEF
+		{ { LCD_PositionUncertaintyEstimated, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// INSGROUP_POSU
+		{ { LCD_VelocityUncertaintyEstimated, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// INSGROUP_VELU
+		{ { LCD_Count, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },
+		{ { LCD_Count, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },
+		{ { LCD_Count, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },
+		{ { LCD_Count, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },
+		{ { LCD_Count, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },
+	},
+	// GPS2 group.
+	{
+		{ { LCD_Count, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// GPSGROUP_UTC
+		{ { LCD_Gps2Tow, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// GPSGROUP_TOW
+		{ { LCD_Count, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// GPSGROUP_WEEK
+		{ { LCD_Count, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// GPSGROUP_NUMSATS
+		{ { LCD_Fix2, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// GPSGROUP_FIX
+		{ { LCD_PositionGps2Lla, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// GPSGROUP_POSLLA
+		{ { LCD_PositionGps2Ecef, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// GPSGROUP_POSECEF
+		{ { LCD_VelocityGps2Ned, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// GPSGROUP_VELNED
+		{ { LCD_VelocityGps2Ecef, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// GPSGROUP_VELECEF
+		{ { LCD_PositionUncertaintyGps2Ned, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// GPSGROUP_POSU
+		{ { LCD_VelocityUncertaintyGps2, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// GPSGROUP_VELU
+		{ { LCD_Count, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// GPSGROUP_TIMEU
+		{ { LCD_TimeInfo2, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// GPSGROUP_TIMEINFO
+		{ { LCD_Count, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },	// GPSGROUP_DOP
+		{ { LCD_Count, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },
+		{ { LCD_Count, 0 }, { LCD_Count, 0 }, { LCD_Count, 0 } },
+	},
+};
+
+
+LazyCompositeData::LazyCompositeData()
+{
+	reset();
+}
+
+LazyCompositeData LazyCompositeData::parse(PacketView& p)
+{
+	LazyCompositeData o;
+
+	parse(p, o);
+
+	return o;
+}
+
+void LazyCompositeData::parse(PacketView& p, LazyCompositeData& o)
+{
+	if (tryParse(p, o))
+		return;
+
+	if (p.type() != Packet::TYPE_BINARY)
+		throw not_supported();
+
+	throw invalid_operation();
+}
+
+bool LazyCompositeData::tryParse(PacketView& p, LazyCompositeData& o) VN_NOEXCEPT
+{
+	o.reset();
+
+	if (p.length() == 0 || p.type() != Packet::TYPE_BINARY)
+		return false;
+
+	uint8_t groups = p.groups();
+
+	// The payload starts after the sync byte, the groups byte and a group
+	// field for every group present.
+	size_t offset = 2;
+	for (uint8_t g = groups; g != 0; g &= g - 1)
+		offset += sizeof(uint16_t);
+
+	// Make sure the group fields are present before reading them.
+	if (offset + 2 > p.length())
+		return false;
+
+	size_t curGroupFieldIndex = 0;
+
+	for (size_t group = 0; group < 8; group++)
+	{
+		if ((groups & (1 << group)) == 0)
+			continue;
+
+		uint16_t groupField = p.groupField(curGroupFieldIndex++);
+
+		for (size_t field = 0; field < 16; field++)
+		{
+			if ((groupField & (1 << field)) == 0)
+				continue;
+
+			if (group < 7)
+			{
+				for (size_t i = 0; i < 3 && FieldTargets[group][field][i].field != LCD_Count; i++)
+					o._offsets[FieldTargets[group][field][i].field] = static_cast<uint16_t>(offset + FieldTargets[group][field][i].offset);
+			}
+
+			offset += Packet::BinaryGroupLengths[group][field];
+		}
+	}
+
+	// The payload must leave room for the trailing CRC.
+	if (offset + 2 > p.length())
+	{
+		o.reset();
+
+		return false;
+	}
+
+	o._data = p.data();
+
+	return true;
+}
+
+void LazyCompositeData::reset()
+{
+	_data = NULL;
+	memset(_offsets, 0, sizeof(_offsets));
+}
+
+LazyCompositeData::Field LazyCompositeData::latest(const Field* fields, size_t count) VN_NOEXCEPT
+{
+	Field latestField = LCD_Count;
+
+	for (size_t i = 0; i < count; i++)
+	{
+		if (_offsets[fields[i]] != 0 && (latestField == LCD_Count || _offsets[fields[i]] > _offsets[latestField]))
+			latestField = fields[i];
+	}
+
+	return latestField;
+}
+
+// Offsets are only recorded for values lying within the packet, so decoding
+// a value found this way cannot fail.
+#define VN_LAZYCOMPOSITEDATA_ACCESSORS(Name, accessor, Type) \
+	bool LazyCompositeData::has##Name() \
+	{ \
+		return _offsets[LCD_##Name] != 0; \
+	} \
+	\
+	Type LazyCompositeData::accessor() \
+	{ \
+		Type value; \
+		\
+		if (!try##Name(value)) \
+			throw invalid_operation(); \
+		\
+		return value; \
+	} \
+	\
+	bool LazyCompositeData::try##Name(Type& value) VN_NOEXCEPT \
+	{ \
+		if (_offsets[LCD_##Name] == 0) \
+			return false; \
+		\
+		decode(_data + _offsets[LCD_##Name], value); \
+		\
+		return true; \
+	}
+
+VN_COMPOSITEDATA_BINARY_VALUES(VN_LAZYCOMPOSITEDATA_ACCESSORS)
+
+#undef VN_LAZYCOMPOSITEDATA_ACCESSORS
+
+bool LazyCompositeData::hasAnyAttitude()
+{
+	return hasYawPitchRoll() || hasQuaternion() || hasDirectionCosineMatrix();
+}
+
+AttitudeF LazyCompositeData::anyAttitude()
+{
+	const Field fields[] = { LCD_YawPitchRoll, LCD_Quaternion, LCD_DirectionCosineMatrix };
+
+	switch (latest(fields, sizeof(fields) / sizeof(fields[0])))
+	{
+	case LCD_YawPitchRoll:
+		return AttitudeF::fromYprInDegs(yawPitchRoll());
+	case LCD_Quaternion:
+		return AttitudeF::fromQuat(quaternion());
+	case LCD_DirectionCosineMatrix:
+		return AttitudeF::fromDcm(directionCosineMatrix());
+	default:
+		throw invalid_operation("no attitude data present");
+	}
+}
+
+bool LazyCompositeData::hasAnyMagnetic()
+{
+	return hasMagnetic() || hasMagneticUncompensated() || hasMagneticNed() || hasMagneticEcef();
+}
+
+vec3f LazyCompositeData::anyMagnetic()
+{
+	const Field fields[] = { LCD_Magnetic, LCD_MagneticUncompensated, LCD_MagneticNed, LCD_MagneticEcef };
+
+	Field field = latest(fields, sizeof(fields) / sizeof(fields[0]));
+
+	if (field == LCD_Count)
+		throw invalid_operation();
+
+	vec3f value;
+	decode(_data + _offsets[field], value);
+
+	return value;
+}
+
+bool LazyCompositeData::hasAnyAcceleration()
+{
+	return hasAcceleration() || hasAccelerationLinearBody() || hasAccelerationUncompensated() ||
+		hasAccelerationLinearNed() || hasAccelerationNed() || hasAccelerationEcef() || hasAccelerationLinearEcef();
+}
+
+vec3f LazyCompositeData::anyAcceleration()
+{
+	const Field fields[] = {
+		LCD_Acceleration, LCD_AccelerationLinearBody, LCD_AccelerationUncompensated, LCD_AccelerationLinearNed,
+		LCD_AccelerationNed, LCD_AccelerationEcef, LCD_AccelerationLinearEcef };
+
+	Field field = latest(fields, sizeof(fields) / sizeof(fields[0]));
+
+	if (field == LCD_Count)
+		throw invalid_operation();
+
+	vec3f value;
+	decode(_data + _offsets[field], value);
+
+	return value;
+}
+
+bool LazyCompositeData::hasAnyAngularRate()
+{
+	return hasAngularRate() || hasAngularRateUncompensated();
+}
+
+vec3f LazyCompositeData::anyAngularRate()
+{
+	const Field fields[] = { LCD_AngularRate, LCD_AngularRateUncompensated };
+
+	Field field = latest(fields, sizeof(fields) / sizeof(fields[0]));
+
+	if (field == LCD_Count)
+		throw invalid_operation();
+
+	vec3f value;
+	decode(_data + _offsets[field], value);
+
+	return value;
+}
+
+bool LazyCompositeData::hasAnyTemperature()
+{
+	return hasTemperature();
+}
+
+float LazyCompositeData::anyTemperature()
+{
+	return temperature();
+}
+
+bool LazyCompositeData::hasAnyPressure()
+{
+	return hasPressure();
+}
+
+float LazyCompositeData::anyPressure()
+{
+	return pressure();
+}
+
+bool LazyCompositeData::hasAnyPosition()
+{
+	return hasPositionGpsLla() || hasPositionGps2Lla() || hasPositionGpsEcef() || hasPositionGps2Ecef() ||
+		hasPositionEstimatedLla() || hasPositionEstimatedEcef();
+}
+
+PositionD LazyCompositeData::anyPosition()
+{
+	const Field fields[] = {
+		LCD_PositionGpsLla, LCD_PositionGps2Lla, LCD_PositionGpsEcef, LCD_PositionGps2Ecef,
+		LCD_PositionEstimatedLla, LCD_PositionEstimatedEcef };
+
+	Field field = latest(fields, sizeof(fields) / sizeof(fields[0]));
+
+	if (field == LCD_Count)
+		throw invalid_operation();
+
+	vec3d value;
+	decode(_data + _offsets[field], value);
+
+	switch (field)
+	{
+	case LCD_PositionGpsLla:
+	case LCD_PositionGps2Lla:
+	case LCD_PositionEstimatedLla:
+		return PositionD::fromLla(value);
+	default:
+		return PositionD::fromEcef(value);
+	}
+}
+
+bool LazyCompositeData::hasAnyVelocity()
+{
+	return latestVelocity() != LCD_Count;
+}
+
+vec3f LazyCompositeData::anyVelocity()
+{
+	Field field = latestVelocity();
+
+	if (field == LCD_Count)
+		throw invalid_operation();
+
+	vec3f value;
+	decode(_data + _offsets[field], value);
+
+	return value;
+}
+
+bool LazyCompositeData::hasAnyPositionUncertainty()
+{
+	return hasPositionUncertaintyGpsNed() || hasPositionUncertaintyGps2Ned() || hasPositionUncertaintyEstimated();
+}
+
+vec3f LazyCompositeData::anyPositionUncertainty()
+{
+	const Field fields[] = { LCD_PositionUncertaintyGpsNed, LCD_PositionUncertaintyGps2Ned, LCD_PositionUncertaintyEstimated };
+
+	switch (latest(fields, sizeof(fields) / sizeof(fields[0])))
+	{
+	case LCD_PositionUncertaintyGpsNed:
+		return positionUncertaintyGpsNed();
+	case LCD_PositionUncertaintyGps2Ned:
+		return positionUncertaintyGps2Ned();
+	case LCD_PositionUncertaintyEstimated:
+		return vec3f(positionUncertaintyEstimated());
+	default:
+		throw invalid_operation();
+	}
+}
+
+bool LazyCompositeData::hasAnyVelocityUncertainty()
+{
+	return hasVelocityUncertaintyGps() || hasVelocityUncertaintyGps2() || hasVelocityUncertaintyEstimated();
+}
+
+float LazyCompositeData::anyVelocityUncertainty()
+{
+	const Field fields[] = { LCD_VelocityUncertaintyGps, LCD_VelocityUncertaintyGps2, LCD_VelocityUncertaintyEstimated };
+
+	Field field = latest(fields, sizeof(fields) / sizeof(fields[0]));
+
+	if (field == LCD_Count)
+		throw invalid_operation();
+
+	float value;
+	decode(_data + _offsets[field], value);
+
+	return value;
+}
+
+// Only velocities in the NED frame can be converted, as in CompositeData.
+bool LazyCompositeData::hasCourseOverGround()
+{
+	Field field = latestVelocity();
+
+	return field == LCD_VelocityGpsNed || field == LCD_VelocityGps2Ned || field == LCD_VelocityEstimatedNed;
+}
+
+float LazyCompositeData::courseOverGround()
+{
+	if (!hasCourseOverGround())
+		throw invalid_operation();
+
+	return course_over_ground(anyVelocity());
+}
+
+bool LazyCompositeData::hasSpeedOverGround()
+{
+	return hasCourseOverGround();
+}
+
+float LazyCompositeData::speedOverGround()
+{
+	if (!hasSpeedOverGround())
+		throw invalid_operation();
+
+	return speed_over_ground(anyVelocity());
+}
+
+LazyCompositeData::Field LazyCompositeData::latestVelocity() VN_NOEXCEPT
+{
+	const Field fields[] = {
+		LCD_VelocityGpsNed, LCD_VelocityGps2Ned, LCD_VelocityGpsEcef, LCD_VelocityGps2Ecef,
+		LCD_VelocityEstimatedNed, LCD_VelocityEstimatedEcef, LCD_VelocityEstimatedBody };
+
+	return latest(fields, sizeof(fields) / sizeof(fields[0]));
+}
+
+}
+}
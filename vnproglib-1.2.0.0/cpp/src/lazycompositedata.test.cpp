@@ -0,0 +1,207 @@
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <string>
+
+#include "vn/lazycompositedata.h"
+#include "vn/compositedata.h"
+#include "vn/error_detection.h"
+
+using namespace std;
+using namespace vn::math;
+using namespace vn::protocol::uart;
+using namespace vn::sensors;
+using namespace vn::data::integrity;
+
+namespace {
+
+// The fields of each group which CompositeData decodes. CompositeData reads
+// a packet's fields one after another, so a packet with any other field
+// would be misread by it.
+const uint16_t DecodedFields[7] = { 0x7FFF, 0x03FF, 0x0FFF, 0x3FFF, 0x01FF, 0x07FF, 0x3FFF };
+
+// Builds a binary packet with the provided group fields. The payload bytes
+// all have their top bit clear, so every floating point value is finite.
+string binaryPacket(const uint16_t groupFields[7])
+{
+	string p;
+	p += '\xFA';
+	p += '\0';
+
+	size_t payloadLength = 0;
+
+	for (size_t g = 0; g < 7; g++)
+	{
+		if (groupFields[g] == 0)
+			continue;
+
+		p[1] = static_cast<char>(p[1] | (1 << g));
+		p += static_cast<char>(groupFields[g] & 0xFF);
+		p += static_cast<char>(groupFields[g] >> 8);
+
+		for (size_t b = 0; b < 15; b++)
+		{
+			if (groupFields[g] & (1 << b))
+				payloadLength += Packet::BinaryGroupLengths[g][b];
+		}
+	}
+
+	for (size_t i = 0; i < payloadLength; i++)
+		p += static_cast<char>((i * 37 + 11) & 0x7F);
+
+	uint16_t crc = Crc16::compute(p.data() + 1, p.size() - 1);
+	p += static_cast<char>(crc >> 8);
+	p += static_cast<char>(crc & 0xFF);
+
+	return p;
+}
+
+// A zero value of each accessor's type. The vector and matrix default
+// constructors leave their elements uninitialized, so T() is not enough.
+template<typename T>
+struct Zero
+{
+	static T value() { return T(); }
+};
+
+template<size_t n, typename T>
+struct Zero<vec<n, T> >
+{
+	static vec<n, T> value() { return vec<n, T>::zero(); }
+};
+
+template<size_t m, size_t n, typename T>
+struct Zero<mat<m, n, T> >
+{
+	static mat<m, n, T> value() { return mat<m, n, T>::zero(); }
+};
+
+template<>
+struct Zero<VpeStatus>
+{
+	static VpeStatus value() { return VpeStatus(0); }
+};
+
+template<typename T>
+bool sameBytes(const T& a, const T& b)
+{
+	return memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+template<typename T>
+void expectSameValue(const char* name, CompositeData& cd, LazyCompositeData& lcd,
+	bool (CompositeData::*cdHas)(), T (CompositeData::*cdValue)(), bool (CompositeData::*cdTry)(T&) VN_NOEXCEPT,
+	bool (LazyCompositeData::*lcdHas)(), T (LazyCompositeData::*lcdValue)(), bool (LazyCompositeData::*lcdTry)(T&) VN_NOEXCEPT)
+{
+	SCOPED_TRACE(name);
+
+	bool has = (lcd.*lcdHas)();
+	EXPECT_EQ((cd.*cdHas)(), has);
+
+	T expected = Zero<T>::value();
+	T actual = Zero<T>::value();
+
+	EXPECT_EQ((cd.*cdTry)(expected), (lcd.*lcdTry)(actual));
+	EXPECT_TRUE(sameBytes(expected, actual));
+
+	if (has)
+		EXPECT_TRUE(sameBytes((cd.*cdValue)(), (lcd.*lcdValue)()));
+	else
+		EXPECT_THROW((lcd.*lcdValue)(), vn::invalid_operation);
+}
+
+// Checks every accessor of LazyCompositeData against CompositeData's.
+void expectSameAsCompositeData(string data)
+{
+	Packet packet(data);
+	ASSERT_TRUE(packet.isValid());
+
+	CompositeData cd = CompositeData::parse(packet);
+
+	LazyCompositeData lcd;
+	ASSERT_TRUE(LazyCompositeData::tryParse(packet, lcd));
+
+	#define EXPECT_SAME_VALUE(Name, accessor, Type) \
+		expectSameValue<Type>(#accessor, cd, lcd, \
+			&CompositeData::has##Name, &CompositeData::accessor, &CompositeData::try##Name, \
+			&LazyCompositeData::has##Name, &LazyCompositeData::accessor, &LazyCompositeData::try##Name);
+
+	VN_COMPOSITEDATA_BINARY_VALUES(EXPECT_SAME_VALUE)
+
+	#undef EXPECT_SAME_VALUE
+
+	#define EXPECT_SAME_ANY(Name, Compare) \
+		{ \
+			SCOPED_TRACE(#Name); \
+			ASSERT_EQ(cd.has##Name(), lcd.has##Name()); \
+			if (lcd.has##Name()) \
+			{ \
+				EXPECT_TRUE(Compare); \
+			} \
+		}
+
+	EXPECT_SAME_ANY(AnyAttitude, sameBytes(cd.anyAttitude().quat(), lcd.anyAttitude().quat()));
+	EXPECT_SAME_ANY(AnyMagnetic, sameBytes(cd.anyMagnetic(), lcd.anyMagnetic()));
+	EXPECT_SAME_ANY(AnyAcceleration, sameBytes(cd.anyAcceleration(), lcd.anyAcceleration()));
+	EXPECT_SAME_ANY(AnyAngularRate, sameBytes(cd.anyAngularRate(), lcd.anyAngularRate()));
+	EXPECT_SAME_ANY(AnyTemperature, cd.anyTemperature() == lcd.anyTemperature());
+	EXPECT_SAME_ANY(AnyPressure, cd.anyPressure() == lcd.anyPressure());
+	EXPECT_SAME_ANY(AnyVelocity, sameBytes(cd.anyVelocity(), lcd.anyVelocity()));
+	EXPECT_SAME_ANY(AnyPositionUncertainty, sameBytes(cd.anyPositionUncertainty(), lcd.anyPositionUncertainty()));
+	EXPECT_SAME_ANY(AnyVelocityUncertainty, cd.anyVelocityUncertainty() == lcd.anyVelocityUncertainty());
+	EXPECT_SAME_ANY(CourseOverGround, cd.courseOverGround() == lcd.courseOverGround());
+	EXPECT_SAME_ANY(SpeedOverGround, cd.speedOverGround() == lcd.speedOverGround());
+
+	#undef EXPECT_SAME_ANY
+
+	// PositionD does not expose its value, so only its presence is compared.
+	EXPECT_EQ(cd.hasAnyPosition(), lcd.hasAnyPosition());
+}
+
+}
+
+TEST(LazyCompositeData, MatchesCompositeDataForEveryGroup)
+{
+	expectSameAsCompositeData(binaryPacket(DecodedFields));
+}
+
+TEST(LazyCompositeData, MatchesCompositeDataForEachGroup)
+{
+	for (size_t g = 0; g < 7; g++)
+	{
+		SCOPED_TRACE(g);
+
+		uint16_t groupFields[7] = { 0 };
+		groupFields[g] = DecodedFields[g];
+
+		expectSameAsCompositeData(binaryPacket(groupFields));
+	}
+}
+
+TEST(LazyCompositeData, MatchesCompositeDataForTheRosNodeLayout)
+{
+	const uint16_t groupFields[7] = {
+		COMMONGROUP_TIMESTARTUP | COMMONGROUP_YAWPITCHROLL | COMMONGROUP_QUATERNION | COMMONGROUP_ANGULARRATE |
+			COMMONGROUP_POSITION | COMMONGROUP_ACCEL | COMMONGROUP_MAGPRES,
+		TIMEGROUP_GPSTOW | TIMEGROUP_GPSWEEK | TIMEGROUP_TIMEUTC,
+		IMUGROUP_NONE,
+		GPSGROUP_NONE,
+		ATTITUDEGROUP_YPRU,
+		INSGROUP_INSSTATUS | INSGROUP_POSECEF | INSGROUP_VELBODY | INSGROUP_VELNED | INSGROUP_ACCELECEF |
+			INSGROUP_POSU | INSGROUP_VELU,
+		GPSGROUP_NONE };
+
+	expectSameAsCompositeData(binaryPacket(groupFields));
+}
+
+TEST(LazyCompositeData, RejectsATruncatedPacket)
+{
+	string data = binaryPacket(DecodedFields);
+	Packet packet(data.substr(0, data.size() / 2));
+
+	LazyCompositeData lcd;
+
+	EXPECT_FALSE(LazyCompositeData::tryParse(packet, lcd));
+	EXPECT_FALSE(lcd.hasYawPitchRoll());
+	EXPECT_THROW(LazyCompositeData::parse(packet, lcd), vn::invalid_operation);
+}
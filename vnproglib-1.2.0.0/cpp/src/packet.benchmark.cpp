@@ -0,0 +1,125 @@
+#include "hayai.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "vn/packet.h"
+#include "vn/error_detection.h"
+
+using namespace std;
+using namespace vn::math;
+using namespace vn::protocol::uart;
+using namespace vn::data::integrity;
+
+namespace {
+
+const size_t NumOfPackets = 10000;
+
+string asciiPacket(const char* body)
+{
+	char checksum[8];
+	sprintf(checksum, "*%02X\r\n", Checksum8::compute(body, strlen(body)));
+
+	return string("$") + body + checksum;
+}
+
+// VNYMR and VNINS messages as a sensor outputs them.
+string YmrPacket = asciiPacket("VNYMR,+010.500,-002.250,+179.000,+00.1000,-00.2000,+00.3000,-00.010,+00.020,-09.810,+0.001000,-0.002000,+0.003000");
+string InsPacket = asciiPacket("VNINS,342151.750000,2045,0DBF,+010.500,-002.250,+179.000,+37.12345678,-122.12345678,+00012.345,+000.100,-000.200,+000.300,+01.0,+002.5,+0.05");
+
+// The tokenizer the packet parsers used before, which writes a terminator
+// over each delimiter so the fields can be passed to the C library.
+char* cTokenize(char* str, size_t& startIndex)
+{
+	size_t origIndex = startIndex;
+
+	if (str[startIndex - 1] == '*')
+		return NULL;
+
+	while (str[startIndex] != ',' && str[startIndex] != '*')
+	{
+		if (str[startIndex] < ' ' || str[startIndex] > '~' || str[startIndex] == '$')
+			return NULL;
+		startIndex++;
+	}
+
+	str[startIndex++] = '\0';
+
+	return str + origIndex;
+}
+
+// Parses the fields of a message the way the packet parsers used to, with
+// std::atof, std::atoi and std::strtoul on a copy of the packet. The copy
+// stands in for the one the parsers relied on before, since the tokenizer
+// modifies the data.
+template<size_t numOfFields>
+void parseWithCLibrary(const string& packet, const char (&kinds)[numOfFields], double* values)
+{
+	char buffer[256];
+	memcpy(buffer, packet.data(), packet.size());
+
+	size_t index = 7;
+
+	for (size_t i = 0; i < numOfFields; i++)
+	{
+		char* result = cTokenize(buffer, index);
+		if (result == NULL)
+			return;
+
+		switch (kinds[i])
+		{
+			case 'f': values[i] = atof(result); break;
+			case 'i': values[i] = atoi(result); break;
+			case 'x': values[i] = static_cast<double>(strtoul(result, NULL, 16)); break;
+		}
+	}
+}
+
+const char YmrFields[12] = { 'f', 'f', 'f', 'f', 'f', 'f', 'f', 'f', 'f', 'f', 'f', 'f' };
+const char InsFields[15] = { 'f', 'i', 'x', 'f', 'f', 'f', 'f', 'f', 'f', 'f', 'f', 'f', 'f', 'f', 'f' };
+
+}
+
+BENCHMARK(AsciiParse, YmrWithCLibrary, 10, 10)
+{
+	double values[12];
+
+	for (size_t i = 0; i < NumOfPackets; i++)
+		parseWithCLibrary(YmrPacket, YmrFields, values);
+}
+
+BENCHMARK(AsciiParse, Ymr, 10, 10)
+{
+	vec3f yawPitchRoll, magnetic, acceleration, angularRate;
+
+	for (size_t i = 0; i < NumOfPackets; i++)
+	{
+		PacketView p(&YmrPacket[0], YmrPacket.size());
+		p.parseVNYMR(&yawPitchRoll, &magnetic, &acceleration, &angularRate);
+	}
+}
+
+BENCHMARK(AsciiParse, InsWithCLibrary, 10, 10)
+{
+	double values[15];
+
+	for (size_t i = 0; i < NumOfPackets; i++)
+		parseWithCLibrary(InsPacket, InsFields, values);
+}
+
+BENCHMARK(AsciiParse, Ins, 10, 10)
+{
+	double time;
+	uint16_t week, status;
+	vec3f yawPitchRoll, nedVel;
+	vec3d lla;
+	float attUncertainty, posUncertainty, velUncertainty;
+
+	for (size_t i = 0; i < NumOfPackets; i++)
+	{
+		PacketView p(&InsPacket[0], InsPacket.size());
+		p.parseVNINS(&time, &week, &status, &yawPitchRoll, &lla, &nedVel, &attUncertainty, &posUncertainty, &velUncertainty);
+	}
+}
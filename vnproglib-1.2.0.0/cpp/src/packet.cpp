@@ -2,19 +2,13 @@
 #include "vn/utilities.h"
 #include "vn/error_detection.h"
 #include "vn/compiler.h"
-
-// TODO : Remove all C style coding where possible
-#include <stdio.h>
+#include "vn/commandbuilder.h"
 
 // TODO : Make this more compiler compatible incase
 // the user's compiler is not C++11 compliant
 #include <cstdlib>
 #include <cstring>
 #include <string>
-#include <queue>
-#include <list>
-
-#include <cstring>
 
 #if PYTHON
 	#include "python.hpp"
@@ -26,12 +20,12 @@
 	if (result == NULL) \
 		return;
 
-#define ATOFF static_cast<float>(std::atof(result))
-#define ATOFD std::atof(result)
-#define ATOU32 static_cast<uint32_t>(std::atoi(result))
-#define ATOU16X ((uint16_t) std::strtoul(result, NULL, 16))
-#define ATOU16 static_cast<uint16_t>(std::atoi(result))
-#define ATOU8 static_cast<uint8_t>(std::atoi(result))
+#define ATOFF static_cast<float>(parseAsciiDouble(result))
+#define ATOFD parseAsciiDouble(result)
+#define ATOU32 static_cast<uint32_t>(parseAsciiInt(result))
+#define ATOU16X ((uint16_t) parseAsciiHex(result))
+#define ATOU16 static_cast<uint16_t>(parseAsciiInt(result))
+#define ATOU8 static_cast<uint8_t>(parseAsciiInt(result))
 
 using namespace std;
 using namespace vn::math;
@@ -42,85 +36,573 @@ namespace vn {
 namespace protocol {
 namespace uart {
 
-char* vnstrtok(char* str, size_t& startIndex);
+const char* vnstrtok(const char* str, size_t& startIndex);
+
+namespace {
+
+// Packs the three character message identifier that follows "$VN" into a
+// single 24-bit key so it can be dispatched with one switch statement.
+#define ASCII_HEADER_KEY(a, b, c) (((a) << 16) | ((b) << 8) | (c))
+
+enum AsciiHeaderKind
+{
+	ASCIIHEADER_UNKNOWN,
+	ASCIIHEADER_ERROR,
+	ASCIIHEADER_RESPONSE,
+	ASCIIHEADER_BOOTLOADER,		// Both a response and a bootloader message.
+	ASCIIHEADER_ASYNC
+};
+
+// Classifies an ASCII message from its identifier. For asynchronous messages,
+// asyncType is set to the matching type, or VNOFF if the library has no
+// AsciiAsync value for it.
+AsciiHeaderKind classifyAsciiHeader(const char* pAT, AsciiAsync& asyncType)
+{
+	const int key = ASCII_HEADER_KEY(
+		static_cast<unsigned char>(pAT[0]),
+		static_cast<unsigned char>(pAT[1]),
+		static_cast<unsigned char>(pAT[2]));
+
+	asyncType = VNOFF;
+
+	switch (key)
+	{
+	case ASCII_HEADER_KEY('E', 'R', 'R'):
+		return ASCIIHEADER_ERROR;
+
+	case ASCII_HEADER_KEY('W', 'R', 'G'):
+	case ASCII_HEADER_KEY('R', 'R', 'G'):
+	case ASCII_HEADER_KEY('W', 'N', 'V'):
+	case ASCII_HEADER_KEY('R', 'F', 'S'):
+	case ASCII_HEADER_KEY('R', 'S', 'T'):
+	case ASCII_HEADER_KEY('F', 'W', 'U'):
+	case ASCII_HEADER_KEY('C', 'M', 'D'):
+	case ASCII_HEADER_KEY('A', 'S', 'Y'):
+	case ASCII_HEADER_KEY('T', 'A', 'R'):
+	case ASCII_HEADER_KEY('K', 'M', 'D'):
+	case ASCII_HEADER_KEY('K', 'A', 'D'):
+	case ASCII_HEADER_KEY('S', 'G', 'B'):
+	case ASCII_HEADER_KEY('D', 'B', 'S'):
+	case ASCII_HEADER_KEY('M', 'C', 'U'):
+	case ASCII_HEADER_KEY('S', 'B', 'L'):
+	case ASCII_HEADER_KEY('S', 'P', 'S'):
+		return ASCIIHEADER_RESPONSE;
+
+	case ASCII_HEADER_KEY('B', 'L', 'D'):
+		return ASCIIHEADER_BOOTLOADER;
+
+	case ASCII_HEADER_KEY('Y', 'P', 'R'): asyncType = VNYPR; return ASCIIHEADER_ASYNC;
+	case ASCII_HEADER_KEY('Q', 'T', 'N'): asyncType = VNQTN; return ASCIIHEADER_ASYNC;
+	#ifdef INTERNAL
+	case ASCII_HEADER_KEY('Q', 'T', 'M'): asyncType = VNQTM; return ASCIIHEADER_ASYNC;
+	case ASCII_HEADER_KEY('Q', 'T', 'A'): asyncType = VNQTA; return ASCIIHEADER_ASYNC;
+	case ASCII_HEADER_KEY('Q', 'T', 'R'): asyncType = VNQTR; return ASCIIHEADER_ASYNC;
+	case ASCII_HEADER_KEY('Q', 'M', 'A'): asyncType = VNQMA; return ASCIIHEADER_ASYNC;
+	case ASCII_HEADER_KEY('Q', 'A', 'R'): asyncType = VNQAR; return ASCIIHEADER_ASYNC;
+	#endif
+	case ASCII_HEADER_KEY('Q', 'M', 'R'): asyncType = VNQMR; return ASCIIHEADER_ASYNC;
+	#ifdef INTERNAL
+	case ASCII_HEADER_KEY('D', 'C', 'M'): asyncType = VNDCM; return ASCIIHEADER_ASYNC;
+	#endif
+	case ASCII_HEADER_KEY('M', 'A', 'G'): asyncType = VNMAG; return ASCIIHEADER_ASYNC;
+	case ASCII_HEADER_KEY('A', 'C', 'C'): asyncType = VNACC; return ASCIIHEADER_ASYNC;
+	case ASCII_HEADER_KEY('G', 'Y', 'R'): asyncType = VNGYR; return ASCIIHEADER_ASYNC;
+	case ASCII_HEADER_KEY('M', 'A', 'R'): asyncType = VNMAR; return ASCIIHEADER_ASYNC;
+	case ASCII_HEADER_KEY('Y', 'M', 'R'): asyncType = VNYMR; return ASCIIHEADER_ASYNC;
+	#ifdef INTERNAL
+	case ASCII_HEADER_KEY('Y', 'C', 'M'): asyncType = VNYCM; return ASCIIHEADER_ASYNC;
+	#endif
+	case ASCII_HEADER_KEY('Y', 'B', 'A'): asyncType = VNYBA; return ASCIIHEADER_ASYNC;
+	case ASCII_HEADER_KEY('Y', 'I', 'A'): asyncType = VNYIA; return ASCIIHEADER_ASYNC;
+	#ifdef INTERNAL
+	case ASCII_HEADER_KEY('I', 'C', 'M'): asyncType = VNICM; return ASCIIHEADER_ASYNC;
+	#endif
+	case ASCII_HEADER_KEY('I', 'M', 'U'): asyncType = VNIMU; return ASCIIHEADER_ASYNC;
+	case ASCII_HEADER_KEY('G', 'P', 'S'): asyncType = VNGPS; return ASCIIHEADER_ASYNC;
+	case ASCII_HEADER_KEY('G', 'P', 'E'): asyncType = VNGPE; return ASCIIHEADER_ASYNC;
+	case ASCII_HEADER_KEY('I', 'N', 'S'): asyncType = VNINS; return ASCIIHEADER_ASYNC;
+	case ASCII_HEADER_KEY('I', 'N', 'E'): asyncType = VNINE; return ASCIIHEADER_ASYNC;
+	case ASCII_HEADER_KEY('I', 'S', 'L'): asyncType = VNISL; return ASCIIHEADER_ASYNC;
+	case ASCII_HEADER_KEY('I', 'S', 'E'): asyncType = VNISE; return ASCIIHEADER_ASYNC;
+	case ASCII_HEADER_KEY('D', 'T', 'V'): asyncType = VNDTV; return ASCIIHEADER_ASYNC;
+	case ASCII_HEADER_KEY('G', '2', 'S'): asyncType = VNG2S; return ASCIIHEADER_ASYNC;
+	case ASCII_HEADER_KEY('G', '2', 'E'): asyncType = VNG2E; return ASCIIHEADER_ASYNC;
+	#ifdef INTERNAL
+	case ASCII_HEADER_KEY('R', 'A', 'W'): asyncType = VNRAW; return ASCIIHEADER_ASYNC;
+	case ASCII_HEADER_KEY('C', 'M', 'V'): asyncType = VNCMV; return ASCIIHEADER_ASYNC;
+	case ASCII_HEADER_KEY('S', 'T', 'V'): asyncType = VNSTV; return ASCIIHEADER_ASYNC;
+	case ASCII_HEADER_KEY('C', 'O', 'V'): asyncType = VNCOV; return ASCIIHEADER_ASYNC;
+	#endif
+	case ASCII_HEADER_KEY('R', 'T', 'K'):
+		// Recognized as asynchronous output, but there is no AsciiAsync value
+		// for it yet.
+		return ASCIIHEADER_ASYNC;
+
+	default:
+		return ASCIIHEADER_UNKNOWN;
+	}
+}
+
+#undef ASCII_HEADER_KEY
 
-const unsigned char Packet::BinaryGroupLengths[sizeof(uint8_t)*8][sizeof(uint16_t)*15] = {
-	{ 8,  8,  8, 12, 16, 12, 24, 12, 12, 24, 20, 28,  2,  4,  8},		// Group 1
-	{ 8,  8,  8,  2,  8,  8,  8,  4,  4,  1,  0,  0,  0,  0,  0},		// Group 2
-	{ 2, 12, 12, 12,  4,  4, 16, 12, 12, 12, 12,  2, 40,  0,  0},		// Group 3
-	{ 8,  8,  2,  1,  1, 24, 24, 12, 12, 12,  4,  4,  2, 28,  0},		// Group 4
-	{ 2, 12, 16, 36, 12, 12, 12, 12, 12, 12, 28, 24,  12,  0,  0},		// Group 5
-	{ 2, 24, 24, 12, 12, 12, 12, 12, 12,  4,  4, 68, 64,  0,  0},		// Group 6
-	{ 8,  8,  2,  1,  1, 24, 24, 12, 12, 12,  4,  4,  2, 28,  0},		// Group 7
+}
+
+#define GROUP_LENGTHS(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14) \
+	{ a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14 },
+
+const unsigned char PacketView::BinaryGroupLengths[sizeof(uint8_t)*8][sizeof(uint16_t)*15] = {
+	VN_BINARY_GROUP_FIELD_LENGTHS(GROUP_LENGTHS)
 	{ 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0}		// Invalid group
 };
 
-Packet::Packet() :
-	_isPacketDataMine(false),
+#undef GROUP_LENGTHS
+
+// Expands to the combined lengths of the fields selected by each of the 16
+// values of a nibble, given the lengths of the nibble's four fields.
+#define NIBBLE_LENGTHS(a, b, c, d) \
+	{ 0, a, b, a+b, c, a+c, b+c, a+b+c, d, a+d, b+d, a+b+d, c+d, a+c+d, b+c+d, a+b+c+d }
+
+// Bit 15 of a group field does not select a field, so its length is always 0.
+#define GROUP_NIBBLE_LENGTHS(a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14) \
+	{ NIBBLE_LENGTHS(a0, a1, a2, a3), NIBBLE_LENGTHS(a4, a5, a6, a7), NIBBLE_LENGTHS(a8, a9, a10, a11), NIBBLE_LENGTHS(a12, a13, a14, 0) },
+
+const unsigned char PacketView::BinaryGroupNibbleLengths[8][4][16] = {
+	VN_BINARY_GROUP_FIELD_LENGTHS(GROUP_NIBBLE_LENGTHS)
+	{ NIBBLE_LENGTHS( 0,  0,  0,  0), NIBBLE_LENGTHS( 0,  0,  0,  0), NIBBLE_LENGTHS( 0,  0,  0,  0), NIBBLE_LENGTHS( 0,  0,  0,  0) }		// Invalid group
+};
+
+#undef GROUP_NIBBLE_LENGTHS
+#undef NIBBLE_LENGTHS
+
+namespace {
+
+// Returns the row of the binary group length tables for the provided group,
+// which is the invalid group row if no group is specified.
+inline size_t binaryGroupIndex(BinaryGroup group)
+{
+	switch (group)
+	{
+	case BINARYGROUP_COMMON:	return 0;
+	case BINARYGROUP_TIME:		return 1;
+	case BINARYGROUP_IMU:		return 2;
+	case BINARYGROUP_GPS:		return 3;
+	case BINARYGROUP_ATTITUDE:	return 4;
+	case BINARYGROUP_INS:		return 5;
+	case BINARYGROUP_GPS2:		return 6;
+	default:					return 7;
+	}
+}
+
+}
+
+namespace {
+
+// The powers of ten which are exactly representable as a double.
+const double ExactPowersOfTen[] = {
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+// Returns the number of characters in the ASCII field starting at str, which
+// ends at the next comma, asterisk or unprintable character.
+size_t asciiFieldLength(const char* str)
+{
+	size_t length = 0;
+
+	while (str[length] != ',' && str[length] != '*' && str[length] >= ' ' && str[length] <= '~')
+		length++;
+
+	return length;
+}
+
+// Copies the ASCII field starting at str into buffer as a null-terminated
+// string, truncating it if it does not fit.
+void copyAsciiField(const char* str, char* buffer, size_t bufferSize)
+{
+	size_t length = asciiFieldLength(str);
+
+	if (length > bufferSize - 1)
+		length = bufferSize - 1;
+
+	memcpy(buffer, str, length);
+	buffer[length] = '\0';
+}
+
+// Converts the ASCII field starting at str to a double, giving the same
+// result as std::atof in the "C" locale. Fields in the fixed formats the
+// sensor outputs, such as %+08.3f, have at most 19 significant digits and a
+// small decimal exponent, so the value is computed exactly from an integer
+// mantissa and a power of ten without consulting the locale. Anything else
+// falls back to std::strtod.
+double parseAsciiDouble(const char* str)
+{
+	const char* c = str;
+	bool isNegative = false;
+
+	if (*c == '+' || *c == '-')
+		isNegative = *c++ == '-';
+
+	uint64_t mantissa = 0;
+	int significantDigits = 0;
+	int exponent = 0;
+	bool hasDigits = false;
+
+	for (; *c >= '0' && *c <= '9'; c++)
+	{
+		if (mantissa != 0 || *c != '0')
+			significantDigits++;
+
+		mantissa = mantissa * 10 + static_cast<uint64_t>(*c - '0');
+		hasDigits = true;
+
+		if (significantDigits > 19)
+			break;
+	}
+
+	if (*c == '.' && significantDigits <= 19)
+	{
+		for (c++; *c >= '0' && *c <= '9'; c++)
+		{
+			if (mantissa != 0 || *c != '0')
+				significantDigits++;
+
+			mantissa = mantissa * 10 + static_cast<uint64_t>(*c - '0');
+			exponent--;
+			hasDigits = true;
+
+			if (significantDigits > 19)
+				break;
+		}
+	}
+
+	// An exponent is only part of the number if it has digits.
+	if ((*c == 'e' || *c == 'E') && hasDigits)
+	{
+		const char* e = c + 1;
+		bool isNegativeExponent = false;
+
+		if (*e == '+' || *e == '-')
+			isNegativeExponent = *e++ == '-';
+
+		if (*e >= '0' && *e <= '9')
+		{
+			int value = 0;
+
+			for (; *e >= '0' && *e <= '9'; e++)
+			{
+				if (value < 1000)
+					value = value * 10 + (*e - '0');
+			}
+
+			exponent += isNegativeExponent ? -value : value;
+			c = e;
+		}
+	}
+
+	// Hexadecimal, infinity and NaN values, leading whitespace, too many
+	// digits and mantissas or exponents that cannot be scaled exactly are
+	// left to the C library.
+	if (!hasDigits || significantDigits > 19 || *c == 'x' || *c == 'X'
+		|| mantissa > (static_cast<uint64_t>(1) << 53)
+		|| exponent < -22 || exponent > 22)
+	{
+		char buffer[64];
+
+		copyAsciiField(str, buffer, sizeof(buffer));
+
+		return std::strtod(buffer, NULL);
+	}
+
+	// Both operands are exact, so the single rounding of the division or
+	// multiplication gives the correctly rounded value, as strtod does.
+	double value = static_cast<double>(mantissa);
+
+	if (exponent < 0)
+		value /= ExactPowersOfTen[-exponent];
+	else
+		value *= ExactPowersOfTen[exponent];
+
+	return isNegative ? -value : value;
+}
+
+// Converts the ASCII field starting at str to an int, giving the same result
+// as std::atoi. Values which might not fit in an int fall back to std::atoi.
+int parseAsciiInt(const char* str)
+{
+	const char* c = str;
+	bool isNegative = false;
+
+	if (*c == '+' || *c == '-')
+		isNegative = *c++ == '-';
+
+	int value = 0;
+	int digits = 0;
+
+	for (; *c >= '0' && *c <= '9'; c++)
+	{
+		if (++digits > 9)
+			break;
+
+		value = value * 10 + (*c - '0');
+	}
+
+	if (digits == 0 || digits > 9)
+	{
+		char buffer[64];
+
+		copyAsciiField(str, buffer, sizeof(buffer));
+
+		return std::atoi(buffer);
+	}
+
+	return isNegative ? -value : value;
+}
+
+// Converts the hexadecimal ASCII field starting at str to an unsigned long,
+// giving the same result as std::strtoul with a base of 16.
+unsigned long parseAsciiHex(const char* str)
+{
+	const char* c = str;
+	unsigned long value = 0;
+	int digits = 0;
+
+	// A leading 0x is accepted by strtoul but never output by the sensor.
+	bool hasPrefix = c[0] == '0' && (c[1] == 'x' || c[1] == 'X');
+
+	for (; digits < 9 && !hasPrefix; c++, digits++)
+	{
+		if (*c >= '0' && *c <= '9')
+			value = (value << 4) | static_cast<unsigned long>(*c - '0');
+		else if (*c >= 'A' && *c <= 'F')
+			value = (value << 4) | static_cast<unsigned long>(*c - 'A' + 10);
+		else if (*c >= 'a' && *c <= 'f')
+			value = (value << 4) | static_cast<unsigned long>(*c - 'a' + 10);
+		else
+			break;
+	}
+
+	if (digits == 0 || digits > 8)
+	{
+		char buffer[64];
+
+		copyAsciiField(str, buffer, sizeof(buffer));
+
+		return std::strtoul(buffer, NULL, 16);
+	}
+
+	return value;
+}
+
+}
+
+PacketView::PacketView() :
 	_length(0),
-	_data(NULL)
+	_data(NULL),
+	_curExtractLoc(0)
 {
+	initializeCachedState();
 }
 
-Packet::Packet(char const* packet, size_t length) :
-	_isPacketDataMine(true),
+PacketView::PacketView(char* packet, size_t length) :
 	_length(length),
-	_data(new char[length]),
+	_data(packet),
 	_curExtractLoc(0)
 {
-	std::memcpy(_data, packet, length);
+	initializeCachedState();
 }
 
-Packet::Packet(string packet) :
-	_isPacketDataMine(true),
-	_length(packet.size()),
-	_data(new char[packet.size()]),
+PacketView::PacketView(PacketView const& toCopy) :
+	_length(toCopy._length),
+	_data(toCopy._data),
 	_curExtractLoc(0)
 {
-	std::memcpy(_data, packet.c_str(), packet.size());
+	copyCachedStateFrom(toCopy);
+}
+
+PacketView& PacketView::operator=(PacketView const& from)
+{
+	if (this == &from)
+		return *this;
+
+	_data = from._data;
+	_length = from._length;
+	_curExtractLoc = from._curExtractLoc;
+	copyCachedStateFrom(from);
+
+	return *this;
+}
+
+Packet PacketView::retain() const
+{
+	return Packet(*this);
+}
+
+void PacketView::initializeCachedState()
+{
+	_isValidityKnown = false;
+	_isValid = false;
+	_isClassified = false;
+	_isError = false;
+	_isResponse = false;
+	_isBootloader = false;
+	_isAsciiAsync = false;
+	_asciiAsyncType = VNOFF;
+}
+
+void PacketView::copyCachedStateFrom(PacketView const& from)
+{
+	_isValidityKnown = from._isValidityKnown;
+	_isValid = from._isValid;
+	_isClassified = from._isClassified;
+	_isError = from._isError;
+	_isResponse = from._isResponse;
+	_isBootloader = from._isBootloader;
+	_isAsciiAsync = from._isAsciiAsync;
+	_asciiAsyncType = from._asciiAsyncType;
+}
+
+Packet::Packet() :
+	_isPacketDataMine(false)
+{
+}
+
+Packet::Packet(char const* packet, size_t length) :
+	_isPacketDataMine(false)
+{
+	copyDataFrom(packet, length);
+}
+
+Packet::Packet(string packet) :
+	_isPacketDataMine(false)
+{
+	copyDataFrom(packet.c_str(), packet.size());
 }
 
 Packet::Packet(Packet const& toCopy) :
-	_isPacketDataMine(true),
-	_length(toCopy._length),
-	_data(new char[toCopy._length]),
-	_curExtractLoc(0)
+	PacketView(),
+	_isPacketDataMine(false)
 {
-	std::memcpy(_data, toCopy._data, toCopy._length);
+	copyCachedStateFrom(toCopy);
+	copyDataFrom(toCopy._data, toCopy._length);
 }
 
+Packet::Packet(PacketView const& toCopy) :
+	_isPacketDataMine(false)
+{
+	copyCachedStateFrom(toCopy);
+	copyDataFrom(toCopy.data(), toCopy.length());
+}
+
+#if VN_SUPPORTS_MOVE
+
+Packet::Packet(Packet&& toMove) :
+	_isPacketDataMine(false)
+{
+	copyCachedStateFrom(toMove);
+	moveDataFrom(toMove);
+}
+
+#endif
+
 Packet::~Packet()
 {
-	if (_isPacketDataMine)
-	{
-		delete[] _data;
-	}
+	releaseData();
 }
 
 Packet& Packet::operator=(Packet const& from)
 {
-	if (_isPacketDataMine)
-	{
-		delete[] _data;
-	}
+	if (this == &from)
+		return *this;
 
+	releaseData();
 
-	_isPacketDataMine = true;
-	_data = new char[from._length];
-	_length = from._length;
+	copyDataFrom(from._data, from._length);
 	_curExtractLoc = from._curExtractLoc;
+	copyCachedStateFrom(from);
+
+	return *this;
+}
 
-	std::memcpy(_data, from._data, from._length);
+#if VN_SUPPORTS_MOVE
+
+Packet& Packet::operator=(Packet&& from)
+{
+	if (this == &from)
+		return *this;
+
+	releaseData();
+
+	_curExtractLoc = from._curExtractLoc;
+	copyCachedStateFrom(from);
+	moveDataFrom(from);
 
 	return *this;
 }
 
-string Packet::datastr()
+#endif
+
+void Packet::releaseData()
+{
+	if (_isPacketDataMine && _data != _inlineData)
+		delete[] _data;
+
+	_isPacketDataMine = false;
+	_data = NULL;
+	_length = 0;
+}
+
+void Packet::copyDataFrom(const char* data, size_t length)
+{
+	// Expects any previous data to already be released.
+	_data = length <= MaximumInlineDataSize ? _inlineData : new char[length];
+	_length = length;
+	_isPacketDataMine = true;
+
+	std::memcpy(_data, data, length);
+}
+
+#if VN_SUPPORTS_MOVE
+
+void Packet::moveDataFrom(Packet& from)
+{
+	// Expects any previous data to already be released.
+	if (from._isPacketDataMine && from._data != from._inlineData)
+	{
+		// Take over the allocated data.
+		_data = from._data;
+		_length = from._length;
+		_isPacketDataMine = true;
+
+		from._isPacketDataMine = false;
+		from._data = NULL;
+		from._length = 0;
+	}
+	else
+	{
+		// Inline data has to be copied, and data which is not owned by the
+		// other packet may not outlive it.
+		copyDataFrom(from._data, from._length);
+	}
+}
+
+#endif
+
+string PacketView::datastr()
 {
 	return string(_data, _length);
 }
 
-Packet::Type Packet::type()
+const char* PacketView::data() const
+{
+	return _data;
+}
+
+size_t PacketView::length() const
+{
+	return _length;
+}
+
+PacketView::Type PacketView::type()
 {
 	if (_length < 1)
 		throw invalid_operation("Packet does not contain any data.");
@@ -142,26 +624,54 @@ Packet::Type Packet::type()
 	return TYPE_UNKNOWN;
 }
 
-bool Packet::isValid()
+bool PacketView::isValid()
 {
+	bool valid;
+
+	if (!tryIsValid(valid))
+		throw not_implemented();
+
+	return valid;
+}
+
+bool PacketView::tryIsValid(bool& valid) VN_NOEXCEPT
+{
+	if (!_isValidityKnown)
+	{
+		if (!checkIsValid(_isValid))
+			return false;
+
+		_isValidityKnown = true;
+	}
+
+	valid = _isValid;
+
+	return true;
+}
+
+bool PacketView::checkIsValid(bool& valid) VN_NOEXCEPT
+{
+	valid = false;
+
 	if (_length < 7)  // minumum binary packet is 7 bytes, minimum ASCII is 8 bytes
-		return false;
+		return true;
 
 	if (type() == TYPE_ASCII)
 	{
 		// First determine if this packet does not have a checksum or CRC.
 		if (_data[_length - 3] == 'X' && _data[_length - 4] == 'X')
-			return true;
-
-		// First determine if this packet has an 8-bit checksum or a 16-bit CRC.
-		if (_data[_length - 5] == '*')
+		{
+			valid = true;
+		}
+		// Next determine if this packet has an 8-bit checksum or a 16-bit CRC.
+		else if (_data[_length - 5] == '*')
 		{
 			// Appears we have an 8-bit checksum packet.
 			uint8_t expectedChecksum = toUint8FromHexStr(_data + _length - 4);
 
 			uint8_t computedChecksum = Checksum8::compute(_data + 1, _length - 6);
 
-			return expectedChecksum == computedChecksum;
+			valid = expectedChecksum == computedChecksum;
 		}
 		else if (_data[_length - 7] == '*')
 		{
@@ -170,7 +680,7 @@ bool Packet::isValid()
 
 			uint16_t computedCrc = Crc16::compute(_data + 1, _length - 8);
 
-			return packetCrc == computedCrc;
+			valid = packetCrc == computedCrc;
 		}
 		else if (_data[_length - 6] == '*') // ASCII Responses curing bootloader mode
 		{
@@ -179,19 +689,19 @@ bool Packet::isValid()
 
 			uint16_t computedCrc = Crc16::compute(_data + 1, _length - 7);
 
-			return packetCrc == computedCrc;
-		}
-		else
-		{
-			// Don't know what we have.
-			return false;
+			valid = packetCrc == computedCrc;
 		}
+
+		// Otherwise we don't know what we have and the packet is invalid.
+		return true;
 	}
 	else if (type() == TYPE_BINARY)
 	{
 		uint16_t computedCrc = Crc16::compute(_data + 1, _length - 1);
 
-		return computedCrc == 0;
+		valid = computedCrc == 0;
+
+		return true;
 	}
 	else
 	{
@@ -199,239 +709,144 @@ bool Packet::isValid()
 		char bootloadSignature[] = "VectorNav Bootloader";
 		if (strncmp(_data, bootloadSignature, sizeof(bootloadSignature) - 1) == 0)
 		{
+			valid = true;
+
 			return true;
 		}
 
-		throw not_implemented();
+		// The integrity of packets of an unknown type cannot be checked.
+		return false;
 	}
 }
 
-bool Packet::isError()
+bool PacketView::isError()
 {
-	return std::strncmp(_data + 3, "ERR", 3) == 0;
+	classify();
+
+	return _isError;
 }
 
-bool Packet::isResponse()
+bool PacketView::isResponse()
 {
-	if (std::strncmp(_data + 3, "WRG", 3) == 0)
-		return true;
-	if (std::strncmp(_data + 3, "RRG", 3) == 0)
-		return true;
-	if (std::strncmp(_data + 3, "WNV", 3) == 0)
-		return true;
-	if (std::strncmp(_data + 3, "RFS", 3) == 0)
-		return true;
-	if (std::strncmp(_data + 3, "RST", 3) == 0)
-		return true;
-	if (std::strncmp(_data + 3, "FWU", 3) == 0)
-		return true;
-	if (std::strncmp(_data + 3, "CMD", 3) == 0)
-		return true;
-	if (std::strncmp(_data + 3, "ASY", 3) == 0)
-		return true;
-	if (std::strncmp(_data + 3, "TAR", 3) == 0)
-		return true;
-	if (std::strncmp(_data + 3, "KMD", 3) == 0)
-		return true;
-	if (std::strncmp(_data + 3, "KAD", 3) == 0)
-		return true;
-	if (std::strncmp(_data + 3, "SGB", 3) == 0)
-		return true;
-	if (std::strncmp(_data + 3, "DBS", 3) == 0)
-		return true;
-	if (std::strncmp(_data + 3, "MCU", 3) == 0)
-		return true;
-	if (std::strncmp(_data + 3, "SBL", 3) == 0)
-		return true;
-	if (std::strncmp(_data + 3, "SPS", 3) == 0)
-		return true;
-	if (std::strncmp(_data + 3, "BLD", 3) == 0)
-		return true;
-	if (std::strncmp(_data, "VectorNav Bootloader", 20) == 0)
-		return true;
+	classify();
+
+	return _isResponse;
+}
+
+void PacketView::classify()
+{
+	if (_isClassified)
+		return;
+
+	_isError = false;
+	_isResponse = false;
+	_isBootloader = false;
+	_isAsciiAsync = false;
+	_asciiAsyncType = VNOFF;
+
+	// Binary packets are never errors, responses, bootloader messages or
+	// ASCII asynchronous messages.
+	if (_length > 0 && static_cast<unsigned char>(_data[0]) != 0xFA)
+	{
+		AsciiHeaderKind kind = ASCIIHEADER_UNKNOWN;
+
+		if (_length >= 6)
+			kind = classifyAsciiHeader(_data + 3, _asciiAsyncType);
+
+		switch (kind)
+		{
+		case ASCIIHEADER_ERROR:
+			_isError = true;
+			break;
+
+		case ASCIIHEADER_RESPONSE:
+			_isResponse = true;
+			break;
+
+		case ASCIIHEADER_BOOTLOADER:
+			_isResponse = true;
+			_isBootloader = true;
+			break;
+
+		case ASCIIHEADER_ASYNC:
+			_isAsciiAsync = true;
+			break;
+
+		default:
+			if (_length >= 20 && std::strncmp(_data, "VectorNav Bootloader", 20) == 0)
+			{
+				_isResponse = true;
+				_isBootloader = true;
+			}
+			break;
+		}
+	}
+
+	_isClassified = true;
+}
+
+bool PacketView::isAsciiAsync()
+{
+	classify();
+
+	return _isAsciiAsync;
+}
+
+bool PacketView::isBootloader()
+{
+	classify();
+
+	return _isBootloader;
+}
+
+AsciiAsync PacketView::determineAsciiAsyncType()
+{
+	AsciiAsync type;
+
+	if (!tryDetermineAsciiAsyncType(type))
+		throw unknown_error();
 
-	return false;
+	return type;
 }
 
-bool Packet::isAsciiAsync()
+bool PacketView::tryDetermineAsciiAsyncType(AsciiAsync& type) VN_NOEXCEPT
 {
-	// Pointer to the unique asynchronous data type identifier.
-	char* pAT = _data + 3;
+	classify();
 
-	if (strncmp(pAT, "YPR", 3) == 0)
-		return true;
-	if (strncmp(pAT, "QTN", 3) == 0)
-		return true;
-	#ifdef INTERNAL
-	if (strncmp(pAT, "QTM", 3) == 0)
-		return true;
-	if (strncmp(pAT, "QTA", 3) == 0)
-		return true;
-	if (strncmp(pAT, "QTR", 3) == 0)
-		return true;
-	if (strncmp(pAT, "QMA", 3) == 0)
-		return true;
-	if (strncmp(pAT, "QAR", 3) == 0)
-		return true;
-	#endif
-	if (strncmp(pAT, "QMR", 3) == 0)
-		return true;
-	#ifdef INTERNAL
-	if (strncmp(pAT, "DCM", 3) == 0)
-		return true;
-	#endif
-	if (strncmp(pAT, "MAG", 3) == 0)
-		return true;
-	if (strncmp(pAT, "ACC", 3) == 0)
-		return true;
-	if (strncmp(pAT, "GYR", 3) == 0)
-		return true;
-	if (strncmp(pAT, "MAR", 3) == 0)
-		return true;
-	if (strncmp(pAT, "YMR", 3) == 0)
-		return true;
-	#ifdef INTERNAL
-	if (strncmp(pAT, "YCM", 3) == 0)
-		return true;
-	#endif
-	if (strncmp(pAT, "YBA", 3) == 0)
-		return true;
-	if (strncmp(pAT, "YIA", 3) == 0)
-		return true;
-	#ifdef INTERNAL
-	if (strncmp(pAT, "ICM", 3) == 0)
-		return true;
-	#endif
-	if (strncmp(pAT, "IMU", 3) == 0)
-		return true;
-	if (strncmp(pAT, "GPS", 3) == 0)
-		return true;
-	if (strncmp(pAT, "GPE", 3) == 0)
-		return true;
-	if (strncmp(pAT, "INS", 3) == 0)
-		return true;
-	if (strncmp(pAT, "INE", 3) == 0)
-		return true;
-	if (strncmp(pAT, "ISL", 3) == 0)
-		return true;
-	if (strncmp(pAT, "ISE", 3) == 0)
-		return true;
-	if (strncmp(pAT, "DTV", 3) == 0)
-		return true;
-	if(strncmp(pAT, "G2S", 3) == 0)
-		return true;
-	if(strncmp(pAT, "G2E", 3) == 0)
-		return true;
-	#ifdef INTERNAL
-	if (strncmp(pAT, "RAW", 3) == 0)
-		return true;
-	if (strncmp(pAT, "CMV", 3) == 0)
-		return true;
-	if (strncmp(pAT, "STV", 3) == 0)
-		return true;
-	if (strncmp(pAT, "COV", 3) == 0)
-		return true;
-	#endif
-	if (strncmp(pAT, "RTK", 3) == 0)
-		return true;
+	if (!_isAsciiAsync || _asciiAsyncType == VNOFF)
+		return false;
+
+	type = _asciiAsyncType;
 
-	return false;
+	return true;
 }
 
-bool Packet::isBootloader()
+size_t PacketView::countAsciiFields() const VN_NOEXCEPT
 {
-	if (std::strncmp(_data + 3, "BLD", 3) == 0)
-		return true;
-	if (std::strncmp(_data, "VectorNav Bootloader", 20) == 0)
-		return true;
+	// Steps over the fields the same way vnstrtok does, so the count is the
+	// number of fields the parse routines are able to read.
+	if (_length < 8 || _data[6] == '*')
+		return 0;
 
-	return false;
-}
+	size_t count = 0;
 
-AsciiAsync Packet::determineAsciiAsyncType()
-{
-	// Pointer to the unique asynchronous data type identifier.
-	char* pAT = _data + 3;
+	for (size_t i = 7; i < _length; i++)
+	{
+		char c = _data[i];
 
-	if (strncmp(pAT, "YPR", 3) == 0)
-		return VNYPR;
-	if (strncmp(pAT, "QTN", 3) == 0)
-		return VNQTN;
-	#ifdef INTERNAL
-	if (strncmp(pAT, "QTM", 3) == 0)
-		return VNQTM;
-	if (strncmp(pAT, "QTA", 3) == 0)
-		return VNQTA;
-	if (strncmp(pAT, "QTR", 3) == 0)
-		return VNQTR;
-	if (strncmp(pAT, "QMA", 3) == 0)
-		return VNQMA;
-	if (strncmp(pAT, "QAR", 3) == 0)
-		return VNQAR;
-	#endif
-	if (strncmp(pAT, "QMR", 3) == 0)
-		return VNQMR;
-	#ifdef INTERNAL
-	if (strncmp(pAT, "DCM", 3) == 0)
-		return VNDCM;
-	#endif
-	if (strncmp(pAT, "MAG", 3) == 0)
-		return VNMAG;
-	if (strncmp(pAT, "ACC", 3) == 0)
-		return VNACC;
-	if (strncmp(pAT, "GYR", 3) == 0)
-		return VNGYR;
-	if (strncmp(pAT, "MAR", 3) == 0)
-		return VNMAR;
-	if (strncmp(pAT, "YMR", 3) == 0)
-		return VNYMR;
-	#ifdef INTERNAL
-	if (strncmp(pAT, "YCM", 3) == 0)
-		return VNYCM;
-	#endif
-	if (strncmp(pAT, "YBA", 3) == 0)
-		return VNYBA;
-	if (strncmp(pAT, "YIA", 3) == 0)
-		return VNYIA;
-	#ifdef INTERNAL
-	if (strncmp(pAT, "ICM", 3) == 0)
-		return VNICM;
-	#endif
-	if (strncmp(pAT, "IMU", 3) == 0)
-		return VNIMU;
-	if (strncmp(pAT, "GPS", 3) == 0)
-		return VNGPS;
-	if (strncmp(pAT, "GPE", 3) == 0)
-		return VNGPE;
-	if (strncmp(pAT, "INS", 3) == 0)
-		return VNINS;
-	if (strncmp(pAT, "INE", 3) == 0)
-		return VNINE;
-	if (strncmp(pAT, "ISL", 3) == 0)
-		return VNISL;
-	if (strncmp(pAT, "ISE", 3) == 0)
-		return VNISE;
-	if (strncmp(pAT, "DTV", 3) == 0)
-		return VNDTV;
-  if(strncmp(pAT, "G2S", 3) == 0)
-    return VNG2S;
-  if(strncmp(pAT, "G2E", 3) == 0)
-    return VNG2E;
-#ifdef INTERNAL
-	if (strncmp(pAT, "RAW", 3) == 0)
-		return VNRAW;
-	if (strncmp(pAT, "CMV", 3) == 0)
-		return VNCMV;
-	if (strncmp(pAT, "STV", 3) == 0)
-		return VNSTV;
-	if (strncmp(pAT, "COV", 3) == 0)
-		return VNCOV;
-	#endif
-	else
-		throw unknown_error();
+		if (c == '*')
+			return count + 1;
+
+		if (c == ',')
+			count++;
+		else if (c < ' ' || c > '~' || c == '$')
+			break;
+	}
+
+	return count;
 }
 
-bool Packet::isCompatible(CommonGroup commonGroup, TimeGroup timeGroup, ImuGroup imuGroup, GpsGroup gpsGroup, AttitudeGroup attitudeGroup, InsGroup insGroup, GpsGroup gps2Group)
+bool PacketView::isCompatible(CommonGroup commonGroup, TimeGroup timeGroup, ImuGroup imuGroup, GpsGroup gpsGroup, AttitudeGroup attitudeGroup, InsGroup insGroup, GpsGroup gps2Group)
 {
 	// First make sure the appropriate groups are specified.
 	uint8_t groups = _data[1];
@@ -538,19 +953,19 @@ bool Packet::isCompatible(CommonGroup commonGroup, TimeGroup timeGroup, ImuGroup
 
 }
 
-char* startAsciiPacketParse(char* packetStart, size_t& index)
+const char* startAsciiPacketParse(const char* packetStart, size_t& index)
 {
 	index = 7;
 
 	return vnstrtok(packetStart, index);
 }
 
-char* getNextData(char* str, size_t& startIndex)
+const char* getNextData(const char* str, size_t& startIndex)
 {
 	return vnstrtok(str, startIndex);
 }
 
-char* vnstrtok(char* str, size_t& startIndex)
+const char* vnstrtok(const char* str, size_t& startIndex)
 {
 	size_t origIndex = startIndex;
 
@@ -563,48 +978,152 @@ char* vnstrtok(char* str, size_t& startIndex)
 			return NULL;
 		startIndex++;
 	}
-	
-	str[startIndex++] = '\0';
+
+	// Step over the delimiter without terminating the field there, so the
+	// packet is left unmodified. The field conversions stop at the delimiter.
+	startIndex++;
 
 	return str + origIndex;
 }
 
-void Packet::ensureCanExtract(size_t numOfBytes)
+bool PacketView::canExtract(size_t numOfBytes) VN_NOEXCEPT
 {
 	if (_curExtractLoc == 0)
 		// Determine the location to start extracting.
 		_curExtractLoc = countSetBits(_data[1]) * 2 + 2;
 
-	if (_curExtractLoc + numOfBytes > _length - 2)
-		// About to overrun data.
+	// Make sure we are not about to overrun data.
+	return _curExtractLoc + numOfBytes <= _length - 2;
+}
+
+uint8_t PacketView::extractUint8()
+{
+	uint8_t d;
+
+	if (!tryExtract(d))
 		throw invalid_operation();
+
+	return d;
 }
 
-uint8_t Packet::extractUint8()
+int8_t PacketView::extractInt8()
 {
-	ensureCanExtract(sizeof(uint8_t));
+	int8_t d;
+
+	if (!tryExtract(d))
+		throw invalid_operation();
 
-	uint8_t d = *reinterpret_cast<uint8_t*>(_data + _curExtractLoc);
+	return d;
+}
 
-	_curExtractLoc += sizeof(uint8_t);
+uint16_t PacketView::extractUint16()
+{
+	uint16_t d;
+
+	if (!tryExtract(d))
+		throw invalid_operation();
 
 	return d;
 }
 
-int8_t Packet::extractInt8()
+uint32_t PacketView::extractUint32()
 {
-	ensureCanExtract(sizeof(int8_t));
+	uint32_t d;
 
-	int8_t d = *reinterpret_cast<int8_t*>(_data + _curExtractLoc);
+	if (!tryExtract(d))
+		throw invalid_operation();
 
-	_curExtractLoc += sizeof(int8_t);
+	return d;
+}
+
+uint64_t PacketView::extractUint64()
+{
+	uint64_t d;
+
+	if (!tryExtract(d))
+		throw invalid_operation();
+
+	return d;
+}
+
+float PacketView::extractFloat()
+{
+	float d;
+
+	if (!tryExtract(d))
+		throw invalid_operation();
+
+	return d;
+}
+
+vec3f PacketView::extractVec3f()
+{
+	vec3f d;
+
+	if (!tryExtract(d))
+		throw invalid_operation();
+
+	return d;
+}
+
+vec3d PacketView::extractVec3d()
+{
+	vec3d d;
+
+	if (!tryExtract(d))
+		throw invalid_operation();
+
+	return d;
+}
+
+vec4f PacketView::extractVec4f()
+{
+	vec4f d;
+
+	if (!tryExtract(d))
+		throw invalid_operation();
+
+	return d;
+}
+
+mat3f PacketView::extractMat3f()
+{
+	mat3f d;
+
+	if (!tryExtract(d))
+		throw invalid_operation();
 
 	return d;
 }
 
-uint16_t Packet::extractUint16()
+bool PacketView::tryExtract(uint8_t& value) VN_NOEXCEPT
+{
+	if (!canExtract(sizeof(uint8_t)))
+		return false;
+
+	value = *reinterpret_cast<uint8_t*>(_data + _curExtractLoc);
+
+	_curExtractLoc += sizeof(uint8_t);
+
+	return true;
+}
+
+bool PacketView::tryExtract(int8_t& value) VN_NOEXCEPT
+{
+	if (!canExtract(sizeof(int8_t)))
+		return false;
+
+	value = *reinterpret_cast<int8_t*>(_data + _curExtractLoc);
+
+	_curExtractLoc += sizeof(int8_t);
+
+	return true;
+}
+
+bool PacketView::tryExtract(uint16_t& value) VN_NOEXCEPT
 {
-	ensureCanExtract(sizeof(uint16_t));
+	if (!canExtract(sizeof(uint16_t)))
+		return false;
 
 	uint16_t d;
 
@@ -612,12 +1131,15 @@ uint16_t Packet::extractUint16()
 
 	_curExtractLoc += sizeof(uint16_t);
 
-	return stoh(d);
+	value = stoh(d);
+
+	return true;
 }
 
-uint32_t Packet::extractUint32()
+bool PacketView::tryExtract(uint32_t& value) VN_NOEXCEPT
 {
-	ensureCanExtract(sizeof(uint32_t));
+	if (!canExtract(sizeof(uint32_t)))
+		return false;
 
 	uint32_t d;
 
@@ -625,12 +1147,15 @@ uint32_t Packet::extractUint32()
 
 	_curExtractLoc += sizeof(uint32_t);
 
-	return stoh(d);
+	value = stoh(d);
+
+	return true;
 }
 
-uint64_t Packet::extractUint64()
+bool PacketView::tryExtract(uint64_t& value) VN_NOEXCEPT
 {
-	ensureCanExtract(sizeof(uint64_t));
+	if (!canExtract(sizeof(uint64_t)))
+		return false;
 
 	uint64_t d;
 
@@ -638,148 +1163,138 @@ uint64_t Packet::extractUint64()
 
 	_curExtractLoc += sizeof(uint64_t);
 
-	return stoh(d);
+	value = stoh(d);
+
+	return true;
 }
 
-float Packet::extractFloat()
+bool PacketView::tryExtract(float& value) VN_NOEXCEPT
 {
-	ensureCanExtract(sizeof(float));
-
-	float f;
+	if (!canExtract(sizeof(float)))
+		return false;
 
-	memcpy(&f, _data + _curExtractLoc, sizeof(float));
+	memcpy(&value, _data + _curExtractLoc, sizeof(float));
 
 	_curExtractLoc += sizeof(float);
 
-	return f;
+	return true;
 }
 
-vec3f Packet::extractVec3f()
+bool PacketView::tryExtract(vec3f& value) VN_NOEXCEPT
 {
-	ensureCanExtract(3 * sizeof(float));
-
-	vec3f d;
+	if (!canExtract(3 * sizeof(float)))
+		return false;
 
-	memcpy(&d.x, _data + _curExtractLoc, sizeof(float));
-	memcpy(&d.y, _data + _curExtractLoc + sizeof(float), sizeof(float));
-	memcpy(&d.z, _data + _curExtractLoc + 2 * sizeof(float), sizeof(float));
+	memcpy(&value.x, _data + _curExtractLoc, sizeof(float));
+	memcpy(&value.y, _data + _curExtractLoc + sizeof(float), sizeof(float));
+	memcpy(&value.z, _data + _curExtractLoc + 2 * sizeof(float), sizeof(float));
 
 	_curExtractLoc += 3 * sizeof(float);
 
-	return d;
+	return true;
 }
 
-vec3d Packet::extractVec3d()
+bool PacketView::tryExtract(vec3d& value) VN_NOEXCEPT
 {
-	ensureCanExtract(3 * sizeof(double));
-
-	vec3d d;
+	if (!canExtract(3 * sizeof(double)))
+		return false;
 
-	memcpy(&d.x, _data + _curExtractLoc, sizeof(double));
-	memcpy(&d.y, _data + _curExtractLoc + sizeof(double), sizeof(double));
-	memcpy(&d.z, _data + _curExtractLoc + 2 * sizeof(double), sizeof(double));
+	memcpy(&value.x, _data + _curExtractLoc, sizeof(double));
+	memcpy(&value.y, _data + _curExtractLoc + sizeof(double), sizeof(double));
+	memcpy(&value.z, _data + _curExtractLoc + 2 * sizeof(double), sizeof(double));
 
 	_curExtractLoc += 3 * sizeof(double);
 
-	return d;
+	return true;
 }
 
-vec4f Packet::extractVec4f()
+bool PacketView::tryExtract(vec4f& value) VN_NOEXCEPT
 {
-	ensureCanExtract(4 * sizeof(float));
-
-	vec4f d;
+	if (!canExtract(4 * sizeof(float)))
+		return false;
 
-	memcpy(&d.x, _data + _curExtractLoc, sizeof(float));
-	memcpy(&d.y, _data + _curExtractLoc + sizeof(float), sizeof(float));
-	memcpy(&d.z, _data + _curExtractLoc + 2 * sizeof(float), sizeof(float));
-	memcpy(&d.w, _data + _curExtractLoc + 3 * sizeof(float), sizeof(float));
+	memcpy(&value.x, _data + _curExtractLoc, sizeof(float));
+	memcpy(&value.y, _data + _curExtractLoc + sizeof(float), sizeof(float));
+	memcpy(&value.z, _data + _curExtractLoc + 2 * sizeof(float), sizeof(float));
+	memcpy(&value.w, _data + _curExtractLoc + 3 * sizeof(float), sizeof(float));
 
 	_curExtractLoc += 4 * sizeof(float);
 
-	return d;
+	return true;
 }
 
-mat3f Packet::extractMat3f()
+bool PacketView::tryExtract(mat3f& value) VN_NOEXCEPT
 {
-	ensureCanExtract(9 * sizeof(float));
-
-	mat3f m;
+	if (!canExtract(9 * sizeof(float)))
+		return false;
 
-	memcpy(&m.e00, _data + _curExtractLoc, sizeof(float));
-	memcpy(&m.e10, _data + _curExtractLoc + sizeof(float), sizeof(float));
-	memcpy(&m.e20, _data + _curExtractLoc + 2 * sizeof(float), sizeof(float));
-	memcpy(&m.e01, _data + _curExtractLoc + 3 * sizeof(float), sizeof(float));
-	memcpy(&m.e11, _data + _curExtractLoc + 4 * sizeof(float), sizeof(float));
-	memcpy(&m.e21, _data + _curExtractLoc + 5 * sizeof(float), sizeof(float));
-	memcpy(&m.e02, _data + _curExtractLoc + 6 * sizeof(float), sizeof(float));
-	memcpy(&m.e12, _data + _curExtractLoc + 7 * sizeof(float), sizeof(float));
-	memcpy(&m.e22, _data + _curExtractLoc + 8 * sizeof(float), sizeof(float));
+	memcpy(&value.e00, _data + _curExtractLoc, sizeof(float));
+	memcpy(&value.e10, _data + _curExtractLoc + sizeof(float), sizeof(float));
+	memcpy(&value.e20, _data + _curExtractLoc + 2 * sizeof(float), sizeof(float));
+	memcpy(&value.e01, _data + _curExtractLoc + 3 * sizeof(float), sizeof(float));
+	memcpy(&value.e11, _data + _curExtractLoc + 4 * sizeof(float), sizeof(float));
+	memcpy(&value.e21, _data + _curExtractLoc + 5 * sizeof(float), sizeof(float));
+	memcpy(&value.e02, _data + _curExtractLoc + 6 * sizeof(float), sizeof(float));
+	memcpy(&value.e12, _data + _curExtractLoc + 7 * sizeof(float), sizeof(float));
+	memcpy(&value.e22, _data + _curExtractLoc + 8 * sizeof(float), sizeof(float));
 
 	_curExtractLoc += 9 * sizeof(float);
 
-	return m;
+	return true;
+}
+
+void PacketView::setExtractLocation(size_t offset)
+{
+	_curExtractLoc = offset;
 }
 
-size_t Packet::finalizeCommand(ErrorDetectionMode errorDetectionMode, char *packet, size_t length)
+size_t PacketView::finalizeCommand(ErrorDetectionMode errorDetectionMode, char *packet, size_t length)
 {
-	#if defined(_MSC_VER)
-		// Unable to use save version 'sprintf_s' since the length of 'packet' is unknown here.
-		#pragma warning(push)
-		#pragma warning(disable:4996)
-	#endif
+	// The length of 'packet' is unknown here, so only allow room for the
+	// longest ending.
+	CommandBuilder command(packet + length, sizeof("*FFFF\r\n"));
 
 	if (errorDetectionMode == ERRORDETECTIONMODE_CHECKSUM)
 	{
-		length += sprintf(packet + length, "*%02X\r\n", Checksum8::compute(packet + 1, length - 1));
+		command.append('*').appendHex(Checksum8::compute(packet + 1, length - 1), 2).append("\r\n");
 	}
 	else if (errorDetectionMode == ERRORDETECTIONMODE_CRC)
 	{
-		length += sprintf(packet + length, "*%04X\r\n", Crc16::compute(packet + 1, length - 1));
+		command.append('*').appendHex(Crc16::compute(packet + 1, length - 1), 4).append("\r\n");
 	}
 	else
 	{
-		length += sprintf(packet + length, "*XX\r\n");
+		command.append("*XX\r\n");
 	}
 
-	#if defined(_MSC_VER)
-		#pragma warning(pop)
-	#endif
-
-	return length;
+	return length + command.length();
 }
 
-size_t Packet::genReadBinaryOutput1(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadBinaryOutput1(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,75");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,75");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,75");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadBinaryOutput2(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadBinaryOutput2(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,76");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,76");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,76");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadBinaryOutput3(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadBinaryOutput3(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,77");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,77");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,77");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
 
@@ -802,1633 +1317,1332 @@ size_t writeBinaryOutput(ErrorDetectionMode errorDetectionMode, char* buffer, si
   if(gps2Field)
     groups |= 0x0040;
 
-	#if VN_HAVE_SECURE_CRT
-	int length = sprintf_s(buffer, size, "$VNWRG,%u,%u,%u,%X", 74 + binaryOutputNumber, asyncMode, rateDivisor, groups);
-	#else
-	int length = sprintf(buffer, "$VNWRG,%u,%u,%u,%X", 74 + binaryOutputNumber, asyncMode, rateDivisor, groups);
-	#endif
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNWRG,").appendUnsigned(74 + binaryOutputNumber)
+		.append(',').appendUnsigned(asyncMode)
+		.append(',').appendUnsigned(rateDivisor)
+		.append(',').appendHex(groups);
 
 	if (commonField)
-		#if VN_HAVE_SECURE_CRT
-		length += sprintf_s(buffer + length, size - length, ",%X", commonField);
-		#else
-		length += sprintf(buffer + length, ",%X", commonField);
-		#endif
+		command.append(',').appendHex(commonField);
 	if (timeField)
-		#if VN_HAVE_SECURE_CRT
-		length += sprintf_s(buffer + length, size - length, ",%X", timeField);
-		#else
-		length += sprintf(buffer + length, ",%X", timeField);
-		#endif
+		command.append(',').appendHex(timeField);
 	if (imuField)
-		#if VN_HAVE_SECURE_CRT
-		length += sprintf_s(buffer + length, size - length, ",%X", imuField);
-		#else
-		length += sprintf(buffer + length, ",%X", imuField);
-		#endif
+		command.append(',').appendHex(imuField);
 	if (gpsField)
-		#if VN_HAVE_SECURE_CRT
-		length += sprintf_s(buffer + length, size - length, ",%X", gpsField);
-		#else
-		length += sprintf(buffer + length, ",%X", gpsField);
-		#endif
+		command.append(',').appendHex(gpsField);
 	if (attitudeField)
-		#if VN_HAVE_SECURE_CRT
-		length += sprintf_s(buffer + length, size - length, ",%X", attitudeField);
-		#else
-		length += sprintf(buffer + length, ",%X", attitudeField);
-		#endif
+		command.append(',').appendHex(attitudeField);
 	if (insField)
-		#if VN_HAVE_SECURE_CRT
-		length += sprintf_s(buffer + length, size - length, ",%X", insField);
-		#else
-		length += sprintf(buffer + length, ",%X", insField);
-		#endif
-  if(gps2Field)
-  #if VN_HAVE_SECURE_CRT
-  length += sprintf_s(buffer + length, size - length, ",%X", gps2Field);
-  #else
-  length += sprintf(buffer + length, ",%X", gps2Field);
-  #endif
+		command.append(',').appendHex(insField);
+	if (gps2Field)
+		command.append(',').appendHex(gps2Field);
 
-	return Packet::finalizeCommand(errorDetectionMode, buffer, length);
+	return PacketView::finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteBinaryOutput1(ErrorDetectionMode errorDetectionMode, char* buffer, size_t size, uint16_t asyncMode, uint16_t rateDivisor, uint16_t commonField, uint16_t timeField, uint16_t imuField, uint16_t gpsField, uint16_t attitudeField, uint16_t insField, uint16_t gps2Field)
+size_t PacketView::genWriteBinaryOutput1(ErrorDetectionMode errorDetectionMode, char* buffer, size_t size, uint16_t asyncMode, uint16_t rateDivisor, uint16_t commonField, uint16_t timeField, uint16_t imuField, uint16_t gpsField, uint16_t attitudeField, uint16_t insField, uint16_t gps2Field)
 {
 	return writeBinaryOutput(errorDetectionMode, buffer, size, 1, asyncMode, rateDivisor, commonField, timeField, imuField, gpsField, attitudeField, insField, gps2Field);
 }
 
-size_t Packet::genWriteBinaryOutput2(ErrorDetectionMode errorDetectionMode, char* buffer, size_t size, uint16_t asyncMode, uint16_t rateDivisor, uint16_t commonField, uint16_t timeField, uint16_t imuField, uint16_t gpsField, uint16_t attitudeField, uint16_t insField, uint16_t gps2Field)
+size_t PacketView::genWriteBinaryOutput2(ErrorDetectionMode errorDetectionMode, char* buffer, size_t size, uint16_t asyncMode, uint16_t rateDivisor, uint16_t commonField, uint16_t timeField, uint16_t imuField, uint16_t gpsField, uint16_t attitudeField, uint16_t insField, uint16_t gps2Field)
 {
 	return writeBinaryOutput(errorDetectionMode, buffer, size, 2, asyncMode, rateDivisor, commonField, timeField, imuField, gpsField, attitudeField, insField, gps2Field);
 }
 
-size_t Packet::genWriteBinaryOutput3(ErrorDetectionMode errorDetectionMode, char* buffer, size_t size, uint16_t asyncMode, uint16_t rateDivisor, uint16_t commonField, uint16_t timeField, uint16_t imuField, uint16_t gpsField, uint16_t attitudeField, uint16_t insField, uint16_t gps2Field)
+size_t PacketView::genWriteBinaryOutput3(ErrorDetectionMode errorDetectionMode, char* buffer, size_t size, uint16_t asyncMode, uint16_t rateDivisor, uint16_t commonField, uint16_t timeField, uint16_t imuField, uint16_t gpsField, uint16_t attitudeField, uint16_t insField, uint16_t gps2Field)
 {
 	return writeBinaryOutput(errorDetectionMode, buffer, size, 3, asyncMode, rateDivisor, commonField, timeField, imuField, gpsField, attitudeField, insField, gps2Field);
 }
 
 
-size_t Packet::genWriteSettings(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genWriteSettings(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+{
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNWNV");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
+}
+
+size_t PacketView::genTare(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+{
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNTAR");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
+}
+
+size_t PacketView::genKnownMagneticDisturbance(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, bool isMagneticDisturbancePresent)
+{
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNKMD,").appendSigned(isMagneticDisturbancePresent ? 1 : 0);
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
+}
+
+size_t PacketView::genKnownAccelerationDisturbance(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, bool isAccelerationDisturbancePresent)
+{
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNKAD,").appendSigned(isAccelerationDisturbancePresent ? 1 : 0);
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
+}
+
+size_t PacketView::genSetGyroBias(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+{
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNSGB");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
+}
+
+size_t PacketView::genRestoreFactorySettings(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+{
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNRFS");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
+}
+
+size_t PacketView::genReset(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+{
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNRST");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
+}
+
+size_t PacketView::genFirmwareUpdate(ErrorDetectionMode errorDetectionMode, char* buffer, size_t size)
+{
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNFWU");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
+}
+
+size_t PacketView::genReadSerialBaudRate(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint8_t port)
+{
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNRRG,05,").appendUnsigned(port);
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
+}
+
+size_t PacketView::genWriteSerialBaudRate(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint32_t baudrate, uint8_t port)
+{
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNWRG,05,").appendUnsigned(baudrate).append(',').appendUnsigned(port);
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
+}
+
+size_t PacketView::genReadAsyncDataOutputType(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint8_t port)
+{
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNRRG,06,").appendUnsigned(port);
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
+}
+
+size_t PacketView::genWriteAsyncDataOutputType(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint32_t ador, uint8_t port)
+{
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNWRG,06,").appendUnsigned(ador).append(',').appendUnsigned(port);
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
+}
+
+size_t PacketView::genReadAsyncDataOutputFrequency(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint8_t port)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWNV");
-	#else
-	size_t length = sprintf(buffer, "$VNWNV");
-	#endif
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNRRG,07,").appendUnsigned(port);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genTare(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genWriteAsyncDataOutputFrequency(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint32_t adof, uint8_t port)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNTAR");
-	#else
-	size_t length = sprintf(buffer, "$VNTAR");
-	#endif
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNWRG,07,").appendUnsigned(adof).append(',').appendUnsigned(port);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genKnownMagneticDisturbance(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, bool isMagneticDisturbancePresent)
+size_t PacketView::genWriteFilterMeasurementsVarianceParameters(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, float angularWalkVariance, vec3f angularRateVariance, vec3f magneticVariance, vec3f accelerationVariance)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNKMD,%d", isMagneticDisturbancePresent ? 1 : 0);
-	#else
-	size_t length = sprintf(buffer, "$VNKMD,%d", isMagneticDisturbancePresent ? 1 : 0);
-	#endif
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNWRG,22,")
+		.appendScientific(angularWalkVariance).append(',')
+		.appendScientific(angularRateVariance.x).append(',')
+		.appendScientific(angularRateVariance.y).append(',')
+		.appendScientific(angularRateVariance.z).append(',')
+		.appendFixed(magneticVariance.x).append(',')
+		.appendFixed(magneticVariance.y).append(',')
+		.appendFixed(magneticVariance.z).append(',')
+		.appendFixed(accelerationVariance.x).append(',')
+		.appendFixed(accelerationVariance.y).append(',')
+		.appendFixed(accelerationVariance.z);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genKnownAccelerationDisturbance(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, bool isAccelerationDisturbancePresent)
+size_t PacketView::genWriteFirmwareUpdateRecord(ErrorDetectionMode errorDetectionMode, char* buffer, size_t size, string record)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNKAD,%d", isAccelerationDisturbancePresent ? 1 : 0);
-	#else
-	size_t length = sprintf(buffer, "$VNKAD,%d", isAccelerationDisturbancePresent ? 1 : 0);
-	#endif
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNBLD,").appendString(record.c_str());
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genSetGyroBias(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadUserTag(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNSGB");
-	#else
-	size_t length = sprintf(buffer, "$VNSGB");
-	#endif
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNRRG,00");
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genRestoreFactorySettings(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genWriteUserTag(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, string tag)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRFS");
-	#else
-	size_t length = sprintf(buffer, "$VNRFS");
-	#endif
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNWRG,00,").appendString(tag.c_str());
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReset(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadModelNumber(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRST");
-	#else
-	size_t length = sprintf(buffer, "$VNRST");
-	#endif
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNRRG,01");
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genFirmwareUpdate(ErrorDetectionMode errorDetectionMode, char* buffer, size_t size)
+size_t PacketView::genReadHardwareRevision(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNFWU");
-#else
-	size_t length = sprintf(buffer, "$VNFWU");
-#endif
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNRRG,02");
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadSerialBaudRate(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint8_t port)
+size_t PacketView::genReadSerialNumber(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,05,%u", port);
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,05,%u", port);
-	#endif
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNRRG,03");
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteSerialBaudRate(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint32_t baudrate, uint8_t port)
+size_t PacketView::genReadFirmwareVersion(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,05,%u,%u", baudrate, port);
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,05,%u,%u", baudrate, port);
-	#endif
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNRRG,04");
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadAsyncDataOutputType(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint8_t port)
+size_t PacketView::genReadSerialBaudRate(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,06,%u", port);
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,06,%u", port);
-	#endif
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNRRG,05");
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteAsyncDataOutputType(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint32_t ador, uint8_t port)
+size_t PacketView::genWriteSerialBaudRate(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint32_t baudrate)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,06,%u,%u", ador, port);
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,06,%u,%u", ador, port);
-	#endif
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNWRG,05,").appendUnsigned(baudrate);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadAsyncDataOutputFrequency(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint8_t port)
+size_t PacketView::genReadAsyncDataOutputType(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,07,%u", port);
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,07,%u", port);
-	#endif
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNRRG,06");
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteAsyncDataOutputFrequency(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint32_t adof, uint8_t port)
+size_t PacketView::genWriteAsyncDataOutputType(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint32_t ador)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,07,%u,%u", adof, port);
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,07,%u,%u", adof, port);
-	#endif
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNWRG,06,").appendUnsigned(ador);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteFilterMeasurementsVarianceParameters(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, float angularWalkVariance, vec3f angularRateVariance, vec3f magneticVariance, vec3f accelerationVariance)
+size_t PacketView::genReadAsyncDataOutputFrequency(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,22,%E,%E,%E,%E,%f,%f,%f,%f,%f,%f",
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,22,%E,%E,%E,%E,%f,%f,%f,%f,%f,%f",
-	#endif
-		angularWalkVariance,
-		angularRateVariance.x,
-		angularRateVariance.y,
-		angularRateVariance.z,
-		magneticVariance.x,
-		magneticVariance.y,
-		magneticVariance.z,
-		accelerationVariance.x,
-		accelerationVariance.y,
-		accelerationVariance.z);
-
-	return finalizeCommand(errorDetectionMode, buffer, length);
-}
-
-size_t Packet::genWriteFirmwareUpdateRecord(ErrorDetectionMode errorDetectionMode, char* buffer, size_t size, string record)
-{
-#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNBLD,%s"
-#else
-	size_t length = sprintf(buffer, "$VNBLD,%s"
-#endif
-		,
-		record.c_str());
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,07");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadUserTag(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genWriteAsyncDataOutputFrequency(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint32_t adof)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,00");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,00");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNWRG,07,").appendUnsigned(adof);
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteUserTag(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, string tag)
+size_t PacketView::genReadYawPitchRoll(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,00,%s"
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,00,%s"
-	#endif
-,
-		tag.c_str());
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,08");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadModelNumber(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadAttitudeQuaternion(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,01");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,01");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,09");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadHardwareRevision(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadQuaternionMagneticAccelerationAndAngularRates(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,02");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,02");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,15");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadSerialNumber(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadMagneticMeasurements(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,03");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,03");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,17");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadFirmwareVersion(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadAccelerationMeasurements(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,04");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,04");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,18");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadSerialBaudRate(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadAngularRateMeasurements(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,05");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,05");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,19");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteSerialBaudRate(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint32_t baudrate)
+size_t PacketView::genReadMagneticAccelerationAndAngularRates(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,05,%u"
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,05,%u"
-	#endif
-,
-		baudrate);
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,20");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadAsyncDataOutputType(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadMagneticAndGravityReferenceVectors(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,06");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,06");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,21");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteAsyncDataOutputType(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint32_t ador)
+size_t PacketView::genWriteMagneticAndGravityReferenceVectors(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, vec3f magRef, vec3f accRef)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,06,%u"
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,06,%u"
-	#endif
-,
-		ador);
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNWRG,21,")
+		.appendFixed(magRef.x).append(',')
+		.appendFixed(magRef.y).append(',')
+		.appendFixed(magRef.z).append(',')
+		.appendFixed(accRef.x).append(',')
+		.appendFixed(accRef.y).append(',')
+		.appendFixed(accRef.z);
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadAsyncDataOutputFrequency(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadFilterMeasurementsVarianceParameters(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,07");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,07");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,22");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteAsyncDataOutputFrequency(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint32_t adof)
+size_t PacketView::genReadMagnetometerCompensation(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,07,%u"
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,07,%u"
-	#endif
-,
-		adof);
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,23");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadYawPitchRoll(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genWriteMagnetometerCompensation(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, mat3f c, vec3f b)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,08");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,08");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNWRG,23,")
+		.appendFixed(c.e00).append(',')
+		.appendFixed(c.e01).append(',')
+		.appendFixed(c.e02).append(',')
+		.appendFixed(c.e10).append(',')
+		.appendFixed(c.e11).append(',')
+		.appendFixed(c.e12).append(',')
+		.appendFixed(c.e20).append(',')
+		.appendFixed(c.e21).append(',')
+		.appendFixed(c.e22).append(',')
+		.appendFixed(b.x).append(',')
+		.appendFixed(b.y).append(',')
+		.appendFixed(b.z);
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadAttitudeQuaternion(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadFilterActiveTuningParameters(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,09");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,09");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,24");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadQuaternionMagneticAccelerationAndAngularRates(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genWriteFilterActiveTuningParameters(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, float magneticDisturbanceGain, float accelerationDisturbanceGain, float magneticDisturbanceMemory, float accelerationDisturbanceMemory)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,15");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,15");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNWRG,24,")
+		.appendFixed(magneticDisturbanceGain).append(',')
+		.appendFixed(accelerationDisturbanceGain).append(',')
+		.appendFixed(magneticDisturbanceMemory).append(',')
+		.appendFixed(accelerationDisturbanceMemory);
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadMagneticMeasurements(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadAccelerationCompensation(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,17");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,17");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,25");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadAccelerationMeasurements(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genWriteAccelerationCompensation(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, mat3f c, vec3f b)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,18");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,18");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNWRG,25,")
+		.appendFixed(c.e00).append(',')
+		.appendFixed(c.e01).append(',')
+		.appendFixed(c.e02).append(',')
+		.appendFixed(c.e10).append(',')
+		.appendFixed(c.e11).append(',')
+		.appendFixed(c.e12).append(',')
+		.appendFixed(c.e20).append(',')
+		.appendFixed(c.e21).append(',')
+		.appendFixed(c.e22).append(',')
+		.appendFixed(b.x).append(',')
+		.appendFixed(b.y).append(',')
+		.appendFixed(b.z);
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadAngularRateMeasurements(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadReferenceFrameRotation(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,19");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,19");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,26");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadMagneticAccelerationAndAngularRates(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genWriteReferenceFrameRotation(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, mat3f c)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,20");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,20");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNWRG,26,")
+		.appendFixed(c.e00).append(',')
+		.appendFixed(c.e01).append(',')
+		.appendFixed(c.e02).append(',')
+		.appendFixed(c.e10).append(',')
+		.appendFixed(c.e11).append(',')
+		.appendFixed(c.e12).append(',')
+		.appendFixed(c.e20).append(',')
+		.appendFixed(c.e21).append(',')
+		.appendFixed(c.e22);
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadMagneticAndGravityReferenceVectors(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadYawPitchRollMagneticAccelerationAndAngularRates(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,21");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,21");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,27");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteMagneticAndGravityReferenceVectors(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, vec3f magRef, vec3f accRef)
+size_t PacketView::genReadCommunicationProtocolControl(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,21,%f,%f,%f,%f,%f,%f"
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,21,%f,%f,%f,%f,%f,%f"
-	#endif
-,
-		magRef.x,
-		magRef.y,
-		magRef.z,
-		accRef.x,
-		accRef.y,
-		accRef.z);
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,30");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadFilterMeasurementsVarianceParameters(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genWriteCommunicationProtocolControl(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint8_t serialCount, uint8_t serialStatus, uint8_t spiCount, uint8_t spiStatus, uint8_t serialChecksum, uint8_t spiChecksum, uint8_t errorMode)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,22");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,22");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNWRG,30,")
+		.appendUnsigned(serialCount).append(',')
+		.appendUnsigned(serialStatus).append(',')
+		.appendUnsigned(spiCount).append(',')
+		.appendUnsigned(spiStatus).append(',')
+		.appendUnsigned(serialChecksum).append(',')
+		.appendUnsigned(spiChecksum).append(',')
+		.appendUnsigned(errorMode);
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadMagnetometerCompensation(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadSynchronizationControl(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,23");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,23");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,32");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteMagnetometerCompensation(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, mat3f c, vec3f b)
+size_t PacketView::genWriteSynchronizationControl(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint8_t syncInMode, uint8_t syncInEdge, uint16_t syncInSkipFactor, uint8_t syncOutMode, uint8_t syncOutPolarity, uint16_t syncOutSkipFactor, uint32_t syncOutPulseWidth)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,23,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f"
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,23,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f"
-	#endif
-,
-		c.e00,
-		c.e01,
-		c.e02,
-		c.e10,
-		c.e11,
-		c.e12,
-		c.e20,
-		c.e21,
-		c.e22,
-		b.x,
-		b.y,
-		b.z);
-
-	return finalizeCommand(errorDetectionMode, buffer, length);
-}
-
-size_t Packet::genReadFilterActiveTuningParameters(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
-{
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,24");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,24");
-	#endif
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNWRG,32,")
+		.appendUnsigned(syncInMode).append(',')
+		.appendUnsigned(syncInEdge).append(',')
+		.appendUnsigned(syncInSkipFactor).append(",0,")
+		.appendUnsigned(syncOutMode).append(',')
+		.appendUnsigned(syncOutPolarity).append(',')
+		.appendUnsigned(syncOutSkipFactor).append(',')
+		.appendUnsigned(syncOutPulseWidth).append(",0");
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteFilterActiveTuningParameters(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, float magneticDisturbanceGain, float accelerationDisturbanceGain, float magneticDisturbanceMemory, float accelerationDisturbanceMemory)
+size_t PacketView::genReadSynchronizationStatus(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,24,%f,%f,%f,%f"
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,24,%f,%f,%f,%f"
-	#endif
-,
-		magneticDisturbanceGain,
-		accelerationDisturbanceGain,
-		magneticDisturbanceMemory,
-		accelerationDisturbanceMemory);
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNRRG,33");
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadAccelerationCompensation(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genWriteSynchronizationStatus(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint32_t syncInCount, uint32_t syncInTime, uint32_t syncOutCount)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,25");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,25");
-	#endif
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNWRG,33,")
+		.appendUnsigned(syncInCount).append(',')
+		.appendUnsigned(syncInTime).append(',')
+		.appendUnsigned(syncOutCount);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteAccelerationCompensation(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, mat3f c, vec3f b)
+size_t PacketView::genReadFilterBasicControl(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,25,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f"
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,25,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f"
-	#endif
-,
-		c.e00,
-		c.e01,
-		c.e02,
-		c.e10,
-		c.e11,
-		c.e12,
-		c.e20,
-		c.e21,
-		c.e22,
-		b.x,
-		b.y,
-		b.z);
-
-	return finalizeCommand(errorDetectionMode, buffer, length);
-}
-
-size_t Packet::genReadReferenceFrameRotation(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
-{
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,26");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,26");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,34");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteReferenceFrameRotation(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, mat3f c)
+size_t PacketView::genWriteFilterBasicControl(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint8_t magMode, uint8_t extMagMode, uint8_t extAccMode, uint8_t extGyroMode, vec3f gyroLimit)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,26,%f,%f,%f,%f,%f,%f,%f,%f,%f"
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,26,%f,%f,%f,%f,%f,%f,%f,%f,%f"
-	#endif
-,
-		c.e00,
-		c.e01,
-		c.e02,
-		c.e10,
-		c.e11,
-		c.e12,
-		c.e20,
-		c.e21,
-		c.e22);
-
-	return finalizeCommand(errorDetectionMode, buffer, length);
-}
-
-size_t Packet::genReadYawPitchRollMagneticAccelerationAndAngularRates(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
-{
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,27");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,27");
-	#endif
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNWRG,34,")
+		.appendUnsigned(magMode).append(',')
+		.appendUnsigned(extMagMode).append(',')
+		.appendUnsigned(extAccMode).append(',')
+		.appendUnsigned(extGyroMode).append(',')
+		.appendFixed(gyroLimit.x).append(',')
+		.appendFixed(gyroLimit.y).append(',')
+		.appendFixed(gyroLimit.z);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadCommunicationProtocolControl(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadHeaveConfiguration(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,30");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,30");
-	#endif
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNRRG,116");
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteCommunicationProtocolControl(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint8_t serialCount, uint8_t serialStatus, uint8_t spiCount, uint8_t spiStatus, uint8_t serialChecksum, uint8_t spiChecksum, uint8_t errorMode)
+size_t PacketView::genWriteHeaveConfiguration(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, 
+							float initialWavePeriod, 
+							float initialWaveAmplitude, 
+							float maxWavePeriod,
+							float minWaveAmplitude,
+							float delayedHeaveCutoffFreq,
+							float heaveCutoffFreq,
+							float heaveRateCutoffFreq)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,30,%u,%u,%u,%u,%u,%u,%u"
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,30,%u,%u,%u,%u,%u,%u,%u"
-	#endif
-,
-		serialCount,
-		serialStatus,
-		spiCount,
-		spiStatus,
-		serialChecksum,
-		spiChecksum,
-		errorMode);
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNWRG,116,")
+		.appendFixed(initialWavePeriod).append(',')
+		.appendFixed(initialWaveAmplitude).append(',')
+		.appendFixed(maxWavePeriod).append(',')
+		.appendFixed(minWaveAmplitude).append(',')
+		.appendFixed(delayedHeaveCutoffFreq).append(',')
+		.appendFixed(heaveCutoffFreq).append(',')
+		.appendFixed(heaveRateCutoffFreq);
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadSynchronizationControl(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadVpeBasicControl(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,32");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,32");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,35");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteSynchronizationControl(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint8_t syncInMode, uint8_t syncInEdge, uint16_t syncInSkipFactor, uint8_t syncOutMode, uint8_t syncOutPolarity, uint16_t syncOutSkipFactor, uint32_t syncOutPulseWidth)
+size_t PacketView::genWriteVpeBasicControl(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint8_t enable, uint8_t headingMode, uint8_t filteringMode, uint8_t tuningMode)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,32,%u,%u,%u,0,%u,%u,%u,%u,0"
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,32,%u,%u,%u,0,%u,%u,%u,%u,0"
-	#endif
-,
-		syncInMode,
-		syncInEdge,
-		syncInSkipFactor,
-		syncOutMode,
-		syncOutPolarity,
-		syncOutSkipFactor,
-		syncOutPulseWidth);
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNWRG,35,")
+		.appendUnsigned(enable).append(',')
+		.appendUnsigned(headingMode).append(',')
+		.appendUnsigned(filteringMode).append(',')
+		.appendUnsigned(tuningMode);
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadSynchronizationStatus(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadVpeMagnetometerBasicTuning(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,33");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,33");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,36");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteSynchronizationStatus(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint32_t syncInCount, uint32_t syncInTime, uint32_t syncOutCount)
+size_t PacketView::genWriteVpeMagnetometerBasicTuning(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, vec3f baseTuning, vec3f adaptiveTuning, vec3f adaptiveFiltering)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,33,%u,%u,%u"
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,33,%u,%u,%u"
-	#endif
-,
-		syncInCount,
-		syncInTime,
-		syncOutCount);
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNWRG,36,")
+		.appendFixed(baseTuning.x).append(',')
+		.appendFixed(baseTuning.y).append(',')
+		.appendFixed(baseTuning.z).append(',')
+		.appendFixed(adaptiveTuning.x).append(',')
+		.appendFixed(adaptiveTuning.y).append(',')
+		.appendFixed(adaptiveTuning.z).append(',')
+		.appendFixed(adaptiveFiltering.x).append(',')
+		.appendFixed(adaptiveFiltering.y).append(',')
+		.appendFixed(adaptiveFiltering.z);
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadFilterBasicControl(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadVpeMagnetometerAdvancedTuning(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,34");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,34");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,37");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteFilterBasicControl(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint8_t magMode, uint8_t extMagMode, uint8_t extAccMode, uint8_t extGyroMode, vec3f gyroLimit)
+size_t PacketView::genWriteVpeMagnetometerAdvancedTuning(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, vec3f minFiltering, vec3f maxFiltering, float maxAdaptRate, float disturbanceWindow, float maxTuning)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,34,%u,%u,%u,%u,%f,%f,%f"
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,34,%u,%u,%u,%u,%f,%f,%f"
-	#endif
-,
-		magMode,
-		extMagMode,
-		extAccMode,
-		extGyroMode,
-		gyroLimit.x,
-		gyroLimit.y,
-		gyroLimit.z);
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNWRG,37,")
+		.appendFixed(minFiltering.x).append(',')
+		.appendFixed(minFiltering.y).append(',')
+		.appendFixed(minFiltering.z).append(',')
+		.appendFixed(maxFiltering.x).append(',')
+		.appendFixed(maxFiltering.y).append(',')
+		.appendFixed(maxFiltering.z).append(',')
+		.appendFixed(maxAdaptRate).append(',')
+		.appendFixed(disturbanceWindow).append(',')
+		.appendFixed(maxTuning);
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadHeaveConfiguration(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadVpeAccelerometerBasicTuning(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,116");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,116");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,38");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteHeaveConfiguration(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, 
-							float initialWavePeriod, 
-							float initialWaveAmplitude, 
-							float maxWavePeriod,
-							float minWaveAmplitude,
-							float delayedHeaveCutoffFreq,
-							float heaveCutoffFreq,
-							float heaveRateCutoffFreq)
+size_t PacketView::genWriteVpeAccelerometerBasicTuning(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, vec3f baseTuning, vec3f adaptiveTuning, vec3f adaptiveFiltering)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,116,%f,%f,%f,%f,%f,%f,%f"
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,116,%f,%f,%f,%f,%f,%f,%f"
-	#endif
-,
-		initialWavePeriod,
-		initialWaveAmplitude,
-		maxWavePeriod,
-		minWaveAmplitude,
-		delayedHeaveCutoffFreq,
-		heaveCutoffFreq,
-		heaveRateCutoffFreq);
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNWRG,38,")
+		.appendFixed(baseTuning.x).append(',')
+		.appendFixed(baseTuning.y).append(',')
+		.appendFixed(baseTuning.z).append(',')
+		.appendFixed(adaptiveTuning.x).append(',')
+		.appendFixed(adaptiveTuning.y).append(',')
+		.appendFixed(adaptiveTuning.z).append(',')
+		.appendFixed(adaptiveFiltering.x).append(',')
+		.appendFixed(adaptiveFiltering.y).append(',')
+		.appendFixed(adaptiveFiltering.z);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadVpeBasicControl(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadVpeAccelerometerAdvancedTuning(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,35");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,35");
-	#endif
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNRRG,39");
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteVpeBasicControl(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint8_t enable, uint8_t headingMode, uint8_t filteringMode, uint8_t tuningMode)
+size_t PacketView::genWriteVpeAccelerometerAdvancedTuning(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, vec3f minFiltering, vec3f maxFiltering, float maxAdaptRate, float disturbanceWindow, float maxTuning)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,35,%u,%u,%u,%u"
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,35,%u,%u,%u,%u"
-	#endif
-,
-		enable,
-		headingMode,
-		filteringMode,
-		tuningMode);
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNWRG,39,")
+		.appendFixed(minFiltering.x).append(',')
+		.appendFixed(minFiltering.y).append(',')
+		.appendFixed(minFiltering.z).append(',')
+		.appendFixed(maxFiltering.x).append(',')
+		.appendFixed(maxFiltering.y).append(',')
+		.appendFixed(maxFiltering.z).append(',')
+		.appendFixed(maxAdaptRate).append(',')
+		.appendFixed(disturbanceWindow).append(',')
+		.appendFixed(maxTuning);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadVpeMagnetometerBasicTuning(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadVpeGyroBasicTuning(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,36");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,36");
-	#endif
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNRRG,40");
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteVpeMagnetometerBasicTuning(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, vec3f baseTuning, vec3f adaptiveTuning, vec3f adaptiveFiltering)
+size_t PacketView::genWriteVpeGyroBasicTuning(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, vec3f angularWalkVariance, vec3f baseTuning, vec3f adaptiveTuning)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,36,%f,%f,%f,%f,%f,%f,%f,%f,%f"
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,36,%f,%f,%f,%f,%f,%f,%f,%f,%f"
-	#endif
-,
-		baseTuning.x,
-		baseTuning.y,
-		baseTuning.z,
-		adaptiveTuning.x,
-		adaptiveTuning.y,
-		adaptiveTuning.z,
-		adaptiveFiltering.x,
-		adaptiveFiltering.y,
-		adaptiveFiltering.z);
-
-	return finalizeCommand(errorDetectionMode, buffer, length);
-}
-
-size_t Packet::genReadVpeMagnetometerAdvancedTuning(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
-{
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,37");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,37");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNWRG,40,")
+		.appendFixed(angularWalkVariance.x).append(',')
+		.appendFixed(angularWalkVariance.y).append(',')
+		.appendFixed(angularWalkVariance.z).append(',')
+		.appendFixed(baseTuning.x).append(',')
+		.appendFixed(baseTuning.y).append(',')
+		.appendFixed(baseTuning.z).append(',')
+		.appendFixed(adaptiveTuning.x).append(',')
+		.appendFixed(adaptiveTuning.y).append(',')
+		.appendFixed(adaptiveTuning.z);
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteVpeMagnetometerAdvancedTuning(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, vec3f minFiltering, vec3f maxFiltering, float maxAdaptRate, float disturbanceWindow, float maxTuning)
+size_t PacketView::genReadFilterStartupGyroBias(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,37,%f,%f,%f,%f,%f,%f,%f,%f,%f"
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,37,%f,%f,%f,%f,%f,%f,%f,%f,%f"
-	#endif
-,
-		minFiltering.x,
-		minFiltering.y,
-		minFiltering.z,
-		maxFiltering.x,
-		maxFiltering.y,
-		maxFiltering.z,
-		maxAdaptRate,
-		disturbanceWindow,
-		maxTuning);
-
-	return finalizeCommand(errorDetectionMode, buffer, length);
-}
-
-size_t Packet::genReadVpeAccelerometerBasicTuning(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
-{
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,38");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,38");
-	#endif
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNRRG,43");
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteVpeAccelerometerBasicTuning(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, vec3f baseTuning, vec3f adaptiveTuning, vec3f adaptiveFiltering)
+size_t PacketView::genWriteFilterStartupGyroBias(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, vec3f bias)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,38,%f,%f,%f,%f,%f,%f,%f,%f,%f"
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,38,%f,%f,%f,%f,%f,%f,%f,%f,%f"
-	#endif
-,
-		baseTuning.x,
-		baseTuning.y,
-		baseTuning.z,
-		adaptiveTuning.x,
-		adaptiveTuning.y,
-		adaptiveTuning.z,
-		adaptiveFiltering.x,
-		adaptiveFiltering.y,
-		adaptiveFiltering.z);
-
-	return finalizeCommand(errorDetectionMode, buffer, length);
-}
-
-size_t Packet::genReadVpeAccelerometerAdvancedTuning(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
-{
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,39");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,39");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNWRG,43,")
+		.appendFixed(bias.x).append(',')
+		.appendFixed(bias.y).append(',')
+		.appendFixed(bias.z);
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteVpeAccelerometerAdvancedTuning(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, vec3f minFiltering, vec3f maxFiltering, float maxAdaptRate, float disturbanceWindow, float maxTuning)
+size_t PacketView::genReadMagnetometerCalibrationControl(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,39,%f,%f,%f,%f,%f,%f,%f,%f,%f"
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,39,%f,%f,%f,%f,%f,%f,%f,%f,%f"
-	#endif
-,
-		minFiltering.x,
-		minFiltering.y,
-		minFiltering.z,
-		maxFiltering.x,
-		maxFiltering.y,
-		maxFiltering.z,
-		maxAdaptRate,
-		disturbanceWindow,
-		maxTuning);
-
-	return finalizeCommand(errorDetectionMode, buffer, length);
-}
-
-size_t Packet::genReadVpeGyroBasicTuning(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
-{
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,40");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,40");
-	#endif
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNRRG,44");
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteVpeGyroBasicTuning(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, vec3f angularWalkVariance, vec3f baseTuning, vec3f adaptiveTuning)
+size_t PacketView::genWriteMagnetometerCalibrationControl(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint8_t hsiMode, uint8_t hsiOutput, uint8_t convergeRate)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,40,%f,%f,%f,%f,%f,%f,%f,%f,%f"
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,40,%f,%f,%f,%f,%f,%f,%f,%f,%f"
-	#endif
-,
-		angularWalkVariance.x,
-		angularWalkVariance.y,
-		angularWalkVariance.z,
-		baseTuning.x,
-		baseTuning.y,
-		baseTuning.z,
-		adaptiveTuning.x,
-		adaptiveTuning.y,
-		adaptiveTuning.z);
-
-	return finalizeCommand(errorDetectionMode, buffer, length);
-}
-
-size_t Packet::genReadFilterStartupGyroBias(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
-{
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,43");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,43");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNWRG,44,")
+		.appendUnsigned(hsiMode).append(',')
+		.appendUnsigned(hsiOutput).append(',')
+		.appendUnsigned(convergeRate);
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteFilterStartupGyroBias(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, vec3f bias)
+size_t PacketView::genReadCalculatedMagnetometerCalibration(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,43,%f,%f,%f"
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,43,%f,%f,%f"
-	#endif
-,
-		bias.x,
-		bias.y,
-		bias.z);
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,47");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadMagnetometerCalibrationControl(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadIndoorHeadingModeControl(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,44");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,44");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,48");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteMagnetometerCalibrationControl(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint8_t hsiMode, uint8_t hsiOutput, uint8_t convergeRate)
+size_t PacketView::genWriteIndoorHeadingModeControl(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, float maxRateError)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,44,%u,%u,%u"
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,44,%u,%u,%u"
-	#endif
-,
-		hsiMode,
-		hsiOutput,
-		convergeRate);
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNWRG,48,").appendFixed(maxRateError).append(",0");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadCalculatedMagnetometerCalibration(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadVelocityCompensationMeasurement(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,47");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,47");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,50");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadIndoorHeadingModeControl(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genWriteVelocityCompensationMeasurement(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, vec3f velocity)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,48");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,48");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNWRG,50,")
+		.appendFixed(velocity.x).append(',')
+		.appendFixed(velocity.y).append(',')
+		.appendFixed(velocity.z);
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteIndoorHeadingModeControl(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, float maxRateError)
+size_t PacketView::genReadVelocityCompensationControl(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,48,%f,0"
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,48,%f,0"
-	#endif
-,
-		maxRateError);
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,51");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadVelocityCompensationMeasurement(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genWriteVelocityCompensationControl(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint8_t mode, float velocityTuning, float rateTuning)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,50");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,50");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNWRG,51,")
+		.appendUnsigned(mode).append(',')
+		.appendFixed(velocityTuning).append(',')
+		.appendFixed(rateTuning);
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteVelocityCompensationMeasurement(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, vec3f velocity)
+size_t PacketView::genReadVelocityCompensationStatus(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,50,%f,%f,%f"
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,50,%f,%f,%f"
-	#endif
-,
-		velocity.x,
-		velocity.y,
-		velocity.z);
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,52");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadVelocityCompensationControl(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadImuMeasurements(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,51");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,51");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,54");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteVelocityCompensationControl(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint8_t mode, float velocityTuning, float rateTuning)
+size_t PacketView::genReadGpsConfiguration(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,51,%u,%f,%f"
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,51,%u,%f,%f"
-	#endif
-,
-		mode,
-		velocityTuning,
-		rateTuning);
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,55");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadVelocityCompensationStatus(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genWriteGpsConfiguration(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint8_t mode, uint8_t ppsSource)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,52");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,52");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNWRG,55,")
+		.appendUnsigned(mode).append(',')
+		.appendUnsigned(ppsSource).append(",5,0,0");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadImuMeasurements(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genWriteGpsConfiguration(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint8_t mode, uint8_t ppsSource, uint8_t rate, uint8_t antPow)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,54");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,54");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNWRG,55,")
+		.appendUnsigned(mode).append(',')
+		.appendUnsigned(ppsSource).append(',')
+		.appendUnsigned(rate).append(",0,")
+		.appendUnsigned(antPow);
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadGpsConfiguration(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadGpsAntennaOffset(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,55");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,55");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,57");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteGpsConfiguration(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint8_t mode, uint8_t ppsSource)
+size_t PacketView::genWriteGpsAntennaOffset(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, vec3f position)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,55,%u,%u,5,0,0"
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,55,%u,%u,5,0,0"
-	#endif
-,
-		mode,
-		ppsSource);
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNWRG,57,")
+		.appendFixed(position.x).append(',')
+		.appendFixed(position.y).append(',')
+		.appendFixed(position.z);
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteGpsConfiguration(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint8_t mode, uint8_t ppsSource, uint8_t rate, uint8_t antPow)
+size_t PacketView::genReadGpsSolutionLla(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,55,%u,%u,%u,0,%u"
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,55,%u,%u,%u,0,%u"
-	#endif
-,
-		mode,
-		ppsSource,
-		rate,
-		antPow);
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,58");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadGpsAntennaOffset(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadGpsSolutionEcef(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,57");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,57");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,59");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteGpsAntennaOffset(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, vec3f position)
+size_t PacketView::genReadInsSolutionLla(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,57,%f,%f,%f"
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,57,%f,%f,%f"
-	#endif
-,
-		position.x,
-		position.y,
-		position.z);
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,63");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadGpsSolutionLla(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadInsSolutionEcef(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,58");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,58");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,64");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadGpsSolutionEcef(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadInsBasicConfiguration(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,59");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,59");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,67");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadInsSolutionLla(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genWriteInsBasicConfiguration(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint8_t scenario, uint8_t ahrsAiding, uint8_t estBaseline)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,63");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,63");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNWRG,67,")
+		.appendUnsigned(scenario).append(',')
+		.appendUnsigned(ahrsAiding).append(',')
+		.appendUnsigned(estBaseline).append(",0");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadInsSolutionEcef(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadInsAdvancedConfiguration(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,64");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,64");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,68");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadInsBasicConfiguration(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genWriteInsAdvancedConfiguration(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint8_t useMag, uint8_t usePres, uint8_t posAtt, uint8_t velAtt, uint8_t velBias, uint8_t useFoam, uint8_t gpsCovType, uint8_t velCount, float velInit, float moveOrigin, float gpsTimeout, float deltaLimitPos, float deltaLimitVel, float minPosUncertainty, float minVelUncertainty)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,67");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,67");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNWRG,68,")
+		.appendUnsigned(useMag).append(',')
+		.appendUnsigned(usePres).append(',')
+		.appendUnsigned(posAtt).append(',')
+		.appendUnsigned(velAtt).append(',')
+		.appendUnsigned(velBias).append(',')
+		.appendUnsigned(useFoam).append(',')
+		.appendUnsigned(gpsCovType).append(',')
+		.appendUnsigned(velCount).append(',')
+		.appendFixed(velInit).append(',')
+		.appendFixed(moveOrigin).append(',')
+		.appendFixed(gpsTimeout).append(',')
+		.appendFixed(deltaLimitPos).append(',')
+		.appendFixed(deltaLimitVel).append(',')
+		.appendFixed(minPosUncertainty).append(',')
+		.appendFixed(minVelUncertainty);
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteInsBasicConfiguration(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint8_t scenario, uint8_t ahrsAiding, uint8_t estBaseline)
+size_t PacketView::genReadInsStateLla(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,67,%u,%u,%u,0"
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,67,%u,%u,%u,0"
-	#endif
-,
-		scenario,
-		ahrsAiding,
-		estBaseline);
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,72");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadInsAdvancedConfiguration(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadInsStateEcef(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,68");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,68");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNRRG,73");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteInsAdvancedConfiguration(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint8_t useMag, uint8_t usePres, uint8_t posAtt, uint8_t velAtt, uint8_t velBias, uint8_t useFoam, uint8_t gpsCovType, uint8_t velCount, float velInit, float moveOrigin, float gpsTimeout, float deltaLimitPos, float deltaLimitVel, float minPosUncertainty, float minVelUncertainty)
+size_t PacketView::genReadStartupFilterBiasEstimate(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,68,%u,%u,%u,%u,%u,%u,%u,%u,%f,%f,%f,%f,%f,%f,%f"
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,68,%u,%u,%u,%u,%u,%u,%u,%u,%f,%f,%f,%f,%f,%f,%f"
-	#endif
-,
-		useMag,
-		usePres,
-		posAtt,
-		velAtt,
-		velBias,
-		useFoam,
-		gpsCovType,
-		velCount,
-		velInit,
-		moveOrigin,
-		gpsTimeout,
-		deltaLimitPos,
-		deltaLimitVel,
-		minPosUncertainty,
-		minVelUncertainty);
-
-	return finalizeCommand(errorDetectionMode, buffer, length);
-}
-
-size_t Packet::genReadInsStateLla(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
-{
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,72");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,72");
-	#endif
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNRRG,74");
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadInsStateEcef(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genWriteStartupFilterBiasEstimate(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, vec3f gyroBias, vec3f accelBias, float pressureBias)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,73");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,73");
-	#endif
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNWRG,74,")
+		.appendFixed(gyroBias.x).append(',')
+		.appendFixed(gyroBias.y).append(',')
+		.appendFixed(gyroBias.z).append(',')
+		.appendFixed(accelBias.x).append(',')
+		.appendFixed(accelBias.y).append(',')
+		.appendFixed(accelBias.z).append(',')
+		.appendFixed(pressureBias);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadStartupFilterBiasEstimate(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadDeltaThetaAndDeltaVelocity(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,74");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,74");
-	#endif
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNRRG,80");
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteStartupFilterBiasEstimate(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, vec3f gyroBias, vec3f accelBias, float pressureBias)
+size_t PacketView::genReadDeltaThetaAndDeltaVelocityConfiguration(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,74,%f,%f,%f,%f,%f,%f,%f"
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,74,%f,%f,%f,%f,%f,%f,%f"
-	#endif
-,
-		gyroBias.x,
-		gyroBias.y,
-		gyroBias.z,
-		accelBias.x,
-		accelBias.y,
-		accelBias.z,
-		pressureBias);
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNRRG,82");
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadDeltaThetaAndDeltaVelocity(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genWriteDeltaThetaAndDeltaVelocityConfiguration(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint8_t integrationFrame, uint8_t gyroCompensation, uint8_t accelCompensation)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,80");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,80");
-	#endif
-
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return genWriteDeltaThetaAndDeltaVelocityConfiguration(errorDetectionMode, buffer, size, integrationFrame, gyroCompensation, accelCompensation, 0);	
 }
 
-size_t Packet::genReadDeltaThetaAndDeltaVelocityConfiguration(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genWriteDeltaThetaAndDeltaVelocityConfiguration(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint8_t integrationFrame, uint8_t gyroCompensation, uint8_t accelCompensation, uint8_t earthRateCorrection)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,82");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,82");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNWRG,82,")
+		.appendUnsigned(integrationFrame).append(',')
+		.appendUnsigned(gyroCompensation).append(',')
+		.appendUnsigned(accelCompensation).append(',')
+		.appendUnsigned(earthRateCorrection).append(",0");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteDeltaThetaAndDeltaVelocityConfiguration(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint8_t integrationFrame, uint8_t gyroCompensation, uint8_t accelCompensation)
+size_t PacketView::genReadReferenceVectorConfiguration(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	return genWriteDeltaThetaAndDeltaVelocityConfiguration(errorDetectionMode, buffer, size, integrationFrame, gyroCompensation, accelCompensation, 0);	
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNRRG,83");
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteDeltaThetaAndDeltaVelocityConfiguration(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint8_t integrationFrame, uint8_t gyroCompensation, uint8_t accelCompensation, uint8_t earthRateCorrection)
+size_t PacketView::genWriteReferenceVectorConfiguration(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint8_t useMagModel, uint8_t useGravityModel, uint32_t recalcThreshold, float year, vec3d position)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,82,%u,%u,%u,%u,0"
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,82,%u,%u,%u,%u,0"
-	#endif
-,
-		integrationFrame,
-		gyroCompensation,
-		accelCompensation,
-		earthRateCorrection);
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNWRG,83,")
+		.appendUnsigned(useMagModel).append(',')
+		.appendUnsigned(useGravityModel).append(",0,0,")
+		.appendUnsigned(recalcThreshold).append(',')
+		.appendFixed(year).append(',')
+		.appendFixed(position.x).append(',')
+		.appendFixed(position.y).append(',')
+		.appendFixed(position.z);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadReferenceVectorConfiguration(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadGyroCompensation(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,83");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,83");
-	#endif
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNRRG,84");
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteReferenceVectorConfiguration(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint8_t useMagModel, uint8_t useGravityModel, uint32_t recalcThreshold, float year, vec3d position)
+size_t PacketView::genWriteGyroCompensation(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, mat3f c, vec3f b)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,83,%u,%u,0,0,%u,%f,%f,%f,%f"
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,83,%u,%u,0,0,%u,%f,%f,%f,%f"
-	#endif
-,
-		useMagModel,
-		useGravityModel,
-		recalcThreshold,
-		year,
-		position.x,
-		position.y,
-		position.z);
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNWRG,84,")
+		.appendFixed(c.e00).append(',')
+		.appendFixed(c.e01).append(',')
+		.appendFixed(c.e02).append(',')
+		.appendFixed(c.e10).append(',')
+		.appendFixed(c.e11).append(',')
+		.appendFixed(c.e12).append(',')
+		.appendFixed(c.e20).append(',')
+		.appendFixed(c.e21).append(',')
+		.appendFixed(c.e22).append(',')
+		.appendFixed(b.x).append(',')
+		.appendFixed(b.y).append(',')
+		.appendFixed(b.z);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadGyroCompensation(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadImuFilteringConfiguration(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,84");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,84");
-	#endif
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNRRG,85");
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteGyroCompensation(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, mat3f c, vec3f b)
+size_t PacketView::genWriteImuFilteringConfiguration(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint16_t magWindowSize, uint16_t accelWindowSize, uint16_t gyroWindowSize, uint16_t tempWindowSize, uint16_t presWindowSize, uint8_t magFilterMode, uint8_t accelFilterMode, uint8_t gyroFilterMode, uint8_t tempFilterMode, uint8_t presFilterMode)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,84,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f"
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,84,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f"
-	#endif
-,
-		c.e00,
-		c.e01,
-		c.e02,
-		c.e10,
-		c.e11,
-		c.e12,
-		c.e20,
-		c.e21,
-		c.e22,
-		b.x,
-		b.y,
-		b.z);
-
-	return finalizeCommand(errorDetectionMode, buffer, length);
-}
-
-size_t Packet::genReadImuFilteringConfiguration(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
-{
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,85");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,85");
-	#endif
+	CommandBuilder command(buffer, size);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	command.append("$VNWRG,85,")
+		.appendUnsigned(magWindowSize).append(',')
+		.appendUnsigned(accelWindowSize).append(',')
+		.appendUnsigned(gyroWindowSize).append(',')
+		.appendUnsigned(tempWindowSize).append(',')
+		.appendUnsigned(presWindowSize).append(',')
+		.appendUnsigned(magFilterMode).append(',')
+		.appendUnsigned(accelFilterMode).append(',')
+		.appendUnsigned(gyroFilterMode).append(',')
+		.appendUnsigned(tempFilterMode).append(',')
+		.appendUnsigned(presFilterMode);
+
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteImuFilteringConfiguration(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint16_t magWindowSize, uint16_t accelWindowSize, uint16_t gyroWindowSize, uint16_t tempWindowSize, uint16_t presWindowSize, uint8_t magFilterMode, uint8_t accelFilterMode, uint8_t gyroFilterMode, uint8_t tempFilterMode, uint8_t presFilterMode)
+size_t PacketView::genReadGpsCompassBaseline(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,85,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u"
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,85,%u,%u,%u,%u,%u,%u,%u,%u,%u,%u"
-	#endif
-,
-		magWindowSize,
-		accelWindowSize,
-		gyroWindowSize,
-		tempWindowSize,
-		presWindowSize,
-		magFilterMode,
-		accelFilterMode,
-		gyroFilterMode,
-		tempFilterMode,
-		presFilterMode);
-
-	return finalizeCommand(errorDetectionMode, buffer, length);
-}
-
-size_t Packet::genReadGpsCompassBaseline(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
-{
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,93");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,93");
-	#endif
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNRRG,93");
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteGpsCompassBaseline(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, vec3f position, vec3f uncertainty)
+size_t PacketView::genWriteGpsCompassBaseline(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, vec3f position, vec3f uncertainty)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,93,%f,%f,%f,%f,%f,%f"
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,93,%f,%f,%f,%f,%f,%f"
-	#endif
-,
-		position.x,
-		position.y,
-		position.z,
-		uncertainty.x,
-		uncertainty.y,
-		uncertainty.z);
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNWRG,93,")
+		.appendFixed(position.x).append(',')
+		.appendFixed(position.y).append(',')
+		.appendFixed(position.z).append(',')
+		.appendFixed(uncertainty.x).append(',')
+		.appendFixed(uncertainty.y).append(',')
+		.appendFixed(uncertainty.z);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadGpsCompassEstimatedBaseline(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadGpsCompassEstimatedBaseline(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,97");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,97");
-	#endif
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNRRG,97");
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadImuRateConfiguration(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadImuRateConfiguration(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,227");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,227");
-	#endif
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNRRG,227");
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genWriteImuRateConfiguration(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint16_t imuRate, uint16_t navDivisor, float filterTargetRate, float filterMinRate)
+size_t PacketView::genWriteImuRateConfiguration(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size, uint16_t imuRate, uint16_t navDivisor, float filterTargetRate, float filterMinRate)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNWRG,227,%u,%u,%f,%f"
-	#else
-	size_t length = sprintf(buffer, "$VNWRG,227,%u,%u,%f,%f"
-	#endif
-,
-		imuRate,
-		navDivisor,
-		filterTargetRate,
-		filterMinRate);
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNWRG,227,")
+		.appendUnsigned(imuRate).append(',')
+		.appendUnsigned(navDivisor).append(',')
+		.appendFixed(filterTargetRate).append(',')
+		.appendFixed(filterMinRate);
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadYawPitchRollTrueBodyAccelerationAndAngularRates(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadYawPitchRollTrueBodyAccelerationAndAngularRates(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,239");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,239");
-	#endif
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNRRG,239");
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-size_t Packet::genReadYawPitchRollTrueInertialAccelerationAndAngularRates(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
+size_t PacketView::genReadYawPitchRollTrueInertialAccelerationAndAngularRates(ErrorDetectionMode errorDetectionMode, char *buffer, size_t size)
 {
-	#if VN_HAVE_SECURE_CRT
-	size_t length = sprintf_s(buffer, size, "$VNRRG,240");
-	#else
-	size_t length = sprintf(buffer, "$VNRRG,240");
-	#endif
+	CommandBuilder command(buffer, size);
+
+	command.append("$VNRRG,240");
 
-	return finalizeCommand(errorDetectionMode, buffer, length);
+	return finalizeCommand(errorDetectionMode, buffer, command.length());
 }
 
-void Packet::parseVNYPR(vec3f* yawPitchRoll)
+void PacketView::parseVNYPR(vec3f* yawPitchRoll)
 {
 	size_t parseIndex;
 
-	char* result = startAsciiPacketParse(_data, parseIndex);
+	const char* result = startAsciiPacketParse(_data, parseIndex);
 
 	yawPitchRoll->x = ATOFF; NEXT
 	yawPitchRoll->y = ATOFF; NEXT
 	yawPitchRoll->z = ATOFF;
 }
 
-void Packet::parseVNQTN(vec4f* quaternion)
+void PacketView::parseVNQTN(vec4f* quaternion)
 {
 	size_t parseIndex;
 
-	char* result = startAsciiPacketParse(_data, parseIndex);
+	const char* result = startAsciiPacketParse(_data, parseIndex);
 
 	quaternion->x = ATOFF; NEXT
 	quaternion->y = ATOFF; NEXT
@@ -2438,11 +2652,11 @@ void Packet::parseVNQTN(vec4f* quaternion)
 
 #ifdef INTERNAL
 
-void Packet::parseVNQTM(vec4f *quaternion, vec3f *magnetic)
+void PacketView::parseVNQTM(vec4f *quaternion, vec3f *magnetic)
 {
 	size_t parseIndex;
 
-	char* result = startAsciiPacketParse(_data, parseIndex);
+	const char* result = startAsciiPacketParse(_data, parseIndex);
 
 	quaternion->x = ATOFF; NEXT
 	quaternion->y = ATOFF; NEXT
@@ -2453,11 +2667,11 @@ void Packet::parseVNQTM(vec4f *quaternion, vec3f *magnetic)
 	magnetic->z = ATOFF;
 }
 
-void Packet::parseVNQTA(vec4f* quaternion, vec3f* acceleration)
+void PacketView::parseVNQTA(vec4f* quaternion, vec3f* acceleration)
 {
 	size_t parseIndex;
 
-	char* result = startAsciiPacketParse(_data, parseIndex);
+	const char* result = startAsciiPacketParse(_data, parseIndex);
 
 	quaternion->x = ATOFF; NEXT
 	quaternion->y = ATOFF; NEXT
@@ -2468,11 +2682,11 @@ void Packet::parseVNQTA(vec4f* quaternion, vec3f* acceleration)
 	acceleration->z = ATOFF;
 }
 
-void Packet::parseVNQTR(vec4f* quaternion, vec3f* angularRate)
+void PacketView::parseVNQTR(vec4f* quaternion, vec3f* angularRate)
 {
 	size_t parseIndex;
 
-	char* result = startAsciiPacketParse(_data, parseIndex);
+	const char* result = startAsciiPacketParse(_data, parseIndex);
 
 	quaternion->x = ATOFF; NEXT
 	quaternion->y = ATOFF; NEXT
@@ -2483,11 +2697,11 @@ void Packet::parseVNQTR(vec4f* quaternion, vec3f* angularRate)
 	angularRate->z = ATOFF;
 }
 
-void Packet::parseVNQMA(vec4f* quaternion, vec3f* magnetic, vec3f* acceleration)
+void PacketView::parseVNQMA(vec4f* quaternion, vec3f* magnetic, vec3f* acceleration)
 {
 	size_t parseIndex;
 
-	char* result = startAsciiPacketParse(_data, parseIndex);
+	const char* result = startAsciiPacketParse(_data, parseIndex);
 
 	quaternion->x = ATOFF; NEXT
 	quaternion->y = ATOFF; NEXT
@@ -2501,11 +2715,11 @@ void Packet::parseVNQMA(vec4f* quaternion, vec3f* magnetic, vec3f* acceleration)
 	acceleration->z = ATOFF;
 }
 
-void Packet::parseVNQAR(vec4f* quaternion, vec3f* acceleration, vec3f* angularRate)
+void PacketView::parseVNQAR(vec4f* quaternion, vec3f* acceleration, vec3f* angularRate)
 {
 	size_t parseIndex;
 
-	char* result = startAsciiPacketParse(_data, parseIndex);
+	const char* result = startAsciiPacketParse(_data, parseIndex);
 
 	quaternion->x = ATOFF; NEXT
 	quaternion->y = ATOFF; NEXT
@@ -2521,11 +2735,11 @@ void Packet::parseVNQAR(vec4f* quaternion, vec3f* acceleration, vec3f* angularRa
 
 #endif
 
-void Packet::parseVNQMR(vec4f* quaternion, vec3f* magnetic, vec3f* acceleration, vec3f* angularRate)
+void PacketView::parseVNQMR(vec4f* quaternion, vec3f* magnetic, vec3f* acceleration, vec3f* angularRate)
 {
 	size_t parseIndex;
 
-	char* result = startAsciiPacketParse(_data, parseIndex);
+	const char* result = startAsciiPacketParse(_data, parseIndex);
 
 	quaternion->x = ATOFF; NEXT
 	quaternion->y = ATOFF; NEXT
@@ -2544,90 +2758,63 @@ void Packet::parseVNQMR(vec4f* quaternion, vec3f* magnetic, vec3f* acceleration,
 
 #ifdef INTERNAL
 
-void Packet::parseVNDCM(mat3f* dcm)
-{
-	// TODO: Implement.
-	/*
-	result = strtok(buffer, delims);
-	result = strtok(0, delims);
-	if (result == NULL)
-	return;
-	data.dcm.c00 = atof(result);
-	result = strtok(0, delims);
-	if (result == NULL)
-	return;
-	data.dcm.c01 = atof(result);
-	result = strtok(0, delims);
-	if (result == NULL)
-	return;
-	data.dcm.c02 = atof(result);
-	result = strtok(0, delims);
-	if (result == NULL)
-	return;
-	data.dcm.c10 = atof(result);
-	result = strtok(0, delims);
-	if (result == NULL)
-	return;
-	data.dcm.c11 = atof(result);
-	result = strtok(0, delims);
-	if (result == NULL)
-	return;
-	data.dcm.c12 = atof(result);
-	result = strtok(0, delims);
-	if (result == NULL)
-	return;
-	data.dcm.c20 = atof(result);
-	result = strtok(0, delims);
-	if (result == NULL)
-	return;
-	data.dcm.c21 = atof(result);
-	result = strtok(0, delims);
-	if (result == NULL)
-	return;
-	data.dcm.c22 = atof(result);
-	*/
+void PacketView::parseVNDCM(mat3f* dcm)
+{
+	size_t parseIndex;
+
+	const char* result = startAsciiPacketParse(_data, parseIndex);
+
+	dcm->e00 = ATOFF; NEXT
+	dcm->e01 = ATOFF; NEXT
+	dcm->e02 = ATOFF; NEXT
+	dcm->e10 = ATOFF; NEXT
+	dcm->e11 = ATOFF; NEXT
+	dcm->e12 = ATOFF; NEXT
+	dcm->e20 = ATOFF; NEXT
+	dcm->e21 = ATOFF; NEXT
+	dcm->e22 = ATOFF;
 }
 
 #endif
 
-void Packet::parseVNMAG(vec3f* magnetic)
+void PacketView::parseVNMAG(vec3f* magnetic)
 {
 	size_t parseIndex;
 
-	char* result = startAsciiPacketParse(_data, parseIndex);
+	const char* result = startAsciiPacketParse(_data, parseIndex);
 
 	magnetic->x = ATOFF; NEXT
 	magnetic->y = ATOFF; NEXT
 	magnetic->z = ATOFF;
 }
 
-void Packet::parseVNACC(vec3f* acceleration)
+void PacketView::parseVNACC(vec3f* acceleration)
 {
 	size_t parseIndex;
 
-	char* result = startAsciiPacketParse(_data, parseIndex);
+	const char* result = startAsciiPacketParse(_data, parseIndex);
 
 	acceleration->x = ATOFF; NEXT
 	acceleration->y = ATOFF; NEXT
 	acceleration->z = ATOFF;
 }
 
-void Packet::parseVNGYR(vec3f* angularRate)
+void PacketView::parseVNGYR(vec3f* angularRate)
 {
 	size_t parseIndex;
 
-	char* result = startAsciiPacketParse(_data, parseIndex);
+	const char* result = startAsciiPacketParse(_data, parseIndex);
 
 	angularRate->x = ATOFF; NEXT
 	angularRate->y = ATOFF; NEXT
 	angularRate->z = ATOFF;
 }
 
-void Packet::parseVNMAR(vec3f* magnetic, vec3f* acceleration, vec3f* angularRate)
+void PacketView::parseVNMAR(vec3f* magnetic, vec3f* acceleration, vec3f* angularRate)
 {
 	size_t parseIndex;
 
-	char* result = startAsciiPacketParse(_data, parseIndex);
+	const char* result = startAsciiPacketParse(_data, parseIndex);
 
 	magnetic->x = ATOFF; NEXT
 	magnetic->y = ATOFF; NEXT
@@ -2640,11 +2827,11 @@ void Packet::parseVNMAR(vec3f* magnetic, vec3f* acceleration, vec3f* angularRate
 	angularRate->z = ATOFF;
 }
 
-void Packet::parseVNYMR(vec3f* yawPitchRoll, vec3f* magnetic, vec3f* acceleration, vec3f* angularRate)
+void PacketView::parseVNYMR(vec3f* yawPitchRoll, vec3f* magnetic, vec3f* acceleration, vec3f* angularRate)
 {
 	size_t parseIndex;
 
-	char* result = startAsciiPacketParse(_data, parseIndex);
+	const char* result = startAsciiPacketParse(_data, parseIndex);
 
 	yawPitchRoll->x = ATOFF; NEXT
 	yawPitchRoll->y = ATOFF; NEXT
@@ -2662,11 +2849,11 @@ void Packet::parseVNYMR(vec3f* yawPitchRoll, vec3f* magnetic, vec3f* acceleratio
 
 #ifdef INTERNAL
 
-void Packet::parseVNYCM(vec3f* yawPitchRoll, vec3f* magnetic, vec3f* acceleration, vec3f* angularRate, float* temperature)
+void PacketView::parseVNYCM(vec3f* yawPitchRoll, vec3f* magnetic, vec3f* acceleration, vec3f* angularRate, float* temperature)
 {
 	size_t parseIndex;
 
-	char* result = startAsciiPacketParse(_data, parseIndex);
+	const char* result = startAsciiPacketParse(_data, parseIndex);
 
 	yawPitchRoll->x = ATOFF; NEXT
 	yawPitchRoll->y = ATOFF; NEXT
@@ -2685,11 +2872,11 @@ void Packet::parseVNYCM(vec3f* yawPitchRoll, vec3f* magnetic, vec3f* acceleratio
 
 #endif
 
-void Packet::parseVNYBA(vec3f* yawPitchRoll, vec3f* accelerationBody, vec3f* angularRate)
+void PacketView::parseVNYBA(vec3f* yawPitchRoll, vec3f* accelerationBody, vec3f* angularRate)
 {
 	size_t parseIndex;
 
-	char* result = startAsciiPacketParse(_data, parseIndex);
+	const char* result = startAsciiPacketParse(_data, parseIndex);
 
 	yawPitchRoll->x = ATOFF; NEXT
 	yawPitchRoll->y = ATOFF; NEXT
@@ -2702,11 +2889,11 @@ void Packet::parseVNYBA(vec3f* yawPitchRoll, vec3f* accelerationBody, vec3f* ang
 	angularRate->z = ATOFF;
 }
 
-void Packet::parseVNYIA(vec3f* yawPitchRoll, vec3f* accelerationInertial, vec3f* angularRate)
+void PacketView::parseVNYIA(vec3f* yawPitchRoll, vec3f* accelerationInertial, vec3f* angularRate)
 {
 	size_t parseIndex;
 
-	char* result = startAsciiPacketParse(_data, parseIndex);
+	const char* result = startAsciiPacketParse(_data, parseIndex);
 
 	yawPitchRoll->x = ATOFF; NEXT
 	yawPitchRoll->y = ATOFF; NEXT
@@ -2721,11 +2908,11 @@ void Packet::parseVNYIA(vec3f* yawPitchRoll, vec3f* accelerationInertial, vec3f*
 
 #ifdef INTERNAL
 
-void Packet::parseVNICM(vec3f* yawPitchRoll, vec3f* magnetic, vec3f* accelerationInertial, vec3f* angularRate)
+void PacketView::parseVNICM(vec3f* yawPitchRoll, vec3f* magnetic, vec3f* accelerationInertial, vec3f* angularRate)
 {
 	size_t parseIndex;
 
-	char* result = startAsciiPacketParse(_data, parseIndex);
+	const char* result = startAsciiPacketParse(_data, parseIndex);
 
 	yawPitchRoll->x = ATOFF; NEXT
 	yawPitchRoll->y = ATOFF; NEXT
@@ -2743,11 +2930,11 @@ void Packet::parseVNICM(vec3f* yawPitchRoll, vec3f* magnetic, vec3f* acceleratio
 
 #endif
 
-void Packet::parseVNIMU(vec3f* magneticUncompensated, vec3f* accelerationUncompensated, vec3f* angularRateUncompensated, float* temperature, float* pressure)
+void PacketView::parseVNIMU(vec3f* magneticUncompensated, vec3f* accelerationUncompensated, vec3f* angularRateUncompensated, float* temperature, float* pressure)
 {
 	size_t parseIndex;
 
-	char* result = startAsciiPacketParse(_data, parseIndex);
+	const char* result = startAsciiPacketParse(_data, parseIndex);
 
 	magneticUncompensated->x = ATOFF; NEXT
 	magneticUncompensated->y = ATOFF; NEXT
@@ -2762,11 +2949,11 @@ void Packet::parseVNIMU(vec3f* magneticUncompensated, vec3f* accelerationUncompe
 	*pressure = ATOFF;
 }
 
-void Packet::parseVNGPS(double* time, uint16_t* week, uint8_t* gpsFix, uint8_t* numSats, vec3d* lla, vec3f* nedVel, vec3f* nedAcc, float* speedAcc, float* timeAcc)
+void PacketView::parseVNGPS(double* time, uint16_t* week, uint8_t* gpsFix, uint8_t* numSats, vec3d* lla, vec3f* nedVel, vec3f* nedAcc, float* speedAcc, float* timeAcc)
 {
 	size_t parseIndex;
 
-	char* result = startAsciiPacketParse(_data, parseIndex);
+	const char* result = startAsciiPacketParse(_data, parseIndex);
 
 	*time = ATOFD; NEXT
 	*week = ATOU16; NEXT
@@ -2785,11 +2972,11 @@ void Packet::parseVNGPS(double* time, uint16_t* week, uint8_t* gpsFix, uint8_t*
 	*timeAcc = ATOFF;
 }
 
-void Packet::parseVNINS(double* time, uint16_t* week, uint16_t* status, vec3f* yawPitchRoll, vec3d* lla, vec3f* nedVel, float* attUncertainty, float* posUncertainty, float* velUncertainty)
+void PacketView::parseVNINS(double* time, uint16_t* week, uint16_t* status, vec3f* yawPitchRoll, vec3d* lla, vec3f* nedVel, float* attUncertainty, float* posUncertainty, float* velUncertainty)
 {
 	size_t parseIndex;
 
-	char* result = startAsciiPacketParse(_data, parseIndex);
+	const char* result = startAsciiPacketParse(_data, parseIndex);
 
 	*time = ATOFD; NEXT
 	*week = ATOU16; NEXT
@@ -2808,11 +2995,11 @@ void Packet::parseVNINS(double* time, uint16_t* week, uint16_t* status, vec3f* y
 	*velUncertainty = ATOFF;
 }
 
-void Packet::parseVNINE(double* time, uint16_t* week, uint16_t* status, vec3f* ypr, vec3d* position, vec3f* velocity, float* attUncertainty, float* posUncertainty, float* velUncertainty)
+void PacketView::parseVNINE(double* time, uint16_t* week, uint16_t* status, vec3f* ypr, vec3d* position, vec3f* velocity, float* attUncertainty, float* posUncertainty, float* velUncertainty)
 {
 	size_t parseIndex;
 
-	char* result = startAsciiPacketParse(_data, parseIndex);
+	const char* result = startAsciiPacketParse(_data, parseIndex);
 
 	*time = ATOFD; NEXT
 	*week = ATOU16; NEXT
@@ -2831,11 +3018,11 @@ void Packet::parseVNINE(double* time, uint16_t* week, uint16_t* status, vec3f* y
 	*velUncertainty = ATOFF;
 }
 
-void Packet::parseVNISL(vec3f* ypr, vec3d* lla, vec3f* velocity, vec3f* acceleration, vec3f* angularRate)
+void PacketView::parseVNISL(vec3f* ypr, vec3d* lla, vec3f* velocity, vec3f* acceleration, vec3f* angularRate)
 {
 	size_t parseIndex;
 
-	char* result = startAsciiPacketParse(_data, parseIndex);
+	const char* result = startAsciiPacketParse(_data, parseIndex);
 
 	ypr->x = ATOFF; NEXT
 	ypr->y = ATOFF; NEXT
@@ -2854,11 +3041,11 @@ void Packet::parseVNISL(vec3f* ypr, vec3d* lla, vec3f* velocity, vec3f* accelera
 	angularRate->z = ATOFF;
 }
 
-void Packet::parseVNISE(vec3f* ypr, vec3d* position, vec3f* velocity, vec3f* acceleration, vec3f* angularRate)
+void PacketView::parseVNISE(vec3f* ypr, vec3d* position, vec3f* velocity, vec3f* acceleration, vec3f* angularRate)
 {
 	size_t parseIndex;
 
-	char* result = startAsciiPacketParse(_data, parseIndex);
+	const char* result = startAsciiPacketParse(_data, parseIndex);
 
 	ypr->x = ATOFF; NEXT
 	ypr->y = ATOFF; NEXT
@@ -2879,11 +3066,11 @@ void Packet::parseVNISE(vec3f* ypr, vec3d* position, vec3f* velocity, vec3f* acc
 
 #ifdef INTERNAL
 
-void Packet::parseVNRAW(vec3f *magneticVoltage, vec3f *accelerationVoltage, vec3f *angularRateVoltage, float* temperatureVoltage)
+void PacketView::parseVNRAW(vec3f *magneticVoltage, vec3f *accelerationVoltage, vec3f *angularRateVoltage, float* temperatureVoltage)
 {
 	size_t parseIndex;
 
-	char* result = startAsciiPacketParse(_data, parseIndex);
+	const char* result = startAsciiPacketParse(_data, parseIndex);
 
 	magneticVoltage->x = ATOFF; NEXT
 	magneticVoltage->y = ATOFF; NEXT
@@ -2897,11 +3084,11 @@ void Packet::parseVNRAW(vec3f *magneticVoltage, vec3f *accelerationVoltage, vec3
 	*temperatureVoltage = ATOFF;
 }
 
-void Packet::parseVNCMV(vec3f* magneticUncompensated, vec3f* accelerationUncompensated, vec3f* angularRateUncompensated, float* temperature)
+void PacketView::parseVNCMV(vec3f* magneticUncompensated, vec3f* accelerationUncompensated, vec3f* angularRateUncompensated, float* temperature)
 {
 	size_t parseIndex;
 
-	char* result = startAsciiPacketParse(_data, parseIndex);
+	const char* result = startAsciiPacketParse(_data, parseIndex);
 
 	magneticUncompensated->x = ATOFF; NEXT
 	magneticUncompensated->y = ATOFF; NEXT
@@ -2915,11 +3102,11 @@ void Packet::parseVNCMV(vec3f* magneticUncompensated, vec3f* accelerationUncompe
 	*temperature = ATOFF;
 }
 
-void Packet::parseVNSTV(vec4f* quaternion, vec3f* angularRateBias)
+void PacketView::parseVNSTV(vec4f* quaternion, vec3f* angularRateBias)
 {
 	size_t parseIndex;
 
-	char* result = startAsciiPacketParse(_data, parseIndex);
+	const char* result = startAsciiPacketParse(_data, parseIndex);
 
 	quaternion->x = ATOFF; NEXT
 	quaternion->y = ATOFF; NEXT
@@ -2930,11 +3117,11 @@ void Packet::parseVNSTV(vec4f* quaternion, vec3f* angularRateBias)
 	angularRateBias->z = ATOFF;
 }
 
-void Packet::parseVNCOV(vec3f* attitudeVariance, vec3f* angularRateBiasVariance)
+void PacketView::parseVNCOV(vec3f* attitudeVariance, vec3f* angularRateBiasVariance)
 {
 	size_t parseIndex;
 
-	char* result = startAsciiPacketParse(_data, parseIndex);
+	const char* result = startAsciiPacketParse(_data, parseIndex);
 
 	attitudeVariance->x = ATOFF; NEXT
 	attitudeVariance->y = ATOFF; NEXT
@@ -2946,11 +3133,11 @@ void Packet::parseVNCOV(vec3f* attitudeVariance, vec3f* angularRateBiasVariance)
 
 #endif
 
-void Packet::parseVNGPE(double* tow, uint16_t* week, uint8_t* gpsFix, uint8_t* numSats, vec3d* position, vec3f* velocity, vec3f* posAcc, float* speedAcc, float* timeAcc)
+void PacketView::parseVNGPE(double* tow, uint16_t* week, uint8_t* gpsFix, uint8_t* numSats, vec3d* position, vec3f* velocity, vec3f* posAcc, float* speedAcc, float* timeAcc)
 {
 	size_t parseIndex;
 
-	char* result = startAsciiPacketParse(_data, parseIndex);
+	const char* result = startAsciiPacketParse(_data, parseIndex);
 
 	*tow = ATOFD; NEXT
 	*week = ATOU16; NEXT
@@ -2969,11 +3156,11 @@ void Packet::parseVNGPE(double* tow, uint16_t* week, uint8_t* gpsFix, uint8_t* n
 	*timeAcc = ATOFF;
 }
 
-void Packet::parseVNDTV(float* deltaTime, vec3f* deltaTheta, vec3f* deltaVelocity)
+void PacketView::parseVNDTV(float* deltaTime, vec3f* deltaTheta, vec3f* deltaVelocity)
 {
 	size_t parseIndex;
 
-	char* result = startAsciiPacketParse(_data, parseIndex);
+	const char* result = startAsciiPacketParse(_data, parseIndex);
 
 	*deltaTime = ATOFF; NEXT
 	deltaTheta->x = ATOFF; NEXT
@@ -2984,7 +3171,7 @@ void Packet::parseVNDTV(float* deltaTime, vec3f* deltaTheta, vec3f* deltaVelocit
 	deltaVelocity->z = ATOFF;
 }
 
-size_t Packet::computeBinaryPacketLength(char const* startOfPossibleBinaryPacket)
+size_t PacketView::computeBinaryPacketLength(char const* startOfPossibleBinaryPacket)
 {
 	char groupsPresent = startOfPossibleBinaryPacket[1];
 	size_t runningPayloadLength = 2;	// Start of packet character plus groups present field.
@@ -3035,44 +3222,40 @@ size_t Packet::computeBinaryPacketLength(char const* startOfPossibleBinaryPacket
 	return runningPayloadLength + 2;	// Add 2 bytes for CRC.
 }
 
-size_t Packet::computeNumOfBytesForBinaryGroupPayload(BinaryGroup group, uint16_t groupField)
+size_t PacketView::computeNumOfBytesForBinaryGroupPayload(BinaryGroup group, uint16_t groupField)
 {
-	size_t runningLength = 0;
+	const unsigned char (*lengths)[16] = BinaryGroupNibbleLengths[binaryGroupIndex(group)];
 
-	// Determine which group is present.
-	size_t groupIndex = 0;
-	for (size_t i = 0; i < 8; i++, groupIndex++)
-	{
-		if ((static_cast<size_t>(group) >> i) & 0x01)
-			break;
-	}
+	return lengths[0][groupField & 0x0F]
+		+ lengths[1][(groupField >> 4) & 0x0F]
+		+ lengths[2][(groupField >> 8) & 0x0F]
+		+ lengths[3][(groupField >> 12) & 0x0F];
+}
 
-	for (size_t i = 0; i < sizeof(uint16_t) * 8; i++)
-	{
-		if ((groupField >> i) & 1)
-		{
-			runningLength += BinaryGroupLengths[groupIndex][i];
-		}
-	}
+size_t PacketView::computeBinaryFieldOffset(BinaryGroup group, uint16_t groupField, size_t fieldIndex)
+{
+	if (fieldIndex >= 16)
+		throw invalid_argument("fieldIndex");
 
-	return runningLength;
+	// The offset of a field is the combined length of the fields preceding it.
+	return computeNumOfBytesForBinaryGroupPayload(group, static_cast<uint16_t>(groupField & ((1u << fieldIndex) - 1)));
 }
 
-SensorError Packet::parseError()
+SensorError PacketView::parseError()
 {
 	size_t parseIndex;
 
-	char* result = startAsciiPacketParse(_data, parseIndex);
+	const char* result = startAsciiPacketParse(_data, parseIndex);
 
 	return static_cast<SensorError>(to_uint8_from_hexstr(result));
 }
 
-uint8_t Packet::groups()
+uint8_t PacketView::groups()
 {
 	return _data[1];
 }
 
-uint16_t Packet::groupField(size_t index)
+uint16_t PacketView::groupField(size_t index)
 {
 	uint16_t gf;
 	char* groupStart = _data + index * sizeof(uint16_t) + 2;
@@ -3082,7 +3265,7 @@ uint16_t Packet::groupField(size_t index)
 	return stoh(gf);
 }
 
-void Packet::parseBinaryOutput(
+void PacketView::parseBinaryOutput(
 	uint16_t* asyncMode,
 	uint16_t* rateDivisor,
 	uint16_t* outputGroup,
@@ -3096,7 +3279,7 @@ void Packet::parseBinaryOutput(
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	*commonField = 0;
 	*timeField = 0;
@@ -3108,122 +3291,108 @@ void Packet::parseBinaryOutput(
 
 	*asyncMode = ATOU16; NEXT
 	*rateDivisor = ATOU16; NEXT
-	*outputGroup = ATOU16;
+	*outputGroup = ATOU16X;
 	if (*outputGroup & 0x0001)
 	{
 		NEXT
-		*commonField = ATOU16;
+		*commonField = ATOU16X;
 	}
 	if (*outputGroup & 0x0002)
 	{
 		NEXT
-		*timeField = ATOU16;
+		*timeField = ATOU16X;
 	}
 	if (*outputGroup & 0x0004)
 	{
 		NEXT
-		*imuField = ATOU16;
+		*imuField = ATOU16X;
 	}
 	if (*outputGroup & 0x0008)
 	{
 		NEXT
-		*gpsField = ATOU16;
+		*gpsField = ATOU16X;
 	}
 	if (*outputGroup & 0x0010)
 	{
 		NEXT
-		*attitudeField = ATOU16;
+		*attitudeField = ATOU16X;
 	}
 	if (*outputGroup & 0x0020)
 	{
 		NEXT
-		*insField = ATOU16;
+		*insField = ATOU16X;
 	}
   if(*outputGroup & 0x0040) {
     NEXT
-      *gps2Field = ATOU16;
+      *gps2Field = ATOU16X;
   }
 }
 
-void Packet::parseUserTag(char* tag)
+void PacketView::parseUserTag(char* tag)
 {
 	size_t parseIndex;
 
-	char* result = startAsciiPacketParse(_data, parseIndex);
+	const char* result = startAsciiPacketParse(_data, parseIndex);
 
-	if (*(result + strlen(result) + 1) == '*')
+	if (result[asciiFieldLength(result) + 1] == '*')
 	{
 		tag[0] = '\0';
 		return;
 	}
 
 	NEXT
-	
-	#if defined(_MSC_VER)
-		//Unable to use strcpy_s since we do not have length of the output array.
-		#pragma warning(push)
-		#pragma warning(disable:4996)
-	#endif
 
-	strcpy(tag, result);
+	size_t length = asciiFieldLength(result);
 
-	#if defined(_MSC_VER)
-		#pragma warning(pop)
-	#endif
+	memcpy(tag, result, length);
+	tag[length] = '\0';
 }
 
-void Packet::parseModelNumber(char* productName)
+void PacketView::parseModelNumber(char* productName)
 {
 	size_t parseIndex;
 
-	char* result = startAsciiPacketParse(_data, parseIndex);
+	const char* result = startAsciiPacketParse(_data, parseIndex);
 
-	if (*(result + strlen(result) + 1) == '*')
+	if (result[asciiFieldLength(result) + 1] == '*')
 	{
 		productName[0] = '\0';
 		return;
 	}
 
 	NEXT
-	
-	#if defined(_MSC_VER)
-		//Unable to use strcpy_s since we do not have length of the output array.
-		#pragma warning(push)
-		#pragma warning(disable:4996)
-	#endif
 
-	strcpy(productName, result);
+	size_t length = asciiFieldLength(result);
 
-	#if defined(_MSC_VER)
-		#pragma warning(pop)
-	#endif
+	memcpy(productName, result, length);
+	productName[length] = '\0';
 }
 
-void Packet::parseHardwareRevision(uint32_t* revision)
+void PacketView::parseHardwareRevision(uint32_t* revision)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	*revision = ATOU32;
 }
 
-void Packet::parseSerialNumber(uint32_t* serialNum)
+void PacketView::parseSerialNumber(uint32_t* serialNum)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	*serialNum = ATOU32;
 }
 
-void Packet::parseFirmwareVersion(char* firmwareVersion)
+void PacketView::parseFirmwareVersion(char* firmwareVersion)
 {
 	size_t parseIndex;
 
-	char* result = startAsciiPacketParse(_data, parseIndex);
+	const char* result = startAsciiPacketParse(_data, parseIndex);
 
-	if (*(result + strlen(result) + 1) == '*')
+	if (result[asciiFieldLength(result) + 1] == '*')
 	{
 		firmwareVersion[0] = '\0';
 		return;
@@ -3231,62 +3400,55 @@ void Packet::parseFirmwareVersion(char* firmwareVersion)
 
 	NEXT
 
-	#if defined(_MSC_VER)
-		//Unable to use strcpy_s since we do not have length of the output array.
-		#pragma warning(push)
-		#pragma warning(disable:4996)
-	#endif
-
-	strcpy(firmwareVersion, result);
+	size_t length = asciiFieldLength(result);
 
-	#if defined(_MSC_VER)
-		#pragma warning(pop)
-	#endif
+	memcpy(firmwareVersion, result, length);
+	firmwareVersion[length] = '\0';
 }
 
-void Packet::parseSerialBaudRate(uint32_t* baudrate)
+void PacketView::parseSerialBaudRate(uint32_t* baudrate)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	*baudrate = ATOU32;
 }
 
-void Packet::parseAsyncDataOutputType(uint32_t* ador)
+void PacketView::parseAsyncDataOutputType(uint32_t* ador)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	*ador = ATOU32;
 }
 
-void Packet::parseAsyncDataOutputFrequency(uint32_t* adof)
+void PacketView::parseAsyncDataOutputFrequency(uint32_t* adof)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	*adof = ATOU32;
 }
 
-void Packet::parseYawPitchRoll(vec3f* yawPitchRoll)
+void PacketView::parseYawPitchRoll(vec3f* yawPitchRoll)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	yawPitchRoll->x = ATOFF; NEXT
 	yawPitchRoll->y = ATOFF; NEXT
 	yawPitchRoll->z = ATOFF;
 }
 
-void Packet::parseAttitudeQuaternion(vec4f* quat)
+void PacketView::parseAttitudeQuaternion(vec4f* quat)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	quat->x = ATOFF; NEXT
 	quat->y = ATOFF; NEXT
@@ -3294,11 +3456,11 @@ void Packet::parseAttitudeQuaternion(vec4f* quat)
 	quat->w = ATOFF;
 }
 
-void Packet::parseQuaternionMagneticAccelerationAndAngularRates(vec4f* quat, vec3f* mag, vec3f* accel, vec3f* gyro)
+void PacketView::parseQuaternionMagneticAccelerationAndAngularRates(vec4f* quat, vec3f* mag, vec3f* accel, vec3f* gyro)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	quat->x = ATOFF; NEXT
 	quat->y = ATOFF; NEXT
@@ -3315,44 +3477,44 @@ void Packet::parseQuaternionMagneticAccelerationAndAngularRates(vec4f* quat, vec
 	gyro->z = ATOFF;
 }
 
-void Packet::parseMagneticMeasurements(vec3f* mag)
+void PacketView::parseMagneticMeasurements(vec3f* mag)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	mag->x = ATOFF; NEXT
 	mag->y = ATOFF; NEXT
 	mag->z = ATOFF;
 }
 
-void Packet::parseAccelerationMeasurements(vec3f* accel)
+void PacketView::parseAccelerationMeasurements(vec3f* accel)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	accel->x = ATOFF; NEXT
 	accel->y = ATOFF; NEXT
 	accel->z = ATOFF;
 }
 
-void Packet::parseAngularRateMeasurements(vec3f* gyro)
+void PacketView::parseAngularRateMeasurements(vec3f* gyro)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	gyro->x = ATOFF; NEXT
 	gyro->y = ATOFF; NEXT
 	gyro->z = ATOFF;
 }
 
-void Packet::parseMagneticAccelerationAndAngularRates(vec3f* mag, vec3f* accel, vec3f* gyro)
+void PacketView::parseMagneticAccelerationAndAngularRates(vec3f* mag, vec3f* accel, vec3f* gyro)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	mag->x = ATOFF; NEXT
 	mag->y = ATOFF; NEXT
@@ -3365,11 +3527,11 @@ void Packet::parseMagneticAccelerationAndAngularRates(vec3f* mag, vec3f* accel,
 	gyro->z = ATOFF;
 }
 
-void Packet::parseMagneticAndGravityReferenceVectors(vec3f* magRef, vec3f* accRef)
+void PacketView::parseMagneticAndGravityReferenceVectors(vec3f* magRef, vec3f* accRef)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	magRef->x = ATOFF; NEXT
 	magRef->y = ATOFF; NEXT
@@ -3379,11 +3541,11 @@ void Packet::parseMagneticAndGravityReferenceVectors(vec3f* magRef, vec3f* accRe
 	accRef->z = ATOFF;
 }
 
-void Packet::parseFilterMeasurementsVarianceParameters(float* angularWalkVariance, vec3f* angularRateVariance, vec3f* magneticVariance, vec3f* accelerationVariance)
+void PacketView::parseFilterMeasurementsVarianceParameters(float* angularWalkVariance, vec3f* angularRateVariance, vec3f* magneticVariance, vec3f* accelerationVariance)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	*angularWalkVariance = ATOFF; NEXT
 	angularRateVariance->x = ATOFF; NEXT
@@ -3397,11 +3559,11 @@ void Packet::parseFilterMeasurementsVarianceParameters(float* angularWalkVarianc
 	accelerationVariance->z = ATOFF;
 }
 
-void Packet::parseMagnetometerCompensation(mat3f* c, vec3f* b)
+void PacketView::parseMagnetometerCompensation(mat3f* c, vec3f* b)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	c->e00 = ATOFF; NEXT
 	c->e01 = ATOFF; NEXT
@@ -3417,11 +3579,11 @@ void Packet::parseMagnetometerCompensation(mat3f* c, vec3f* b)
 	b->z = ATOFF;
 }
 
-void Packet::parseFilterActiveTuningParameters(float* magneticDisturbanceGain, float* accelerationDisturbanceGain, float* magneticDisturbanceMemory, float* accelerationDisturbanceMemory)
+void PacketView::parseFilterActiveTuningParameters(float* magneticDisturbanceGain, float* accelerationDisturbanceGain, float* magneticDisturbanceMemory, float* accelerationDisturbanceMemory)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	*magneticDisturbanceGain = ATOFF; NEXT
 	*accelerationDisturbanceGain = ATOFF; NEXT
@@ -3429,11 +3591,11 @@ void Packet::parseFilterActiveTuningParameters(float* magneticDisturbanceGain, f
 	*accelerationDisturbanceMemory = ATOFF;
 }
 
-void Packet::parseAccelerationCompensation(mat3f* c, vec3f* b)
+void PacketView::parseAccelerationCompensation(mat3f* c, vec3f* b)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	c->e00 = ATOFF; NEXT
 	c->e01 = ATOFF; NEXT
@@ -3449,11 +3611,11 @@ void Packet::parseAccelerationCompensation(mat3f* c, vec3f* b)
 	b->z = ATOFF;
 }
 
-void Packet::parseReferenceFrameRotation(mat3f* c)
+void PacketView::parseReferenceFrameRotation(mat3f* c)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	c->e00 = ATOFF; NEXT
 	c->e01 = ATOFF; NEXT
@@ -3466,11 +3628,11 @@ void Packet::parseReferenceFrameRotation(mat3f* c)
 	c->e22 = ATOFF;
 }
 
-void Packet::parseYawPitchRollMagneticAccelerationAndAngularRates(vec3f* yawPitchRoll, vec3f* mag, vec3f* accel, vec3f* gyro)
+void PacketView::parseYawPitchRollMagneticAccelerationAndAngularRates(vec3f* yawPitchRoll, vec3f* mag, vec3f* accel, vec3f* gyro)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	yawPitchRoll->x = ATOFF; NEXT
 	yawPitchRoll->y = ATOFF; NEXT
@@ -3486,11 +3648,11 @@ void Packet::parseYawPitchRollMagneticAccelerationAndAngularRates(vec3f* yawPitc
 	gyro->z = ATOFF;
 }
 
-void Packet::parseCommunicationProtocolControl(uint8_t* serialCount, uint8_t* serialStatus, uint8_t* spiCount, uint8_t* spiStatus, uint8_t* serialChecksum, uint8_t* spiChecksum, uint8_t* errorMode)
+void PacketView::parseCommunicationProtocolControl(uint8_t* serialCount, uint8_t* serialStatus, uint8_t* spiCount, uint8_t* spiStatus, uint8_t* serialChecksum, uint8_t* spiChecksum, uint8_t* errorMode)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	*serialCount = ATOU8; NEXT
 	*serialStatus = ATOU8; NEXT
@@ -3501,11 +3663,11 @@ void Packet::parseCommunicationProtocolControl(uint8_t* serialCount, uint8_t* se
 	*errorMode = ATOU8;
 }
 
-void Packet::parseSynchronizationControl(uint8_t* syncInMode, uint8_t* syncInEdge, uint16_t* syncInSkipFactor, uint8_t* syncOutMode, uint8_t* syncOutPolarity, uint16_t* syncOutSkipFactor, uint32_t* syncOutPulseWidth)
+void PacketView::parseSynchronizationControl(uint8_t* syncInMode, uint8_t* syncInEdge, uint16_t* syncInSkipFactor, uint8_t* syncOutMode, uint8_t* syncOutPolarity, uint16_t* syncOutSkipFactor, uint32_t* syncOutPulseWidth)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	*syncInMode = ATOU8; NEXT
 	*syncInEdge = ATOU8; NEXT
@@ -3517,22 +3679,22 @@ void Packet::parseSynchronizationControl(uint8_t* syncInMode, uint8_t* syncInEdg
 	*syncOutPulseWidth = ATOU32; NEXT
 }
 
-void Packet::parseSynchronizationStatus(uint32_t* syncInCount, uint32_t* syncInTime, uint32_t* syncOutCount)
+void PacketView::parseSynchronizationStatus(uint32_t* syncInCount, uint32_t* syncInTime, uint32_t* syncOutCount)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	*syncInCount = ATOU32; NEXT
 	*syncInTime = ATOU32; NEXT
 	*syncOutCount = ATOU32;
 }
 
-void Packet::parseFilterBasicControl(uint8_t* magMode, uint8_t* extMagMode, uint8_t* extAccMode, uint8_t* extGyroMode, vec3f* gyroLimit)
+void PacketView::parseFilterBasicControl(uint8_t* magMode, uint8_t* extMagMode, uint8_t* extAccMode, uint8_t* extGyroMode, vec3f* gyroLimit)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	*magMode = ATOU8; NEXT
 	*extMagMode = ATOU8; NEXT
@@ -3543,7 +3705,7 @@ void Packet::parseFilterBasicControl(uint8_t* magMode, uint8_t* extMagMode, uint
 	gyroLimit->z = ATOFF;
 }
 
-void Packet::parseHeaveConfiguration(	
+void PacketView::parseHeaveConfiguration(	
 	float* initialWavePeriod, 
 	float* initialWaveAmplitude, 
 	float* maxWavePeriod,
@@ -3554,7 +3716,7 @@ void Packet::parseHeaveConfiguration(
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	*initialWavePeriod = ATOFF; NEXT
 	*initialWaveAmplitude = ATOFF; NEXT
@@ -3565,11 +3727,11 @@ void Packet::parseHeaveConfiguration(
 	*heaveRateCutoffFreq = ATOFF; 
 }
 
-void Packet::parseVpeBasicControl(uint8_t* enable, uint8_t* headingMode, uint8_t* filteringMode, uint8_t* tuningMode)
+void PacketView::parseVpeBasicControl(uint8_t* enable, uint8_t* headingMode, uint8_t* filteringMode, uint8_t* tuningMode)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	*enable = ATOU8; NEXT
 	*headingMode = ATOU8; NEXT
@@ -3577,11 +3739,11 @@ void Packet::parseVpeBasicControl(uint8_t* enable, uint8_t* headingMode, uint8_t
 	*tuningMode = ATOU8;
 }
 
-void Packet::parseVpeMagnetometerBasicTuning(vec3f* baseTuning, vec3f* adaptiveTuning, vec3f* adaptiveFiltering)
+void PacketView::parseVpeMagnetometerBasicTuning(vec3f* baseTuning, vec3f* adaptiveTuning, vec3f* adaptiveFiltering)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	baseTuning->x = ATOFF; NEXT
 	baseTuning->y = ATOFF; NEXT
@@ -3594,11 +3756,11 @@ void Packet::parseVpeMagnetometerBasicTuning(vec3f* baseTuning, vec3f* adaptiveT
 	adaptiveFiltering->z = ATOFF;
 }
 
-void Packet::parseVpeMagnetometerAdvancedTuning(vec3f* minFiltering, vec3f* maxFiltering, float* maxAdaptRate, float* disturbanceWindow, float* maxTuning)
+void PacketView::parseVpeMagnetometerAdvancedTuning(vec3f* minFiltering, vec3f* maxFiltering, float* maxAdaptRate, float* disturbanceWindow, float* maxTuning)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	minFiltering->x = ATOFF; NEXT
 	minFiltering->y = ATOFF; NEXT
@@ -3611,11 +3773,11 @@ void Packet::parseVpeMagnetometerAdvancedTuning(vec3f* minFiltering, vec3f* maxF
 	*maxTuning = ATOFF;
 }
 
-void Packet::parseVpeAccelerometerBasicTuning(vec3f* baseTuning, vec3f* adaptiveTuning, vec3f* adaptiveFiltering)
+void PacketView::parseVpeAccelerometerBasicTuning(vec3f* baseTuning, vec3f* adaptiveTuning, vec3f* adaptiveFiltering)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	baseTuning->x = ATOFF; NEXT
 	baseTuning->y = ATOFF; NEXT
@@ -3628,11 +3790,11 @@ void Packet::parseVpeAccelerometerBasicTuning(vec3f* baseTuning, vec3f* adaptive
 	adaptiveFiltering->z = ATOFF;
 }
 
-void Packet::parseVpeAccelerometerAdvancedTuning(vec3f* minFiltering, vec3f* maxFiltering, float* maxAdaptRate, float* disturbanceWindow, float* maxTuning)
+void PacketView::parseVpeAccelerometerAdvancedTuning(vec3f* minFiltering, vec3f* maxFiltering, float* maxAdaptRate, float* disturbanceWindow, float* maxTuning)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	minFiltering->x = ATOFF; NEXT
 	minFiltering->y = ATOFF; NEXT
@@ -3645,11 +3807,11 @@ void Packet::parseVpeAccelerometerAdvancedTuning(vec3f* minFiltering, vec3f* max
 	*maxTuning = ATOFF;
 }
 
-void Packet::parseVpeGyroBasicTuning(vec3f* angularWalkVariance, vec3f* baseTuning, vec3f* adaptiveTuning)
+void PacketView::parseVpeGyroBasicTuning(vec3f* angularWalkVariance, vec3f* baseTuning, vec3f* adaptiveTuning)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	angularWalkVariance->x = ATOFF; NEXT
 	angularWalkVariance->y = ATOFF; NEXT
@@ -3662,33 +3824,33 @@ void Packet::parseVpeGyroBasicTuning(vec3f* angularWalkVariance, vec3f* baseTuni
 	adaptiveTuning->z = ATOFF;
 }
 
-void Packet::parseFilterStartupGyroBias(vec3f* bias)
+void PacketView::parseFilterStartupGyroBias(vec3f* bias)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	bias->x = ATOFF; NEXT
 	bias->y = ATOFF; NEXT
 	bias->z = ATOFF;
 }
 
-void Packet::parseMagnetometerCalibrationControl(uint8_t* hsiMode, uint8_t* hsiOutput, uint8_t* convergeRate)
+void PacketView::parseMagnetometerCalibrationControl(uint8_t* hsiMode, uint8_t* hsiOutput, uint8_t* convergeRate)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	*hsiMode = ATOU8; NEXT
 	*hsiOutput = ATOU8; NEXT
 	*convergeRate = ATOU8;
 }
 
-void Packet::parseCalculatedMagnetometerCalibration(mat3f* c, vec3f* b)
+void PacketView::parseCalculatedMagnetometerCalibration(mat3f* c, vec3f* b)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	c->e00 = ATOFF; NEXT
 	c->e01 = ATOFF; NEXT
@@ -3704,42 +3866,42 @@ void Packet::parseCalculatedMagnetometerCalibration(mat3f* c, vec3f* b)
 	b->z = ATOFF;
 }
 
-void Packet::parseIndoorHeadingModeControl(float* maxRateError)
+void PacketView::parseIndoorHeadingModeControl(float* maxRateError)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	*maxRateError = ATOFF; NEXT
 }
 
-void Packet::parseVelocityCompensationMeasurement(vec3f* velocity)
+void PacketView::parseVelocityCompensationMeasurement(vec3f* velocity)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	velocity->x = ATOFF; NEXT
 	velocity->y = ATOFF; NEXT
 	velocity->z = ATOFF;
 }
 
-void Packet::parseVelocityCompensationControl(uint8_t* mode, float* velocityTuning, float* rateTuning)
+void PacketView::parseVelocityCompensationControl(uint8_t* mode, float* velocityTuning, float* rateTuning)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	*mode = ATOU8; NEXT
 	*velocityTuning = ATOFF; NEXT
 	*rateTuning = ATOFF;
 }
 
-void Packet::parseVelocityCompensationStatus(float* x, float* xDot, vec3f* accelOffset, vec3f* omega)
+void PacketView::parseVelocityCompensationStatus(float* x, float* xDot, vec3f* accelOffset, vec3f* omega)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	*x = ATOFF; NEXT
 	*xDot = ATOFF; NEXT
@@ -3751,11 +3913,11 @@ void Packet::parseVelocityCompensationStatus(float* x, float* xDot, vec3f* accel
 	omega->z = ATOFF;
 }
 
-void Packet::parseImuMeasurements(vec3f* mag, vec3f* accel, vec3f* gyro, float* temp, float* pressure)
+void PacketView::parseImuMeasurements(vec3f* mag, vec3f* accel, vec3f* gyro, float* temp, float* pressure)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	mag->x = ATOFF; NEXT
 	mag->y = ATOFF; NEXT
@@ -3770,11 +3932,11 @@ void Packet::parseImuMeasurements(vec3f* mag, vec3f* accel, vec3f* gyro, float*
 	*pressure = ATOFF;
 }
 
-void Packet::parseGpsConfiguration(uint8_t* mode, uint8_t* ppsSource)
+void PacketView::parseGpsConfiguration(uint8_t* mode, uint8_t* ppsSource)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	*mode = ATOU8; NEXT
 	*ppsSource = ATOU8; NEXT
@@ -3782,11 +3944,11 @@ void Packet::parseGpsConfiguration(uint8_t* mode, uint8_t* ppsSource)
 	NEXT
 }
 
-void Packet::parseGpsConfiguration(uint8_t* mode, uint8_t* ppsSource, uint8_t* rate, uint8_t* antPow)
+void PacketView::parseGpsConfiguration(uint8_t* mode, uint8_t* ppsSource, uint8_t* rate, uint8_t* antPow)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	*mode = ATOU8; NEXT
 	*ppsSource = ATOU8; NEXT
@@ -3795,22 +3957,22 @@ void Packet::parseGpsConfiguration(uint8_t* mode, uint8_t* ppsSource, uint8_t* r
 	*antPow = ATOU8; 
 }
 
-void Packet::parseGpsAntennaOffset(vec3f* position)
+void PacketView::parseGpsAntennaOffset(vec3f* position)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	position->x = ATOFF; NEXT
 	position->y = ATOFF; NEXT
 	position->z = ATOFF;
 }
 
-void Packet::parseGpsSolutionLla(double* time, uint16_t* week, uint8_t* gpsFix, uint8_t* numSats, vec3d* lla, vec3f* nedVel, vec3f* nedAcc, float* speedAcc, float* timeAcc)
+void PacketView::parseGpsSolutionLla(double* time, uint16_t* week, uint8_t* gpsFix, uint8_t* numSats, vec3d* lla, vec3f* nedVel, vec3f* nedAcc, float* speedAcc, float* timeAcc)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	*time = ATOFD; NEXT
 	*week = ATOU16; NEXT
@@ -3829,11 +3991,11 @@ void Packet::parseGpsSolutionLla(double* time, uint16_t* week, uint8_t* gpsFix,
 	*timeAcc = ATOFF;
 }
 
-void Packet::parseGpsSolutionEcef(double* tow, uint16_t* week, uint8_t* gpsFix, uint8_t* numSats, vec3d* position, vec3f* velocity, vec3f* posAcc, float* speedAcc, float* timeAcc)
+void PacketView::parseGpsSolutionEcef(double* tow, uint16_t* week, uint8_t* gpsFix, uint8_t* numSats, vec3d* position, vec3f* velocity, vec3f* posAcc, float* speedAcc, float* timeAcc)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	*tow = ATOFD; NEXT
 	*week = ATOU16; NEXT
@@ -3852,11 +4014,11 @@ void Packet::parseGpsSolutionEcef(double* tow, uint16_t* week, uint8_t* gpsFix,
 	*timeAcc = ATOFF;
 }
 
-void Packet::parseInsSolutionLla(double* time, uint16_t* week, uint16_t* status, vec3f* yawPitchRoll, vec3d* position, vec3f* nedVel, float* attUncertainty, float* posUncertainty, float* velUncertainty)
+void PacketView::parseInsSolutionLla(double* time, uint16_t* week, uint16_t* status, vec3f* yawPitchRoll, vec3d* position, vec3f* nedVel, float* attUncertainty, float* posUncertainty, float* velUncertainty)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	*time = ATOFD; NEXT
 	*week = ATOU16; NEXT
@@ -3875,11 +4037,11 @@ void Packet::parseInsSolutionLla(double* time, uint16_t* week, uint16_t* status,
 	*velUncertainty = ATOFF;
 }
 
-void Packet::parseInsSolutionEcef(double* time, uint16_t* week, uint16_t* status, vec3f* yawPitchRoll, vec3d* position, vec3f* velocity, float* attUncertainty, float* posUncertainty, float* velUncertainty)
+void PacketView::parseInsSolutionEcef(double* time, uint16_t* week, uint16_t* status, vec3f* yawPitchRoll, vec3d* position, vec3f* velocity, float* attUncertainty, float* posUncertainty, float* velUncertainty)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	*time = ATOFD; NEXT
 	*week = ATOU16; NEXT
@@ -3898,33 +4060,33 @@ void Packet::parseInsSolutionEcef(double* time, uint16_t* week, uint16_t* status
 	*velUncertainty = ATOFF;
 }
 
-void Packet::parseInsBasicConfiguration(uint8_t* scenario, uint8_t* ahrsAiding)
+void PacketView::parseInsBasicConfiguration(uint8_t* scenario, uint8_t* ahrsAiding)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	*scenario = ATOU8; NEXT
 	*ahrsAiding = ATOU8; NEXT
 	NEXT
 }
 
-void Packet::parseInsBasicConfiguration(uint8_t* scenario, uint8_t* ahrsAiding, uint8_t* estBaseline)
+void PacketView::parseInsBasicConfiguration(uint8_t* scenario, uint8_t* ahrsAiding, uint8_t* estBaseline)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	*scenario = ATOU8; NEXT
 	*ahrsAiding = ATOU8; NEXT
 	*estBaseline = ATOU8; NEXT
 }
 
-void Packet::parseInsAdvancedConfiguration(uint8_t* useMag, uint8_t* usePres, uint8_t* posAtt, uint8_t* velAtt, uint8_t* velBias, uint8_t* useFoam, uint8_t* gpsCovType, uint8_t* velCount, float* velInit, float* moveOrigin, float* gpsTimeout, float* deltaLimitPos, float* deltaLimitVel, float* minPosUncertainty, float* minVelUncertainty)
+void PacketView::parseInsAdvancedConfiguration(uint8_t* useMag, uint8_t* usePres, uint8_t* posAtt, uint8_t* velAtt, uint8_t* velBias, uint8_t* useFoam, uint8_t* gpsCovType, uint8_t* velCount, float* velInit, float* moveOrigin, float* gpsTimeout, float* deltaLimitPos, float* deltaLimitVel, float* minPosUncertainty, float* minVelUncertainty)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	*useMag = ATOU8; NEXT
 	*usePres = ATOU8; NEXT
@@ -3943,11 +4105,11 @@ void Packet::parseInsAdvancedConfiguration(uint8_t* useMag, uint8_t* usePres, ui
 	*minVelUncertainty = ATOFF;
 }
 
-void Packet::parseInsStateLla(vec3f* yawPitchRoll, vec3d* position, vec3f* velocity, vec3f* accel, vec3f* angularRate)
+void PacketView::parseInsStateLla(vec3f* yawPitchRoll, vec3d* position, vec3f* velocity, vec3f* accel, vec3f* angularRate)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	yawPitchRoll->x = ATOFF; NEXT
 	yawPitchRoll->y = ATOFF; NEXT
@@ -3966,11 +4128,11 @@ void Packet::parseInsStateLla(vec3f* yawPitchRoll, vec3d* position, vec3f* veloc
 	angularRate->z = ATOFF;
 }
 
-void Packet::parseInsStateEcef(vec3f* yawPitchRoll, vec3d* position, vec3f* velocity, vec3f* accel, vec3f* angularRate)
+void PacketView::parseInsStateEcef(vec3f* yawPitchRoll, vec3d* position, vec3f* velocity, vec3f* accel, vec3f* angularRate)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	yawPitchRoll->x = ATOFF; NEXT
 	yawPitchRoll->y = ATOFF; NEXT
@@ -3989,11 +4151,11 @@ void Packet::parseInsStateEcef(vec3f* yawPitchRoll, vec3d* position, vec3f* velo
 	angularRate->z = ATOFF;
 }
 
-void Packet::parseStartupFilterBiasEstimate(vec3f* gyroBias, vec3f* accelBias, float* pressureBias)
+void PacketView::parseStartupFilterBiasEstimate(vec3f* gyroBias, vec3f* accelBias, float* pressureBias)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	gyroBias->x = ATOFF; NEXT
 	gyroBias->y = ATOFF; NEXT
@@ -4004,11 +4166,11 @@ void Packet::parseStartupFilterBiasEstimate(vec3f* gyroBias, vec3f* accelBias, f
 	*pressureBias = ATOFF;
 }
 
-void Packet::parseDeltaThetaAndDeltaVelocity(float* deltaTime, vec3f* deltaTheta, vec3f* deltaVelocity)
+void PacketView::parseDeltaThetaAndDeltaVelocity(float* deltaTime, vec3f* deltaTheta, vec3f* deltaVelocity)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	*deltaTime = ATOFF; NEXT
 	deltaTheta->x = ATOFF; NEXT
@@ -4019,17 +4181,17 @@ void Packet::parseDeltaThetaAndDeltaVelocity(float* deltaTime, vec3f* deltaTheta
 	deltaVelocity->z = ATOFF;
 }
 
-void Packet::parseDeltaThetaAndDeltaVelocityConfiguration(uint8_t* integrationFrame, uint8_t* gyroCompensation, uint8_t* accelCompensation)
+void PacketView::parseDeltaThetaAndDeltaVelocityConfiguration(uint8_t* integrationFrame, uint8_t* gyroCompensation, uint8_t* accelCompensation)
 {
 	uint8_t earthRateCorrection;
 	parseDeltaThetaAndDeltaVelocityConfiguration(integrationFrame, gyroCompensation, accelCompensation, &earthRateCorrection);
 }
 
-void Packet::parseDeltaThetaAndDeltaVelocityConfiguration(uint8_t* integrationFrame, uint8_t* gyroCompensation, uint8_t* accelCompensation, uint8_t* earthRateCorrection)
+void PacketView::parseDeltaThetaAndDeltaVelocityConfiguration(uint8_t* integrationFrame, uint8_t* gyroCompensation, uint8_t* accelCompensation, uint8_t* earthRateCorrection)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	*integrationFrame = ATOU8; NEXT
 	*gyroCompensation = ATOU8; NEXT
@@ -4037,11 +4199,11 @@ void Packet::parseDeltaThetaAndDeltaVelocityConfiguration(uint8_t* integrationFr
 	*earthRateCorrection = ATOU8; NEXT
 }
 
-void Packet::parseReferenceVectorConfiguration(uint8_t* useMagModel, uint8_t* useGravityModel, uint32_t* recalcThreshold, float* year, vec3d* position)
+void PacketView::parseReferenceVectorConfiguration(uint8_t* useMagModel, uint8_t* useGravityModel, uint32_t* recalcThreshold, float* year, vec3d* position)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	*useMagModel = ATOU8; NEXT
 	*useGravityModel = ATOU8; NEXT
@@ -4054,11 +4216,11 @@ void Packet::parseReferenceVectorConfiguration(uint8_t* useMagModel, uint8_t* us
 	position->z = ATOFD;
 }
 
-void Packet::parseGyroCompensation(mat3f* c, vec3f* b)
+void PacketView::parseGyroCompensation(mat3f* c, vec3f* b)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	c->e00 = ATOFF; NEXT
 	c->e01 = ATOFF; NEXT
@@ -4074,11 +4236,11 @@ void Packet::parseGyroCompensation(mat3f* c, vec3f* b)
 	b->z = ATOFF;
 }
 
-void Packet::parseImuFilteringConfiguration(uint16_t* magWindowSize, uint16_t* accelWindowSize, uint16_t* gyroWindowSize, uint16_t* tempWindowSize, uint16_t* presWindowSize, uint8_t* magFilterMode, uint8_t* accelFilterMode, uint8_t* gyroFilterMode, uint8_t* tempFilterMode, uint8_t* presFilterMode)
+void PacketView::parseImuFilteringConfiguration(uint16_t* magWindowSize, uint16_t* accelWindowSize, uint16_t* gyroWindowSize, uint16_t* tempWindowSize, uint16_t* presWindowSize, uint8_t* magFilterMode, uint8_t* accelFilterMode, uint8_t* gyroFilterMode, uint8_t* tempFilterMode, uint8_t* presFilterMode)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	*magWindowSize = ATOU16; NEXT
 	*accelWindowSize = ATOU16; NEXT
@@ -4092,11 +4254,11 @@ void Packet::parseImuFilteringConfiguration(uint16_t* magWindowSize, uint16_t* a
 	*presFilterMode = ATOU8;
 }
 
-void Packet::parseGpsCompassBaseline(vec3f* position, vec3f* uncertainty)
+void PacketView::parseGpsCompassBaseline(vec3f* position, vec3f* uncertainty)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	position->x = ATOFF; NEXT
 	position->y = ATOFF; NEXT
@@ -4106,11 +4268,11 @@ void Packet::parseGpsCompassBaseline(vec3f* position, vec3f* uncertainty)
 	uncertainty->z = ATOFF;
 }
 
-void Packet::parseGpsCompassEstimatedBaseline(uint8_t* estBaselineUsed, uint16_t* numMeas, vec3f* position, vec3f* uncertainty)
+void PacketView::parseGpsCompassEstimatedBaseline(uint8_t* estBaselineUsed, uint16_t* numMeas, vec3f* position, vec3f* uncertainty)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	*estBaselineUsed = ATOU8; NEXT
 	NEXT
@@ -4123,11 +4285,11 @@ void Packet::parseGpsCompassEstimatedBaseline(uint8_t* estBaselineUsed, uint16_t
 	uncertainty->z = ATOFF;
 }
 
-void Packet::parseImuRateConfiguration(uint16_t* imuRate, uint16_t* navDivisor, float* filterTargetRate, float* filterMinRate)
+void PacketView::parseImuRateConfiguration(uint16_t* imuRate, uint16_t* navDivisor, float* filterTargetRate, float* filterMinRate)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	*imuRate = ATOU16; NEXT
 	*navDivisor = ATOU16; NEXT
@@ -4135,11 +4297,11 @@ void Packet::parseImuRateConfiguration(uint16_t* imuRate, uint16_t* navDivisor,
 	*filterMinRate = ATOFF;
 }
 
-void Packet::parseYawPitchRollTrueBodyAccelerationAndAngularRates(vec3f* yawPitchRoll, vec3f* bodyAccel, vec3f* gyro)
+void PacketView::parseYawPitchRollTrueBodyAccelerationAndAngularRates(vec3f* yawPitchRoll, vec3f* bodyAccel, vec3f* gyro)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	yawPitchRoll->x = ATOFF; NEXT
 	yawPitchRoll->y = ATOFF; NEXT
@@ -4152,11 +4314,11 @@ void Packet::parseYawPitchRollTrueBodyAccelerationAndAngularRates(vec3f* yawPitc
 	gyro->z = ATOFF;
 }
 
-void Packet::parseYawPitchRollTrueInertialAccelerationAndAngularRates(vec3f* yawPitchRoll, vec3f* inertialAccel, vec3f* gyro)
+void PacketView::parseYawPitchRollTrueInertialAccelerationAndAngularRates(vec3f* yawPitchRoll, vec3f* inertialAccel, vec3f* gyro)
 {
 	size_t parseIndex;
 
-	char *result = startAsciiPacketParse(_data, parseIndex); NEXT
+	const char* result = startAsciiPacketParse(_data, parseIndex); NEXT
 
 	yawPitchRoll->x = ATOFF; NEXT
 	yawPitchRoll->y = ATOFF; NEXT
@@ -0,0 +1,182 @@
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "vn/packet.h"
+#include "vn/error_detection.h"
+
+#include "allocations.test.h"
+
+using namespace std;
+using namespace vn::math;
+using namespace vn::protocol::uart;
+using namespace vn::data::integrity;
+
+namespace {
+
+string asciiPacket(const string& body)
+{
+	char checksum[8];
+	sprintf(checksum, "*%02X\r\n", Checksum8::compute(body.c_str(), body.size()));
+
+	return "$" + body + checksum;
+}
+
+// Builds a VNINS message with the provided time, week, status and yaw
+// fields.
+string insPacket(const string& time, const string& week, const string& status, const string& yaw)
+{
+	return asciiPacket("VNINS," + time + "," + week + "," + status + "," + yaw
+		+ ",+001.500,-002.250,+37.12345678,-122.12345678,+00012.345,+000.100,-000.200,+000.300,+01.0,+002.5,+0.05");
+}
+
+struct InsMessage
+{
+	double time;
+	uint16_t week;
+	uint16_t status;
+	vec3f yawPitchRoll;
+	vec3d lla;
+	vec3f nedVel;
+	float attUncertainty;
+	float posUncertainty;
+	float velUncertainty;
+
+	explicit InsMessage(string packet)
+	{
+		PacketView p(&packet[0], packet.size());
+		p.parseVNINS(&time, &week, &status, &yawPitchRoll, &lla, &nedVel, &attUncertainty, &posUncertainty, &velUncertainty);
+	}
+};
+
+}
+
+TEST(PacketView, AsciiParsingLeavesTheReceiveBufferUnchanged)
+{
+	string received =
+		"$VNYMR,+010.500,-002.250,+179.000,+00.1000,-00.2000,+00.3000,-00.010,+00.020,-09.810,+0.001000,-0.002000,+0.003000*55\r\n"
+		"$VNRRG,01,VN-100T-CR*32\r\n";
+	string original = received;
+
+	size_t ymrLength = received.find('\n') + 1;
+
+	PacketView ymr(&received[0], ymrLength);
+	vec3f yawPitchRoll, magnetic, acceleration, angularRate;
+	ymr.parseVNYMR(&yawPitchRoll, &magnetic, &acceleration, &angularRate);
+
+	EXPECT_FLOAT_EQ(10.5f, yawPitchRoll.x);
+	EXPECT_FLOAT_EQ(-2.25f, yawPitchRoll.y);
+	EXPECT_FLOAT_EQ(179.0f, yawPitchRoll.z);
+	EXPECT_FLOAT_EQ(0.003f, angularRate.z);
+
+	PacketView modelNumber(&received[ymrLength], received.size() - ymrLength);
+	char productName[32];
+	modelNumber.parseModelNumber(productName);
+
+	EXPECT_STREQ("VN-100T-CR", productName);
+
+	// Parsing through the views must not have touched the data, which other
+	// views of the same buffer still refer to.
+	EXPECT_EQ(original, received);
+}
+
+TEST(Packet, RetainsTheLargestExpectedPacketWithoutAllocating)
+{
+	const size_t Largest = Packet::MaximumInlineDataSize;
+
+	// Views refer to the received data, so only owning packets carry the
+	// inline storage.
+	EXPECT_LT(sizeof(PacketView), Largest);
+	EXPECT_GE(sizeof(Packet), sizeof(PacketView) + Largest);
+
+	string received(Largest, '\x55');
+	received[0] = '\xFA';
+
+	PacketView view(&received[0], received.size());
+
+	size_t allocationsBefore = numOfAllocations();
+
+	Packet retained(view);
+	Packet copy(retained);
+
+	EXPECT_EQ(allocationsBefore, numOfAllocations());
+
+	received.assign(received.size(), '\0');
+
+	EXPECT_EQ(Largest, copy.length());
+	EXPECT_EQ('\xFA', copy.data()[0]);
+	EXPECT_EQ('\x55', copy.data()[Largest - 1]);
+}
+
+TEST(PacketView, ParsesAsciiRealsLikeStrtod)
+{
+	// Fields in the formats the sensor outputs, and the forms which are
+	// left to the C library.
+	const char* fields[] = {
+		"+010.500", "-002.250", "+179.999", "-00.0000", "+0.001000", "342151.750000",
+		"+37.12345678", "-122.12345678", "+00012.345", "+1.0000E-05", "-4.6341e+02",
+		"0", "7", ".5", "5.", "1e3", "1E+3", "-1.5e-3", "+", "-", "1e", "1e+",
+		"", "0x1A", "12345678901234567890.5", "0.000000000000000000000000123", "1e300"
+	};
+
+	for (size_t i = 0; i < sizeof(fields) / sizeof(fields[0]); i++)
+	{
+		SCOPED_TRACE(fields[i]);
+
+		InsMessage m(insPacket(fields[i], "2045", "0DBF", fields[i]));
+
+		EXPECT_EQ(strtod(fields[i], NULL), m.time);
+		EXPECT_EQ(static_cast<float>(strtod(fields[i], NULL)), m.yawPitchRoll.x);
+		EXPECT_FLOAT_EQ(1.5f, m.yawPitchRoll.y);
+	}
+}
+
+TEST(PacketView, ParsesAsciiIntegersLikeStrtol)
+{
+	const char* fields[] = {
+		"2045", "0", "+5", "-12", "007", "115200", "65535", "", "+", "-",
+		"12a", "1234567890", "99999999999"
+	};
+
+	for (size_t i = 0; i < sizeof(fields) / sizeof(fields[0]); i++)
+	{
+		SCOPED_TRACE(fields[i]);
+
+		InsMessage m(insPacket("342151.750000", fields[i], "0DBF", "+010.500"));
+		EXPECT_EQ(static_cast<uint16_t>(strtol(fields[i], NULL, 10)), m.week);
+
+		string packet = asciiPacket(string("VNRRG,03,") + fields[i]);
+		PacketView p(&packet[0], packet.size());
+		uint32_t serialNumber;
+		p.parseSerialNumber(&serialNumber);
+
+		// Values outside the range of an int differ between strtol and
+		// atoi, which the parser matches.
+		if (strlen(fields[i]) < 10)
+			EXPECT_EQ(static_cast<uint32_t>(strtol(fields[i], NULL, 10)), serialNumber);
+		else
+			EXPECT_EQ(static_cast<uint32_t>(atoi(fields[i])), serialNumber);
+	}
+}
+
+TEST(PacketView, ParsesAsciiHexLikeStrtoul)
+{
+	const char* fields[] = {
+		"0DBF", "0000", "FFFF", "ffff", "aB12", "7", "", "0x1F", "12G4",
+		"1A2B3C4D5"
+	};
+
+	for (size_t i = 0; i < sizeof(fields) / sizeof(fields[0]); i++)
+	{
+		SCOPED_TRACE(fields[i]);
+
+		InsMessage m(insPacket("342151.750000", "2045", fields[i], "+010.500"));
+
+		EXPECT_EQ(static_cast<uint16_t>(strtoul(fields[i], NULL, 16)), m.status);
+		EXPECT_EQ(2045, m.week);
+		EXPECT_FLOAT_EQ(10.5f, m.yawPitchRoll.x);
+	}
+}
@@ -0,0 +1,102 @@
+#include "hayai.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "vn/packetfinder.h"
+#include "vn/error_detection.h"
+
+using namespace std;
+using namespace vn::protocol::uart;
+using namespace vn::data::integrity;
+
+namespace {
+
+const size_t DataSize = 1024 * 1024;
+
+void ignorePacket(void*, PacketView&, size_t, vn::xplat::TimeStamp)
+{
+}
+
+// Line noise without any byte which could start a packet.
+string noise()
+{
+	string data(DataSize, '\0');
+
+	srand(1);
+	for (size_t i = 0; i < data.size(); i++)
+	{
+		char c;
+		do
+		{
+			c = static_cast<char>(rand());
+		} while (c == '\xFA' || c == '$');
+
+		data[i] = c;
+	}
+
+	return data;
+}
+
+// A stream of binary packets with the first eleven Common group fields, as a
+// sensor sends them.
+string replay()
+{
+	string data;
+
+	srand(1);
+	while (data.size() + 162 <= DataSize)
+	{
+		string p;
+		p += '\xFA';
+		p += '\x01';
+		p += '\xFF';
+		p += '\x07';
+
+		while (p.size() < 160)
+			p += static_cast<char>(rand());
+
+		uint16_t crc = Crc16::compute(p.data() + 1, p.size() - 1);
+		p += static_cast<char>(crc >> 8);
+		p += static_cast<char>(crc & 0xFF);
+
+		data += p;
+	}
+
+	return data;
+}
+
+class PacketFinderFixture : public ::hayai::Fixture
+{
+public:
+
+	virtual void SetUp()
+	{
+		finder = new PacketFinder();
+		finder->registerPossiblePacketFoundHandler(NULL, ignorePacket);
+	}
+
+	virtual void TearDown()
+	{
+		delete finder;
+	}
+
+	PacketFinder* finder;
+};
+
+string NoiseData = noise();
+string ReplayData = replay();
+
+}
+
+BENCHMARK_F(PacketFinderFixture, NoiseMegabyte, 10, 10)
+{
+	finder->processReceivedData(&NoiseData[0], NoiseData.size());
+}
+
+BENCHMARK_F(PacketFinderFixture, ReplayMegabyte, 10, 10)
+{
+	finder->processReceivedData(&ReplayData[0], ReplayData.size());
+}
@@ -1,10 +1,21 @@
 #include "vn/packetfinder.h"
 #include "vn/utilities.h"
 #include "vn/error_detection.h"
+#include "vn/compiler.h"
+#include "vn/ringbuffer.h"
 
-#include <queue>
-#include <list>
 #include <cstring>
+#include <vector>
+
+#if VN_HAVE_AVX2
+	#include <immintrin.h>
+#elif VN_HAVE_SSE2
+	#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER) && (VN_HAVE_SSE2 || VN_HAVE_AVX2)
+	#include <intrin.h>
+#endif
 
 #if PYTHON
 	#include "boostpython.h"
@@ -21,36 +32,208 @@ namespace uart {
 
 //char* vnstrtok(char* str, size_t& startIndex);
 
+namespace {
+
+#if VN_HAVE_SSE2 || VN_HAVE_AVX2
+
+// Returns the index of the lowest set bit in a non-zero comparison mask.
+size_t lowestSetBit(uint32_t mask)
+{
+	#if defined(_MSC_VER)
+	unsigned long index;
+	_BitScanForward(&index, mask);
+	return index;
+	#else
+	return __builtin_ctz(mask);
+	#endif
+}
+
+#endif
+
+// Scans from index for the next byte that could start a packet, which
+// includes the bootloader's version string when bootloaderFilter is set.
+// Returns length if none remain in the data.
+size_t findNextPossiblePacketStart(const uint8_t* data, size_t index, size_t length, bool bootloaderFilter)
+{
+	const uint8_t binaryStart = 0xFA;
+	const uint8_t asciiStart = '$';
+	// Searching for '$' twice is cheaper than branching on the filter below.
+	const uint8_t bootloaderStart = bootloaderFilter ? 'V' : '$';
+
+	#if VN_HAVE_AVX2
+
+	const __m256i wideBinaryStart = _mm256_set1_epi8(static_cast<char>(binaryStart));
+	const __m256i wideAsciiStart = _mm256_set1_epi8(static_cast<char>(asciiStart));
+	const __m256i wideBootloaderStart = _mm256_set1_epi8(static_cast<char>(bootloaderStart));
+
+	for (; index + 32 <= length; index += 32)
+	{
+		__m256i chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + index));
+		__m256i matches = _mm256_or_si256(
+			_mm256_or_si256(_mm256_cmpeq_epi8(chunk, wideBinaryStart), _mm256_cmpeq_epi8(chunk, wideAsciiStart)),
+			_mm256_cmpeq_epi8(chunk, wideBootloaderStart));
+		uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(matches));
+
+		if (mask != 0)
+			return index + lowestSetBit(mask);
+	}
+
+	#endif
+
+	#if VN_HAVE_SSE2
+
+	const __m128i packedBinaryStart = _mm_set1_epi8(static_cast<char>(binaryStart));
+	const __m128i packedAsciiStart = _mm_set1_epi8(static_cast<char>(asciiStart));
+	const __m128i packedBootloaderStart = _mm_set1_epi8(static_cast<char>(bootloaderStart));
+
+	for (; index + 16 <= length; index += 16)
+	{
+		__m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index));
+		__m128i matches = _mm_or_si128(
+			_mm_or_si128(_mm_cmpeq_epi8(chunk, packedBinaryStart), _mm_cmpeq_epi8(chunk, packedAsciiStart)),
+			_mm_cmpeq_epi8(chunk, packedBootloaderStart));
+		uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(matches));
+
+		if (mask != 0)
+			return index + lowestSetBit(mask);
+	}
+
+	#endif
+
+	for (; index < length; index++)
+	{
+		uint8_t c = data[index];
+
+		if (c == binaryStart || c == asciiStart || c == bootloaderStart)
+			return index;
+	}
+
+	return length;
+}
+
+}
+
+struct PacketBatch::Impl
+{
+	// Only packets which started in an earlier call are copied. At most one
+	// ASCII and one binary packet can be carried over from an earlier call,
+	// so this holds both at their largest with room to spare.
+	static const size_t StorageSize = 2048;
+
+	struct Entry
+	{
+		PacketView packet;
+		size_t runningIndexOfPacketStart;
+		TimeStamp timestamp;
+
+		Entry(const PacketView& packet_, size_t runningIndexOfPacketStart_, TimeStamp timestamp_) :
+			packet(packet_),
+			runningIndexOfPacketStart(runningIndexOfPacketStart_),
+			timestamp(timestamp_)
+		{ }
+	};
+
+	vector<Entry> entries;
+	char storage[StorageSize];
+	size_t storageUsed;
+
+	Impl() :
+		storageUsed(0)
+	{ }
+};
+
+PacketBatch::PacketBatch() :
+	_pi(new Impl())
+{
+}
+
+PacketBatch::~PacketBatch()
+{
+	delete _pi;
+}
+
+size_t PacketBatch::size() const
+{
+	return _pi->entries.size();
+}
+
+bool PacketBatch::empty() const
+{
+	return _pi->entries.empty();
+}
+
+void PacketBatch::clear()
+{
+	_pi->entries.clear();
+	_pi->storageUsed = 0;
+}
+
+PacketView& PacketBatch::packet(size_t index)
+{
+	return _pi->entries.at(index).packet;
+}
+
+size_t PacketBatch::runningIndexOfPacketStart(size_t index) const
+{
+	return _pi->entries.at(index).runningIndexOfPacketStart;
+}
+
+TimeStamp PacketBatch::timestamp(size_t index) const
+{
+	return _pi->entries.at(index).timestamp;
+}
+
+char* PacketBatch::reserveStorage(size_t length)
+{
+	if (length > Impl::StorageSize - _pi->storageUsed)
+		return NULL;
+
+	char* reserved = _pi->storage + _pi->storageUsed;
+	_pi->storageUsed += length;
+
+	return reserved;
+}
+
+void PacketBatch::releaseStorage(size_t length)
+{
+	_pi->storageUsed -= length;
+}
+
+void PacketBatch::add(const PacketView& packet, size_t runningIndexOfPacketStart, TimeStamp timestamp)
+{
+	_pi->entries.push_back(Impl::Entry(packet, runningIndexOfPacketStart, timestamp));
+}
+
 struct BinaryTracker
 {
-	size_t possibleStartIndex;
 	bool groupsPresentFound;
 	uint8_t groupsPresent;
 	uint8_t numOfBytesRemainingToHaveAllGroupFields;
 	size_t numOfBytesRemainingForCompletePacket;
-	bool startFoundInProvidedDataBuffer;
 	size_t runningDataIndexOfStart;
 	vn::xplat::TimeStamp timeFound;
-	explicit BinaryTracker(size_t possibleStartIndex, size_t runningDataIndex, TimeStamp timeFound_) :
-		possibleStartIndex(possibleStartIndex),
+	bool markedInvalid;
+
+	BinaryTracker() :
 		groupsPresentFound(false),
+		groupsPresent(0),
 		numOfBytesRemainingToHaveAllGroupFields(0),
 		numOfBytesRemainingForCompletePacket(0),
-		startFoundInProvidedDataBuffer(true),
-		runningDataIndexOfStart(runningDataIndex),
-		timeFound(timeFound_)
+		runningDataIndexOfStart(0),
+		markedInvalid(false)
 	{ }
-};
 
-bool operator==(const BinaryTracker& lhs, const BinaryTracker& rhs)
-{
-	return
-		lhs.possibleStartIndex == rhs.possibleStartIndex &&
-		lhs.groupsPresentFound == rhs.groupsPresentFound &&
-		lhs.groupsPresent == rhs.groupsPresent &&
-		lhs.numOfBytesRemainingToHaveAllGroupFields == rhs.numOfBytesRemainingToHaveAllGroupFields &&
-		lhs.numOfBytesRemainingForCompletePacket == rhs.numOfBytesRemainingForCompletePacket;
-}
+	void reset(size_t runningDataIndex, TimeStamp timeFound_)
+	{
+		groupsPresentFound = false;
+		groupsPresent = 0;
+		numOfBytesRemainingToHaveAllGroupFields = 0;
+		numOfBytesRemainingForCompletePacket = 0;
+		runningDataIndexOfStart = runningDataIndex;
+		timeFound = timeFound_;
+		markedInvalid = false;
+	}
+};
 
 struct PacketFinder::Impl
 {
@@ -64,17 +247,21 @@ struct PacketFinder::Impl
 	static const size_t MaximumSizeForBinaryStartAndAllGroupData = 18;
 	static const size_t MaximumSizeForAsciiPacket = 256;
 
+	// A possible binary packet is either completed or discarded within this
+	// many bytes of its start, so no more trackers than this can ever be
+	// active at once, even if the payload is full of BinaryStartChar bytes.
+	static const size_t MaximumNumberOfBinaryTrackers = MaximumSizeExpectedForBinaryPacket + MaximumSizeForBinaryStartAndAllGroupData;
+	static const size_t MaximumNumberOfExpectedBinaryOutputs = 3;
+
 	struct AsciiTracker
 	{
 		bool currentlyBuildingAsciiPacket;
-		size_t possibleStartOfPacketIndex;
 		bool asciiEndChar1Found;
 		size_t runningDataIndexOfStart;
 		TimeStamp timeFound;
 
 		AsciiTracker() :
 			currentlyBuildingAsciiPacket(false),
-			possibleStartOfPacketIndex(0),
 			asciiEndChar1Found(false),
 			runningDataIndexOfStart(0)
 		{ }
@@ -82,22 +269,54 @@ struct PacketFinder::Impl
 		void reset()
 		{
 			currentlyBuildingAsciiPacket = false;
-			possibleStartOfPacketIndex = 0;
 			asciiEndChar1Found = false;
 			runningDataIndexOfStart = 0;
 			timeFound = TimeStamp();
 		}
 	};
 
+	struct ExpectedBinaryOutput
+	{
+		bool isRegistered;
+		uint8_t header[MaximumSizeForBinaryStartAndAllGroupData];
+		size_t headerLength;
+		size_t packetLength;
+
+		ExpectedBinaryOutput() :
+			isRegistered(false),
+			headerLength(0),
+			packetLength(0)
+		{ }
+
+		void appendGroupField(uint16_t groupField)
+		{
+			// Group fields are sent little-endian.
+			header[headerLength++] = static_cast<uint8_t>(groupField & 0xFF);
+			header[headerLength++] = static_cast<uint8_t>(groupField >> 8);
+		}
+	};
+
+	// Results of checking a possible binary packet against the expected
+	// binary outputs.
+	enum ExpectedBinaryOutputMatch
+	{
+		EXPECTEDMATCH_NONE,			// Cannot be any of the expected outputs.
+		EXPECTEDMATCH_INCOMPLETE,	// Matches so far but more data is needed.
+		EXPECTEDMATCH_COMPLETE		// Header matches and the whole packet is available.
+	};
+
 	PacketFinder* _backReference;
-	uint8_t* _buffer;
-	const size_t _bufferSize;
-	size_t _bufferAppendLocation;
+	RingBuffer _buffer;					// Holds the start of packets which are split between calls, indexed by running data index.
 	AsciiTracker _asciiOnDeck;
-	list<BinaryTracker> _binaryOnDeck;	// Collection of possible binary packets we are checking.
+	BinaryTracker _binaryOnDeck[MaximumNumberOfBinaryTrackers];	// Possible binary packets we are checking, oldest first.
+	size_t _binaryOnDeckCount;
+	ExpectedBinaryOutput _expectedBinaryOutputs[MaximumNumberOfExpectedBinaryOutputs];
+	size_t _numOfExpectedBinaryOutputs;
+	bool _rejectUnexpectedBinaryOutputs;
 	size_t _runningDataIndex;			// Used for correlating raw data with where the packet was found for the end user.
 	void* _possiblePacketFoundUserData;
 	ValidPacketFoundHandler _possiblePacketFoundHandler;
+	PacketBatch _dispatchBatch;			// Packets found for delivery to the registered handler.
 	#if PYTHON
 	/*boost::python::object* _pythonPacketFoundHandler;*/
 	PyObject* _pythonPacketFoundHandler;
@@ -105,9 +324,10 @@ struct PacketFinder::Impl
 
 	explicit Impl(PacketFinder* backReference) :
 		_backReference(backReference),
-		_buffer(new uint8_t[DefaultReceiveBufferSize]),
-		_bufferSize(DefaultReceiveBufferSize),
-		_bufferAppendLocation(0),
+		_buffer(DefaultReceiveBufferSize),
+		_binaryOnDeckCount(0),
+		_numOfExpectedBinaryOutputs(0),
+		_rejectUnexpectedBinaryOutputs(false),
 		_runningDataIndex(0),
 		_possiblePacketFoundUserData(NULL),
 		_possiblePacketFoundHandler(NULL)
@@ -119,44 +339,170 @@ struct PacketFinder::Impl
 
 	Impl(PacketFinder* backReference, size_t internalReceiveBufferSize) :
 		_backReference(backReference),
-		_buffer(new uint8_t[internalReceiveBufferSize]),
-		_bufferSize(internalReceiveBufferSize),
-		_bufferAppendLocation(0),
+		_buffer(internalReceiveBufferSize > DefaultReceiveBufferSize ? internalReceiveBufferSize : DefaultReceiveBufferSize),
+		_binaryOnDeckCount(0),
+		_numOfExpectedBinaryOutputs(0),
+		_rejectUnexpectedBinaryOutputs(false),
 		_runningDataIndex(0),
 		_possiblePacketFoundUserData(NULL),
 		_possiblePacketFoundHandler(NULL)
 	{ }
 
-	~Impl()
+	void resetTracking()
 	{
-		delete [] _buffer;
+		_asciiOnDeck.reset();
+		_binaryOnDeckCount = 0;
 	}
 
-	void resetTracking()
+	void trackPossibleBinaryPacket(size_t runningDataIndex, TimeStamp timeFound)
 	{
-		_asciiOnDeck.reset();
-		_binaryOnDeck.clear();
-		_bufferAppendLocation = 0;
+		if (_binaryOnDeckCount == MaximumNumberOfBinaryTrackers)
+		{
+			// Should not happen since trackers expire, but never grow past
+			// our fixed capacity. Drop the oldest tracker.
+			removeBinaryTracker(0);
+		}
+
+		_binaryOnDeck[_binaryOnDeckCount++].reset(runningDataIndex, timeFound);
+	}
+
+	void removeBinaryTracker(size_t index)
+	{
+		for (size_t j = index + 1; j < _binaryOnDeckCount; j++)
+			_binaryOnDeck[j - 1] = _binaryOnDeck[j];
+
+		_binaryOnDeckCount--;
+	}
+
+	void removeInvalidBinaryTrackers()
+	{
+		size_t kept = 0;
+
+		for (size_t j = 0; j < _binaryOnDeckCount; j++)
+		{
+			if (_binaryOnDeck[j].markedInvalid)
+				continue;
+
+			if (kept != j)
+				_binaryOnDeck[kept] = _binaryOnDeck[j];
+
+			kept++;
+		}
+
+		_binaryOnDeckCount = kept;
+	}
+
+	// Checks the start of a possible binary packet against the expected
+	// binary outputs. If the header matches one, expected is set to it.
+	ExpectedBinaryOutputMatch matchExpectedBinaryOutput(const uint8_t* start, size_t numOfBytesAvailable, const ExpectedBinaryOutput*& expected)
+	{
+		ExpectedBinaryOutputMatch result = EXPECTEDMATCH_NONE;
+
+		for (size_t j = 0; j < MaximumNumberOfExpectedBinaryOutputs; j++)
+		{
+			const ExpectedBinaryOutput& e = _expectedBinaryOutputs[j];
+
+			if (!e.isRegistered)
+				continue;
+
+			if (numOfBytesAvailable < e.headerLength)
+			{
+				if (std::memcmp(start, e.header, numOfBytesAvailable) == 0)
+					result = EXPECTEDMATCH_INCOMPLETE;
+
+				continue;
+			}
+
+			if (std::memcmp(start, e.header, e.headerLength) != 0)
+				continue;
+
+			expected = &e;
+
+			return numOfBytesAvailable < e.packetLength ? EXPECTEDMATCH_INCOMPLETE : EXPECTEDMATCH_COMPLETE;
+		}
+
+		return result;
+	}
+
+	// Returns a contiguous pointer to a packet which started at the provided
+	// running index and continues up to the current byte data[i].
+	uint8_t* packetStart(size_t runningDataIndexOfStart, uint8_t data[], size_t i)
+	{
+		size_t numOfBytesBeforeCurrent = _runningDataIndex - runningDataIndexOfStart;
+
+		if (numOfBytesBeforeCurrent <= i)
+		{
+			// All the packet is in this data buffer so we don't need to do
+			// any copying.
+			return data + i - numOfBytesBeforeCurrent;
+		}
+
+		// The start of the packet arrived in an earlier call and is waiting
+		// in our receive buffer. Append the rest of it so it is contiguous.
+		_buffer.write(_runningDataIndex - i, data, i + 1);
+
+		return _buffer.at(runningDataIndexOfStart);
 	}
 
-	void dataReceived(uint8_t data[], size_t length, bool bootloaderFilter, TimeStamp timestamp)
+	// Returns a pointer to a possible packet which started at the provided
+	// running index and ends at the current byte data[i]. Our receive buffer
+	// may be overwritten before the batch is consumed, so a packet which
+	// started in an earlier call is copied into storage reserved in the batch.
+	// That storage must be released if the packet is not added to the batch.
+	char* possiblePacketStart(size_t runningDataIndexOfStart, uint8_t data[], size_t i, size_t packetLength, PacketBatch& batch, size_t& numOfBytesReserved)
+	{
+		uint8_t* start = packetStart(runningDataIndexOfStart, data, i);
+
+		numOfBytesReserved = 0;
+
+		if (_runningDataIndex - runningDataIndexOfStart <= i)
+			return reinterpret_cast<char*>(start);
+
+		char* copy = batch.reserveStorage(packetLength);
+
+		if (copy == NULL)
+		{
+			// Cannot happen since at most two packets are carried over
+			// between calls, but the receive buffer is still valid for the
+			// rest of this call.
+			return reinterpret_cast<char*>(start);
+		}
+
+		std::memcpy(copy, start, packetLength);
+		numOfBytesReserved = packetLength;
+
+		return copy;
+	}
+
+	void dataReceived(uint8_t data[], size_t length, bool bootloaderFilter, TimeStamp timestamp, PacketBatch& batch)
 	{
-		bool asciiStartFoundInProvidedBuffer = false;
 		bool asciiDoReset = false;
 
+		batch.clear();
+
 		// Assume that since the _runningDataIndex is unsigned, any overflows
 		// will naturally go to zero, which is the behavior that we want.
 		for (size_t i = 0; i < length; i++, _runningDataIndex++)
 		{
+			if (_binaryOnDeckCount == 0 && !_asciiOnDeck.currentlyBuildingAsciiPacket)
+			{
+				// Nothing is in progress, so only the start of a new packet can
+				// change our state. Skip straight over any noise.
+				size_t nextStart = findNextPossiblePacketStart(data, i, length, bootloaderFilter);
+
+				_runningDataIndex += nextStart - i;
+				i = nextStart;
+
+				if (i == length)
+					break;
+			}
+
 			if (data[i] == AsciiStartChar || (bootloaderFilter && (!_asciiOnDeck.currentlyBuildingAsciiPacket && data[i] == BootloaderVersionStartChar)))
 			{
 				_asciiOnDeck.reset();
 				_asciiOnDeck.currentlyBuildingAsciiPacket = true;
-				_asciiOnDeck.possibleStartOfPacketIndex = i;
 				_asciiOnDeck.runningDataIndexOfStart = _runningDataIndex;
 				_asciiOnDeck.timeFound = timestamp;
-
-				asciiStartFoundInProvidedBuffer = true;
 			}
 			else if (_asciiOnDeck.currentlyBuildingAsciiPacket && data[i] == AsciiEndChar1)
 			{
@@ -166,44 +512,19 @@ struct PacketFinder::Impl
 			{
 					// We have a possible data packet.
 					size_t runningIndexOfPacketStart = _asciiOnDeck.runningDataIndexOfStart;
-					uint8_t* startOfAsciiPacket = NULL;
-					size_t packetLength = 0;
+					size_t packetLength = _runningDataIndex - runningIndexOfPacketStart + 1;
 
-					if (asciiStartFoundInProvidedBuffer)
-					{
-						// All the packet was in this data buffer so we don't
-						// need to do any copying.
-
-						startOfAsciiPacket = data + _asciiOnDeck.possibleStartOfPacketIndex;
-						packetLength = i - _asciiOnDeck.possibleStartOfPacketIndex + 1;
-					}
-					else
-					{
-						// The packet was split between the running data buffer
-						// the current data buffer. We need to copy the data
-						// over before further processing.
-
-						if (_bufferAppendLocation + i < _bufferSize)
-						{
-							memcpy(_buffer + _bufferAppendLocation, data, i + 1);
-
-							startOfAsciiPacket = _buffer + _asciiOnDeck.possibleStartOfPacketIndex;
-							packetLength = _bufferAppendLocation + i + 1 - _asciiOnDeck.possibleStartOfPacketIndex;
-						}
-						else
-						{
-							// We are about to overflow our buffer. Just fall
-							// through to reset tracking.
-						}
-					}
-					
 					if (packetLength > MaximumSizeForAsciiPacket) // confirm valid packet length
 						packetLength = 0;
-					
-					Packet p(reinterpret_cast<char*>(startOfAsciiPacket), packetLength);
 
-					if (p.isValid())
-						dispatchPacket(p, runningIndexOfPacketStart, _asciiOnDeck.timeFound);
+					size_t numOfBytesReserved;
+					PacketView p(possiblePacketStart(runningIndexOfPacketStart, data, i, packetLength, batch, numOfBytesReserved), packetLength);
+
+					bool valid;
+					if (p.tryIsValid(valid) && valid)
+						batch.add(p, runningIndexOfPacketStart, _asciiOnDeck.timeFound);
+					else
+						batch.releaseStorage(numOfBytesReserved);
 
 					asciiDoReset = true;
 			}
@@ -212,7 +533,7 @@ struct PacketFinder::Impl
 				// Invalid packet - EndChar2 not immediately after EndChar1
 				asciiDoReset = true;
 			}
-			else if (i + 1 - _asciiOnDeck.possibleStartOfPacketIndex > MaximumSizeForAsciiPacket)
+			else if (_asciiOnDeck.currentlyBuildingAsciiPacket && _runningDataIndex - _asciiOnDeck.runningDataIndexOfStart + 1 > MaximumSizeForAsciiPacket)
 			{
 				// Invalid packet - length exceeds max packet
 				asciiDoReset = true;
@@ -220,19 +541,18 @@ struct PacketFinder::Impl
 
 			if (asciiDoReset) // Either processed packet or invalid packet
 			{
-				if (_binaryOnDeck.empty())
+				if (_binaryOnDeckCount == 0)
 					resetTracking();
 				else
 					_asciiOnDeck.reset();
-				asciiStartFoundInProvidedBuffer = false;
 				asciiDoReset = false;
 			}
 
 			// Update all of our binary packets on deck.
-			queue<BinaryTracker> invalidPackets;
-			for (list<BinaryTracker>::iterator it = _binaryOnDeck.begin(); it != _binaryOnDeck.end(); ++it)
+			bool anyInvalidPackets = false;
+			for (size_t t = 0; t < _binaryOnDeckCount; t++)
 			{
-				BinaryTracker &ez = (*it);
+				BinaryTracker &ez = _binaryOnDeck[t];
 
 				if (!ez.groupsPresentFound)
 				{
@@ -241,6 +561,10 @@ struct PacketFinder::Impl
 					ez.groupsPresent = data[i];
 					ez.numOfBytesRemainingToHaveAllGroupFields = 2 * countSetBits(data[i]);
 
+					// A packet must contain at least one group.
+					if (ez.numOfBytesRemainingToHaveAllGroupFields == 0)
+						ez.markedInvalid = anyInvalidPackets = true;
+
 					continue;
 				}
 
@@ -252,44 +576,34 @@ struct PacketFinder::Impl
 					if (ez.numOfBytesRemainingToHaveAllGroupFields == 0)
 					{
 						// We have all of the group fields now.
+						size_t headerLength = _runningDataIndex - ez.runningDataIndexOfStart + 1;
+						uint8_t* start = packetStart(ez.runningDataIndexOfStart, data, i);
+						const ExpectedBinaryOutput* expected = NULL;
 						size_t remainingBytesForCompletePacket;
-						if (ez.startFoundInProvidedDataBuffer)
+
+						if (_numOfExpectedBinaryOutputs != 0)
+							matchExpectedBinaryOutput(start, headerLength, expected);
+
+						if (expected != NULL)
 						{
-							size_t headerLength = i - ez.possibleStartIndex + 1;
-							remainingBytesForCompletePacket = Packet::computeBinaryPacketLength(reinterpret_cast<char*>(data) + ez.possibleStartIndex) - headerLength;
+							remainingBytesForCompletePacket = expected->packetLength - headerLength;
 						}
-						else
+						else if (_numOfExpectedBinaryOutputs != 0 && _rejectUnexpectedBinaryOutputs)
 						{
-							// Not all of the packet's group is inside the caller's provided buffer.
-
-							// Temporarily copy the rest of the packet to the receive buffer
-							// for computing the size of the packet.
-
-							size_t numOfBytesToCopyIntoReceiveBuffer = i + 1;
-							size_t headerLength = _bufferAppendLocation - ez.possibleStartIndex + numOfBytesToCopyIntoReceiveBuffer;
-
-							if (_bufferAppendLocation + numOfBytesToCopyIntoReceiveBuffer < _bufferSize)
-							{
-								std::memcpy(_buffer + _bufferAppendLocation, data, numOfBytesToCopyIntoReceiveBuffer);
+							// Only packets with one of the expected headers are of interest.
+							ez.markedInvalid = anyInvalidPackets = true;
 
-								remainingBytesForCompletePacket = Packet::computeBinaryPacketLength(reinterpret_cast<char*>(_buffer) + ez.possibleStartIndex) - headerLength;
-							}
-							else
-							{
-								// About to overrun our receive buffer!
-								invalidPackets.push(ez);
-
-								// TODO: Should we just go ahead and clear the ASCII tracker
-								//       and buffer append location?
-
-								continue;
-							}
+							continue;
+						}
+						else
+						{
+							remainingBytesForCompletePacket = Packet::computeBinaryPacketLength(reinterpret_cast<char*>(start)) - headerLength;
 						}
 
 						if (remainingBytesForCompletePacket > MaximumSizeExpectedForBinaryPacket)
 						{
 							// Must be a bad possible binary packet.
-							invalidPackets.push(ez);
+							ez.markedInvalid = anyInvalidPackets = true;
 						}
 						else
 						{
@@ -308,45 +622,20 @@ struct PacketFinder::Impl
 				{
 					// We have a possible binary packet!
 
-					uint8_t* packetStart;
-					size_t packetLength;
-
-					if (ez.startFoundInProvidedDataBuffer)
-					{
-						// The binary packet exists completely in the user's provided buffer.
-						packetStart = data + ez.possibleStartIndex;
-						packetLength = i - ez.possibleStartIndex + 1;
-					}
-					else
-					{
-						// The packet is split between our receive buffer and the user's buffer.
-						size_t numOfBytesToCopyIntoReceiveBuffer = i + 1;
-
-						if (_bufferAppendLocation + numOfBytesToCopyIntoReceiveBuffer < _bufferSize)
-						{
-							std::memcpy(_buffer + _bufferAppendLocation, data, numOfBytesToCopyIntoReceiveBuffer);
-
-							packetStart = _buffer + ez.possibleStartIndex;
-							packetLength = _bufferAppendLocation - ez.possibleStartIndex + i + 1;
-						}
-						else
-						{
-							// About to overrun our receive buffer!
-							invalidPackets.push(ez);
-
-							continue;
-						}
-					}
+					size_t packetLength = _runningDataIndex - ez.runningDataIndexOfStart + 1;
 
 					if (packetLength > MaximumSizeExpectedForBinaryPacket) // confirm valid packet length
 						packetLength = 0;
 
-					Packet p(reinterpret_cast<char*>(packetStart), packetLength);
+					size_t numOfBytesReserved;
+					PacketView p(possiblePacketStart(ez.runningDataIndexOfStart, data, i, packetLength, batch, numOfBytesReserved), packetLength);
 
-					if (!p.isValid())
+					bool valid;
+					if (!p.tryIsValid(valid) || !valid)
 					{
 						// Invalid packet!
-						invalidPackets.push(ez);
+						ez.markedInvalid = anyInvalidPackets = true;
+						batch.releaseStorage(numOfBytesReserved);
 					}
 					else
 					{
@@ -355,10 +644,10 @@ struct PacketFinder::Impl
 						// Copy data out of the tracking lists since we will be resetting them.
 						BinaryTracker bt = ez;
 
-						invalidPackets = queue<BinaryTracker>();
+						anyInvalidPackets = false;
 						resetTracking();
 
-						dispatchPacket(p, bt.runningDataIndexOfStart, bt.timeFound);
+						batch.add(p, bt.runningDataIndexOfStart, bt.timeFound);
 
 						break;
 					}
@@ -366,96 +655,95 @@ struct PacketFinder::Impl
 			}
 
 			// Remove any invalid packets.
-			while (!invalidPackets.empty())
-			{
-				_binaryOnDeck.remove(invalidPackets.front());
-				invalidPackets.pop();
-			}
-
-			if (_binaryOnDeck.empty() && !_asciiOnDeck.currentlyBuildingAsciiPacket)
-			{
-				_bufferAppendLocation = 0;
-			}
+			if (anyInvalidPackets)
+				removeInvalidBinaryTrackers();
 
 			if (data[i] == BinaryStartChar)
 			{
 				// Possible start of a binary packet.
-				_binaryOnDeck.push_back(BinaryTracker(i, _runningDataIndex, timestamp));
-			}
-		}
+				const ExpectedBinaryOutput* expected = NULL;
+				ExpectedBinaryOutputMatch match = EXPECTEDMATCH_INCOMPLETE;
 
-		if (_binaryOnDeck.empty() && !_asciiOnDeck.currentlyBuildingAsciiPacket)
-		{
-			// No data to copy over.
-			return;
-		}
+				if (_numOfExpectedBinaryOutputs != 0)
+					match = matchExpectedBinaryOutput(data + i, length - i, expected);
 
-		// Perform any data copying to our receive buffer.
+				switch (match)
+				{
+					case EXPECTEDMATCH_NONE:
+						// Not a packet we are expecting, but it may still be
+						// a valid packet with another configuration.
+						if (!_rejectUnexpectedBinaryOutputs)
+							trackPossibleBinaryPacket(_runningDataIndex, timestamp);
+						break;
 
-		size_t dataIndexToStartCopyingFrom = 0;
-		bool binaryDataToCopyOver = false;
-		size_t binaryDataMoveOverIndexAdjustment = 0;
+					case EXPECTEDMATCH_INCOMPLETE:
+						// Need to wait for the rest of the packet.
+						trackPossibleBinaryPacket(_runningDataIndex, timestamp);
+						break;
 
-		if (!_binaryOnDeck.empty())
-		{
-			binaryDataToCopyOver = true;
+					case EXPECTEDMATCH_COMPLETE:
+					{
+						// The whole packet is already here so go straight to
+						// checking its CRC.
+						PacketView p(reinterpret_cast<char*>(data + i), expected->packetLength);
 
-			if (_binaryOnDeck.front().startFoundInProvidedDataBuffer)
-			{
-				dataIndexToStartCopyingFrom = _binaryOnDeck.front().possibleStartIndex;
-				binaryDataMoveOverIndexAdjustment = dataIndexToStartCopyingFrom;
-			}
-		}
+						bool valid;
+						if (!p.tryIsValid(valid) || !valid)
+							break;
 
-		if (_asciiOnDeck.currentlyBuildingAsciiPacket && asciiStartFoundInProvidedBuffer)
-		{
-			if (_asciiOnDeck.possibleStartOfPacketIndex < dataIndexToStartCopyingFrom)
-			{
-				binaryDataMoveOverIndexAdjustment -= binaryDataMoveOverIndexAdjustment - _asciiOnDeck.possibleStartOfPacketIndex;
-				dataIndexToStartCopyingFrom = _asciiOnDeck.possibleStartOfPacketIndex;
-			}
-			else if (!binaryDataToCopyOver)
-			{
-				dataIndexToStartCopyingFrom = _asciiOnDeck.possibleStartOfPacketIndex;
-			}
+						size_t runningIndexOfPacketStart = _runningDataIndex;
 
-			// Adjust our ASCII index to be based on the recieve buffer.
-			_asciiOnDeck.possibleStartOfPacketIndex = _bufferAppendLocation + _asciiOnDeck.possibleStartOfPacketIndex - dataIndexToStartCopyingFrom;
-		}
+						resetTracking();
 
-		// Adjust any binary packet indexes we are currently building.
-		for (list<BinaryTracker>::iterator it = _binaryOnDeck.begin(); it != _binaryOnDeck.end(); ++it)
-		{
-			if ((*it).startFoundInProvidedDataBuffer)
-			{
-				(*it).startFoundInProvidedDataBuffer = false;
-				(*it).possibleStartIndex = (*it).possibleStartIndex - binaryDataMoveOverIndexAdjustment + _bufferAppendLocation;
+						batch.add(p, runningIndexOfPacketStart, timestamp);
+
+						// Move on to the last byte of the packet.
+						i += expected->packetLength - 1;
+						_runningDataIndex += expected->packetLength - 1;
+
+						break;
+					}
+				}
 			}
 		}
 
-		if (_bufferAppendLocation + length - dataIndexToStartCopyingFrom < _bufferSize)
-		{
-			// Safe to copy over the data.
+		// Save any data belonging to packets still in progress to our receive
+		// buffer. Data from earlier calls is already there.
+
+		size_t numOfBytesInProgress = 0;
 
-			size_t numOfBytesToCopyOver = length - dataIndexToStartCopyingFrom;
-			uint8_t *copyFromStart = data + dataIndexToStartCopyingFrom;
+		if (_binaryOnDeckCount != 0)
+			numOfBytesInProgress = _runningDataIndex - _binaryOnDeck[0].runningDataIndexOfStart;
 
-			std::memcpy(_buffer + _bufferAppendLocation, copyFromStart, numOfBytesToCopyOver);
-			_bufferAppendLocation += numOfBytesToCopyOver;
+		if (_asciiOnDeck.currentlyBuildingAsciiPacket && _runningDataIndex - _asciiOnDeck.runningDataIndexOfStart > numOfBytesInProgress)
+			numOfBytesInProgress = _runningDataIndex - _asciiOnDeck.runningDataIndexOfStart;
+
+		if (numOfBytesInProgress == 0)
+		{
+			// No data to copy over.
+			return;
 		}
-		else
+
+		if (numOfBytesInProgress > _buffer.capacity())
 		{
-			// We are about to overflow our buffer.
+			// Cannot happen since packets in progress are bounded in size,
+			// but never let the buffer wrap over data still in use.
 			resetTracking();
+			return;
 		}
+
+		size_t numOfBytesToCopyOver = numOfBytesInProgress < length ? numOfBytesInProgress : length;
+
+		_buffer.write(_runningDataIndex - numOfBytesToCopyOver, data + length - numOfBytesToCopyOver, numOfBytesToCopyOver);
 	}
 
-	void dispatchPacket(Packet &packet, size_t runningDataIndexAtPacketStart, TimeStamp timestamp)
+	void dispatchPackets(PacketBatch& batch)
 	{
-		if (_possiblePacketFoundHandler != NULL)
-		{
-			_possiblePacketFoundHandler(_possiblePacketFoundUserData, packet, runningDataIndexAtPacketStart, timestamp);
-		}
+		if (_possiblePacketFoundHandler == NULL)
+			return;
+
+		for (size_t i = 0; i < batch.size(); i++)
+			_possiblePacketFoundHandler(_possiblePacketFoundUserData, batch.packet(i), batch.runningIndexOfPacketStart(i), batch.timestamp(i));
 	}
 };
 
@@ -500,7 +788,31 @@ void PacketFinder::processReceivedData(char data[], size_t length, bool bootload
 
 void PacketFinder::processReceivedData(char data[], size_t length, bool bootloaderFilter, TimeStamp timestamp)
 {
-	_pi->dataReceived(reinterpret_cast<uint8_t*>(data), length, bootloaderFilter, timestamp);
+	try
+	{
+		_pi->dataReceived(reinterpret_cast<uint8_t*>(data), length, bootloaderFilter, timestamp, _pi->_dispatchBatch);
+	}
+	catch (...)
+	{
+		// Still deliver the packets found before the failure.
+		_pi->dispatchPackets(_pi->_dispatchBatch);
+
+		throw;
+	}
+
+	_pi->dispatchPackets(_pi->_dispatchBatch);
+}
+
+void PacketFinder::processReceivedData(char data[], size_t length, PacketBatch& batch)
+{
+	TimeStamp placeholder;
+
+	processReceivedData(data, length, false, placeholder, batch);
+}
+
+void PacketFinder::processReceivedData(char data[], size_t length, bool bootloaderFilter, TimeStamp timestamp, PacketBatch& batch)
+{
+	_pi->dataReceived(reinterpret_cast<uint8_t*>(data), length, bootloaderFilter, timestamp, batch);
 }
 
 #if PYTHON
@@ -536,6 +848,85 @@ void PacketFinder::unregisterPossiblePacketFoundHandler()
 	_pi->_possiblePacketFoundUserData = NULL;
 }
 
+void PacketFinder::registerExpectedBinaryOutput(uint8_t binaryOutputNumber, CommonGroup commonGroup, TimeGroup timeGroup, ImuGroup imuGroup, GpsGroup gpsGroup, AttitudeGroup attitudeGroup, InsGroup insGroup, GpsGroup gps2Group)
+{
+	if (binaryOutputNumber < 1 || binaryOutputNumber > Impl::MaximumNumberOfExpectedBinaryOutputs)
+		throw invalid_argument("binaryOutputNumber");
+
+	if (!commonGroup && !timeGroup && !imuGroup && !gpsGroup && !attitudeGroup && !insGroup && !gps2Group)
+	{
+		// An output without any groups is not sending anything.
+		unregisterExpectedBinaryOutput(binaryOutputNumber);
+
+		return;
+	}
+
+	Impl::ExpectedBinaryOutput e;
+
+	e.header[e.headerLength++] = Impl::BinaryStartChar;
+	e.header[e.headerLength++] =
+		(commonGroup ? BINARYGROUP_COMMON : 0) |
+		(timeGroup ? BINARYGROUP_TIME : 0) |
+		(imuGroup ? BINARYGROUP_IMU : 0) |
+		(gpsGroup ? BINARYGROUP_GPS : 0) |
+		(attitudeGroup ? BINARYGROUP_ATTITUDE : 0) |
+		(insGroup ? BINARYGROUP_INS : 0) |
+		(gps2Group ? BINARYGROUP_GPS2 : 0);
+
+	if (commonGroup)
+		e.appendGroupField(commonGroup);
+	if (timeGroup)
+		e.appendGroupField(timeGroup);
+	if (imuGroup)
+		e.appendGroupField(imuGroup);
+	if (gpsGroup)
+		e.appendGroupField(gpsGroup);
+	if (attitudeGroup)
+		e.appendGroupField(attitudeGroup);
+	if (insGroup)
+		e.appendGroupField(insGroup);
+	if (gps2Group)
+		e.appendGroupField(gps2Group);
+
+	e.packetLength = Packet::computeBinaryPacketLength(reinterpret_cast<char*>(e.header));
+
+	if (e.packetLength > Impl::MaximumSizeExpectedForBinaryPacket)
+		throw invalid_argument("Binary output is larger than the largest supported packet.");
+
+	e.isRegistered = true;
+
+	Impl::ExpectedBinaryOutput& slot = _pi->_expectedBinaryOutputs[binaryOutputNumber - 1];
+
+	if (!slot.isRegistered)
+		_pi->_numOfExpectedBinaryOutputs++;
+
+	slot = e;
+}
+
+bool PacketFinder::rejectUnexpectedBinaryOutputs()
+{
+	return _pi->_rejectUnexpectedBinaryOutputs;
+}
+
+void PacketFinder::setRejectUnexpectedBinaryOutputs(bool reject)
+{
+	_pi->_rejectUnexpectedBinaryOutputs = reject;
+}
+
+void PacketFinder::unregisterExpectedBinaryOutput(uint8_t binaryOutputNumber)
+{
+	if (binaryOutputNumber < 1 || binaryOutputNumber > Impl::MaximumNumberOfExpectedBinaryOutputs)
+		throw invalid_argument("binaryOutputNumber");
+
+	Impl::ExpectedBinaryOutput& slot = _pi->_expectedBinaryOutputs[binaryOutputNumber - 1];
+
+	if (!slot.isRegistered)
+		return;
+
+	slot.isRegistered = false;
+	_pi->_numOfExpectedBinaryOutputs--;
+}
+
 #if PYTHON
 
 //void PacketFinder::register_packet_found_handler(boost::python::object* callable)
@@ -0,0 +1,157 @@
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "vn/packetfinder.h"
+#include "vn/error_detection.h"
+
+#include "allocations.test.h"
+
+using namespace std;
+using namespace vn::protocol::uart;
+using namespace vn::data::integrity;
+
+namespace {
+
+// Builds a binary packet with the Common group's TimeStartup field, whose
+// payload is filled with sync bytes so every payload byte starts a tracker.
+string binaryPacket()
+{
+	string p;
+	p += '\xFA';
+	p += '\x01';
+	p += '\x01';
+	p += '\x00';
+	p.append(8, '\xFA');
+
+	uint16_t crc = Crc16::compute(p.data() + 1, p.size() - 1);
+	p += static_cast<char>(crc >> 8);
+	p += static_cast<char>(crc & 0xFF);
+
+	return p;
+}
+
+// Builds a binary packet with the Common group's YawPitchRoll field.
+string attitudePacket()
+{
+	string p;
+	p += '\xFA';
+	p += '\x01';
+	p += '\x08';
+	p += '\x00';
+	p.append(12, '\x00');
+
+	uint16_t crc = Crc16::compute(p.data() + 1, p.size() - 1);
+	p += static_cast<char>(crc >> 8);
+	p += static_cast<char>(crc & 0xFF);
+
+	return p;
+}
+
+string asciiPacket(int index)
+{
+	char body[64];
+	sprintf(body, "VNYMR,%+08.3f,+001.000,-002.000", index * 0.5);
+
+	char packet[80];
+	sprintf(packet, "$%s*%02X\r\n", body, Checksum8::compute(body, strlen(body)));
+
+	return packet;
+}
+
+void countPacket(void* userData, PacketView&, size_t, vn::xplat::TimeStamp)
+{
+	++*static_cast<size_t*>(userData);
+}
+
+}
+
+TEST(PacketFinder, SteadyStateFramingDoesNotAllocate)
+{
+	// A chunk of packets separated by noise, the way a serial read returns
+	// them.
+	string chunk;
+	size_t numOfPacketsPerChunk = 0;
+
+	for (int i = 0; i < 16; i++)
+	{
+		chunk += binaryPacket();
+		chunk += "noise";
+		chunk += asciiPacket(i);
+		numOfPacketsPerChunk += 2;
+	}
+
+	size_t numOfPacketsFound = 0;
+
+	PacketFinder finder;
+	finder.registerPossiblePacketFoundHandler(&numOfPacketsFound, countPacket);
+
+	// The first pass lets any state which is created on demand settle.
+	finder.processReceivedData(&chunk[0], chunk.size());
+
+	const size_t Megabyte = 1024 * 1024;
+	size_t numOfChunks = Megabyte / chunk.size() + 1;
+
+	// Checks that allocations are counted at all.
+	size_t allocationsBeforeProbe = numOfAllocations();
+	int* volatile probe = new int(0);
+	delete probe;
+	ASSERT_EQ(allocationsBeforeProbe + 1, numOfAllocations());
+
+	size_t allocationsBefore = numOfAllocations();
+
+	for (size_t i = 0; i < numOfChunks; i++)
+		finder.processReceivedData(&chunk[0], chunk.size());
+
+	size_t allocationsPerMegabyte = numOfAllocations() - allocationsBefore;
+
+	EXPECT_EQ(0u, allocationsPerMegabyte);
+	EXPECT_EQ((numOfChunks + 1) * numOfPacketsPerChunk, numOfPacketsFound);
+}
+
+TEST(PacketFinder, FindsPacketsSplitAcrossReads)
+{
+	string data = binaryPacket() + asciiPacket(1) + binaryPacket();
+
+	size_t numOfPacketsFound = 0;
+
+	PacketFinder finder;
+	finder.registerPossiblePacketFoundHandler(&numOfPacketsFound, countPacket);
+
+	for (size_t i = 0; i < data.size(); i++)
+		finder.processReceivedData(&data[i], 1);
+
+	EXPECT_EQ(3u, numOfPacketsFound);
+}
+
+TEST(PacketFinder, FindsBinaryPacketsOutsideTheExpectedOutputs)
+{
+	// Split across reads so both the whole-packet check and the tracking
+	// of partial packets are exercised.
+	string data = attitudePacket() + binaryPacket() + attitudePacket();
+
+	size_t numOfPacketsFound = 0;
+
+	PacketFinder finder;
+	finder.registerPossiblePacketFoundHandler(&numOfPacketsFound, countPacket);
+	finder.registerExpectedBinaryOutput(1, COMMONGROUP_YAWPITCHROLL, TIMEGROUP_NONE, IMUGROUP_NONE, GPSGROUP_NONE, ATTITUDEGROUP_NONE, INSGROUP_NONE, GPSGROUP_NONE);
+
+	finder.processReceivedData(&data[0], data.size());
+	EXPECT_EQ(3u, numOfPacketsFound);
+
+	for (size_t i = 0; i < data.size(); i++)
+		finder.processReceivedData(&data[i], 1);
+	EXPECT_EQ(6u, numOfPacketsFound);
+
+	// Only the expected outputs are found once unexpected ones are rejected.
+	finder.setRejectUnexpectedBinaryOutputs(true);
+
+	finder.processReceivedData(&data[0], data.size());
+	EXPECT_EQ(8u, numOfPacketsFound);
+
+	for (size_t i = 0; i < data.size(); i++)
+		finder.processReceivedData(&data[i], 1);
+	EXPECT_EQ(10u, numOfPacketsFound);
+}
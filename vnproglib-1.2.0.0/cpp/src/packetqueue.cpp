@@ -0,0 +1,252 @@
+#include "vn/packetqueue.h"
+
+#include <cstring>
+
+// Indices shared between the producer and the consumer use C++11 atomics
+// where available. Older GCC compilers provide the same operations as
+// builtins, and older Microsoft compilers give volatile accesses acquire and
+// release semantics.
+#if (defined(_MSC_VER) && _MSC_VER >= 1700) || (__cplusplus >= 201103L)
+	#include <atomic>
+	#define VN_PACKETQUEUE_STD_ATOMIC 1
+#elif defined(__GNUC__) || defined(_MSC_VER)
+	#define VN_PACKETQUEUE_STD_ATOMIC 0
+#else
+	#error "Unknown Compiler"
+#endif
+
+using namespace std;
+
+namespace vn {
+namespace protocol {
+namespace uart {
+
+namespace {
+
+#if VN_PACKETQUEUE_STD_ATOMIC
+
+typedef std::atomic<size_t> SharedIndex;
+
+size_t loadAcquire(const SharedIndex &index)
+{
+	return index.load(std::memory_order_acquire);
+}
+
+void storeRelease(SharedIndex &index, size_t value)
+{
+	index.store(value, std::memory_order_release);
+}
+
+#elif defined(__GNUC__)
+
+typedef size_t SharedIndex;
+
+size_t loadAcquire(const SharedIndex &index)
+{
+	return __atomic_load_n(&index, __ATOMIC_ACQUIRE);
+}
+
+void storeRelease(SharedIndex &index, size_t value)
+{
+	__atomic_store_n(&index, value, __ATOMIC_RELEASE);
+}
+
+#else
+
+typedef volatile size_t SharedIndex;
+
+size_t loadAcquire(const SharedIndex &index)
+{
+	return index;
+}
+
+void storeRelease(SharedIndex &index, size_t value)
+{
+	index = value;
+}
+
+#endif
+
+// Keeps the members written by the producer and by the consumer on separate
+// cache lines, so the two threads do not contend for them.
+const size_t CacheLineSize = 64;
+
+struct Slot
+{
+	size_t Length;
+	size_t RunningIndex;
+	xplat::TimeStamp Timestamp;
+	char Data[PacketQueue::MaximumPacketSize];
+};
+
+}
+
+const size_t PacketQueue::MaximumPacketSize;
+
+struct PacketQueue::Impl
+{
+	Slot* Slots;
+	size_t Capacity;
+
+	char PaddingBeforeProducer[CacheLineSize];
+
+	// Written only by the producer. Positions grow without bound and address
+	// the slot at the position modulo the capacity.
+	SharedIndex Head;
+	SharedIndex NumOfPacketsQueued;
+	SharedIndex NumOfPacketsDropped;
+	SharedIndex MaximumDepth;
+
+	char PaddingBeforeConsumer[CacheLineSize];
+
+	// Written only by the consumer.
+	SharedIndex Tail;
+	// The consumer's last view of the producer's position.
+	size_t CachedHead;
+
+	char PaddingAfterConsumer[CacheLineSize];
+
+	explicit Impl(size_t capacity) :
+		Slots(new Slot[capacity]),
+		Capacity(capacity),
+		Head(0),
+		NumOfPacketsQueued(0),
+		NumOfPacketsDropped(0),
+		MaximumDepth(0),
+		Tail(0),
+		CachedHead(0)
+	{
+	}
+
+	~Impl()
+	{
+		delete [] Slots;
+	}
+
+	Slot& at(size_t position)
+	{
+		return Slots[position & (Capacity - 1)];
+	}
+
+	// Counters only have a single writer, so they are incremented without an
+	// atomic read-modify-write.
+	static void increment(SharedIndex &counter)
+	{
+		storeRelease(counter, loadAcquire(counter) + 1);
+	}
+};
+
+PacketQueue::PacketQueue(size_t minimumCapacity) :
+	_pi(NULL)
+{
+	size_t capacity = 1;
+	while (capacity < minimumCapacity)
+		capacity <<= 1;
+
+	_pi = new Impl(capacity);
+}
+
+PacketQueue::~PacketQueue()
+{
+	delete _pi;
+}
+
+size_t PacketQueue::capacity() const
+{
+	return _pi->Capacity;
+}
+
+bool PacketQueue::push(const PacketView &packet, size_t runningIndex, xplat::TimeStamp timestamp)
+{
+	size_t head = loadAcquire(_pi->Head);
+
+	if (packet.length() > MaximumPacketSize)
+	{
+		Impl::increment(_pi->NumOfPacketsDropped);
+
+		return false;
+	}
+
+	// The consumer's position is read for every packet anyway to track the
+	// maximum depth.
+	size_t depth = head - loadAcquire(_pi->Tail);
+
+	if (depth == _pi->Capacity)
+	{
+		Impl::increment(_pi->NumOfPacketsDropped);
+
+		return false;
+	}
+
+	Slot& slot = _pi->at(head);
+
+	memcpy(slot.Data, packet.data(), packet.length());
+	slot.Length = packet.length();
+	slot.RunningIndex = runningIndex;
+	slot.Timestamp = timestamp;
+
+	// Publishing the new head releases the slot's contents to the consumer.
+	storeRelease(_pi->Head, head + 1);
+
+	Impl::increment(_pi->NumOfPacketsQueued);
+
+	if (depth + 1 > loadAcquire(_pi->MaximumDepth))
+		storeRelease(_pi->MaximumDepth, depth + 1);
+
+	return true;
+}
+
+char* PacketQueue::front(size_t &length, size_t &runningIndex, xplat::TimeStamp &timestamp)
+{
+	size_t tail = loadAcquire(_pi->Tail);
+
+	if (tail == _pi->CachedHead)
+	{
+		_pi->CachedHead = loadAcquire(_pi->Head);
+
+		if (tail == _pi->CachedHead)
+			return NULL;
+	}
+
+	Slot& slot = _pi->at(tail);
+
+	length = slot.Length;
+	runningIndex = slot.RunningIndex;
+	timestamp = slot.Timestamp;
+
+	return slot.Data;
+}
+
+void PacketQueue::pop()
+{
+	// Publishing the new tail hands the slot back to the producer.
+	storeRelease(_pi->Tail, loadAcquire(_pi->Tail) + 1);
+}
+
+size_t PacketQueue::depth() const
+{
+	// Reading the tail first means the depth is never reported as negative,
+	// though it may be momentarily out of date.
+	size_t tail = loadAcquire(_pi->Tail);
+
+	return loadAcquire(_pi->Head) - tail;
+}
+
+size_t PacketQueue::maximumDepth() const
+{
+	return loadAcquire(_pi->MaximumDepth);
+}
+
+size_t PacketQueue::numOfPacketsQueued() const
+{
+	return loadAcquire(_pi->NumOfPacketsQueued);
+}
+
+size_t PacketQueue::numOfPacketsDropped() const
+{
+	return loadAcquire(_pi->NumOfPacketsDropped);
+}
+
+}
+}
+}
@@ -0,0 +1,168 @@
+#include "vn/ringbuffer.h"
+
+#if _WIN32
+	#include <Windows.h>
+#elif __linux__ || __APPLE__ || __CYGWIN__ || __QNXNTO__
+	#include <sys/mman.h>
+	#include <unistd.h>
+#else
+	#error "Unknown System"
+#endif
+
+#include <cstring>
+
+#include "vn/exceptions.h"
+
+// memfd_create is only available on Linux, and only declared by newer C
+// libraries. Other systems use the mirrored copy instead.
+#if __linux__ && defined(MFD_CLOEXEC)
+	#define VN_RINGBUFFER_DOUBLE_MAPPED 1
+#else
+	#define VN_RINGBUFFER_DOUBLE_MAPPED 0
+#endif
+
+using namespace std;
+
+namespace vn {
+namespace xplat {
+
+struct RingBuffer::Impl
+{
+	uint8_t* Buffer;
+	size_t Capacity;
+	bool IsDoubleMapped;
+
+	explicit Impl(size_t capacity) :
+		Buffer(NULL),
+		Capacity(capacity),
+		IsDoubleMapped(false)
+	{
+	}
+
+	static size_t pageSize()
+	{
+		#if _WIN32
+		SYSTEM_INFO info;
+		GetSystemInfo(&info);
+		return info.dwPageSize;
+		#elif __linux__ || __APPLE__ || __CYGWIN__ || __QNXNTO__
+		long size = sysconf(_SC_PAGESIZE);
+		return size > 0 ? static_cast<size_t>(size) : 4096;
+		#else
+		#error "Unknown System"
+		#endif
+	}
+
+	// Maps the same memory twice back to back. Returns NULL if this is not
+	// possible on the current system.
+	uint8_t* mapTwice()
+	{
+		#if VN_RINGBUFFER_DOUBLE_MAPPED
+
+		int fd = memfd_create("vn_ringbuffer", MFD_CLOEXEC);
+		if (fd == -1)
+			return NULL;
+
+		if (ftruncate(fd, Capacity) != 0)
+		{
+			close(fd);
+			return NULL;
+		}
+
+		// Reserve the full address range first so both halves are guaranteed
+		// to be adjacent.
+		void* reserved = mmap(NULL, 2 * Capacity, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (reserved == MAP_FAILED)
+		{
+			close(fd);
+			return NULL;
+		}
+
+		uint8_t* base = static_cast<uint8_t*>(reserved);
+
+		if (mmap(base, Capacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED
+			|| mmap(base + Capacity, Capacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED)
+		{
+			munmap(reserved, 2 * Capacity);
+			close(fd);
+			return NULL;
+		}
+
+		// The mappings keep the memory alive.
+		close(fd);
+
+		return base;
+
+		#else
+
+		return NULL;
+
+		#endif
+	}
+};
+
+RingBuffer::RingBuffer(size_t minimumCapacity) :
+	_pi(NULL)
+{
+	size_t capacity = Impl::pageSize();
+	while (capacity < minimumCapacity)
+		capacity <<= 1;
+
+	_pi = new Impl(capacity);
+
+	_pi->Buffer = _pi->mapTwice();
+	_pi->IsDoubleMapped = _pi->Buffer != NULL;
+
+	if (!_pi->IsDoubleMapped)
+		_pi->Buffer = new uint8_t[2 * capacity];
+}
+
+RingBuffer::~RingBuffer()
+{
+	#if VN_RINGBUFFER_DOUBLE_MAPPED
+	if (_pi->IsDoubleMapped)
+		munmap(_pi->Buffer, 2 * _pi->Capacity);
+	#endif
+
+	if (!_pi->IsDoubleMapped)
+		delete [] _pi->Buffer;
+
+	delete _pi;
+}
+
+size_t RingBuffer::capacity() const
+{
+	return _pi->Capacity;
+}
+
+uint8_t* RingBuffer::at(size_t position)
+{
+	return _pi->Buffer + (position & (_pi->Capacity - 1));
+}
+
+void RingBuffer::write(size_t position, const uint8_t* data, size_t length)
+{
+	if (length > _pi->Capacity)
+		throw invalid_argument("length");
+
+	size_t offset = position & (_pi->Capacity - 1);
+
+	if (_pi->IsDoubleMapped)
+	{
+		std::memcpy(_pi->Buffer + offset, data, length);
+
+		return;
+	}
+
+	// Keep both halves identical so reads past the end of the first half
+	// see the wrapped data.
+	size_t numOfBytesBeforeWrap = length < _pi->Capacity - offset ? length : _pi->Capacity - offset;
+
+	std::memcpy(_pi->Buffer + offset, data, numOfBytesBeforeWrap);
+	std::memcpy(_pi->Buffer + _pi->Capacity + offset, data, numOfBytesBeforeWrap);
+	std::memcpy(_pi->Buffer, data + numOfBytesBeforeWrap, length - numOfBytesBeforeWrap);
+	std::memcpy(_pi->Buffer + _pi->Capacity, data + numOfBytesBeforeWrap, length - numOfBytesBeforeWrap);
+}
+
+}
+}
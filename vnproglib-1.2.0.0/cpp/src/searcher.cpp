@@ -3,8 +3,11 @@
 #include "vn/event.h"
 #include "vn/thread.h"
 #include "vn/packetfinder.h"
+#include "vn/criticalsection.h"
+#include "vn/vntime.h"
 
-#include <list>
+#include <fstream>
+#include <string.h>
 
 using namespace std;
 using namespace vn::xplat;
@@ -25,50 +28,356 @@ struct TestHelper
 	{ }
 };
 
-struct SearchHelper
+// Shared by the threads of a discovery, which each search one port.
+struct DiscoveryState
 {
-	Event finishedSearchingPort;
-	bool sensorFound;
+	CriticalSection stateCS;
+	size_t expectedNumOfSensors;
+	size_t numOfSensorsFound;
+	bool cancelled;
+
+	explicit DiscoveryState(size_t expectedNumOfSensors) :
+		expectedNumOfSensors(expectedNumOfSensors),
+		numOfSensorsFound(0),
+		cancelled(false)
+	{ }
+
+	bool isCancelled()
+	{
+		stateCS.enter();
+		bool c = cancelled;
+		stateCS.leave();
+
+		return c;
+	}
+
+	// Once the expected number of sensors is found, the searches of the
+	// remaining ports are cancelled.
+	void sensorFound()
+	{
+		stateCS.enter();
+
+		numOfSensorsFound++;
+
+		if (expectedNumOfSensors != 0 && numOfSensorsFound >= expectedNumOfSensors)
+			cancelled = true;
+
+		stateCS.leave();
+	}
+};
+
+struct PortDiscovery
+{
+	DiscoveryState *state;
 	string portName;
-	int32_t foundBaudrate;
+	uint32_t expectedBaudrate;
+	bool sensorFound;
+	uint32_t foundBaudrate;
+	uint32_t serialNumber;
+	Thread *thread;
 
-	explicit SearchHelper(const string &portName) :
-		sensorFound(false),
+	PortDiscovery(DiscoveryState *state, const string &portName, uint32_t expectedBaudrate) :
+		state(state),
 		portName(portName),
-		foundBaudrate(0)
+		expectedBaudrate(expectedBaudrate),
+		sensorFound(false),
+		foundBaudrate(0),
+		serialNumber(0),
+		thread(NULL)
 	{ }
 };
 
 void testDataReceivedHandler(void* userData);
-void testValidPacketFoundHandler(void *userData, Packet &packet, size_t runningIndexOfPacketStart, TimeStamp timestamp);
-void searchThread(void* routineData);
+void testValidPacketFoundHandler(void *userData, PacketView &packet, size_t runningIndexOfPacketStart, TimeStamp timestamp);
+void discoveryThread(void* routineData);
 
 // Collection of baudrates to test for sensors. They are listed in order of
 // liklyness and fastness.
 #if __cplusplus >= 201103L
-vector<uint32_t> TestBaudrates { 115200, 128000, 230400, 460800, 921600, 57600, 38400, 19200, 9600 };
+vector<uint32_t> TestBaudrates { 115200, 921600, 230400, 460800, 57600, 38400, 19200, 9600, 128000 };
 #else
-uint32_t TestBaudratesRaw[] = { 115200, 128000, 230400, 460800, 921600, 57600, 38400, 19200, 9600 };
+uint32_t TestBaudratesRaw[] = { 115200, 921600, 230400, 460800, 57600, 38400, 19200, 9600, 128000 };
 #endif
 
-bool Searcher::search(const string &portName, int32_t *foundBaudrate)
+// How long to listen at a baudrate for asynchronous output. Long enough to
+// receive a complete packet of output running at 10 Hz or faster.
+const uint32_t ListenTimeMs = 100;
+
+// How long to wait for the answer to a probe, on top of the time needed to
+// send the probe and its answer at the baudrate being probed.
+const uint32_t ProbeTimeMs = 10;
+
+// Listens to a serial port while its baudrate is being detected. Once open,
+// the port stays open and only its baudrate changes, so the counts are
+// restarted on every change to keep what was received at one baudrate from
+// being credited to the next.
+struct DetectHelper
+{
+	string portName;
+	SerialPort *serialPort;
+	CriticalSection countsCS;
+	PacketFinder *packetFinder;
+	size_t numOfBytesReceived;
+	size_t numOfPacketsFound;
+	bool serialNumberReceived;
+	uint32_t serialNumber;
+	Event packetFound;
+
+	explicit DetectHelper(const string &portName) :
+		portName(portName),
+		serialPort(NULL),
+		packetFinder(NULL),
+		numOfBytesReceived(0),
+		numOfPacketsFound(0),
+		serialNumberReceived(false),
+		serialNumber(0)
+	{ }
+
+	~DetectHelper()
+	{
+		// Closing the port stops the handlers before the packet finder goes.
+		delete serialPort;
+		delete packetFinder;
+	}
+};
+
+void detectDataReceivedHandler(void* userData);
+void detectValidPacketFoundHandler(void *userData, PacketView &packet, size_t runningIndexOfPacketStart, TimeStamp timestamp);
+
+// Switches the port to the baudrate, opening it at that baudrate if it is
+// not open yet, and starts counting afresh. Returns false if the port does
+// not support the baudrate.
+bool useBaudrate(DetectHelper &dh, uint32_t baudrate)
+{
+	bool opening = dh.serialPort == NULL;
+
+	try
+	{
+		if (opening)
+		{
+			// A port is only given its baudrate when it is created, so a
+			// failed open leaves no port behind for the next baudrate.
+			SerialPort *sp = new SerialPort(dh.portName, baudrate);
+
+			try
+			{
+				sp->open();
+			}
+			catch (...)
+			{
+				delete sp;
+
+				throw;
+			}
+
+			dh.serialPort = sp;
+		}
+		else
+		{
+			dh.serialPort->changeBaudrate(baudrate);
+		}
+	}
+	catch (...)
+	{
+		return false;
+	}
+
+	// A new packet finder drops any partial packet from the old baudrate.
+	PacketFinder *pf = new PacketFinder();
+	pf->registerPossiblePacketFoundHandler(&dh, detectValidPacketFoundHandler);
+
+	dh.countsCS.enter();
+
+	delete dh.packetFinder;
+	dh.packetFinder = pf;
+	dh.numOfBytesReceived = 0;
+	dh.numOfPacketsFound = 0;
+	dh.serialNumberReceived = false;
+
+	dh.countsCS.leave();
+
+	if (opening)
+		dh.serialPort->registerDataReceivedHandler(&dh, detectDataReceivedHandler);
+
+	return true;
+}
+
+// Waits for a valid packet to be found at the current baudrate, or only for
+// the answer to a read of the serial number.
+bool waitForPacket(DetectHelper &dh, uint32_t timeoutMs, bool serialNumberOnly = false)
+{
+	Stopwatch sw;
+
+	while (true)
+	{
+		dh.countsCS.enter();
+		bool found = serialNumberOnly ? dh.serialNumberReceived : dh.numOfPacketsFound != 0;
+		dh.countsCS.leave();
+
+		if (found)
+			return true;
+
+		float remainingMs = timeoutMs - sw.elapsedMs();
+
+		if (remainingMs <= 0)
+			return false;
+
+		dh.packetFound.waitUs(static_cast<uint32_t>(remainingMs * 1000));
+	}
+}
+
+// Listens for valid asynchronous output. Sets anyDataReceived if anything at
+// all was received, valid or not.
+bool listen(DetectHelper &dh, bool &anyDataReceived)
+{
+	bool found = waitForPacket(dh, ListenTimeMs);
+
+	dh.countsCS.enter();
+	anyDataReceived = dh.numOfBytesReceived != 0;
+	dh.countsCS.leave();
+
+	return found;
+}
+
+// Sends a command and waits for any valid packet, or only for the answer to
+// a read of the serial number.
+bool probe(DetectHelper &dh, uint32_t baudrate, const char *command, size_t length, bool serialNumberOnly)
+{
+	// Each byte takes ten bits on the line. Allow for the command and an
+	// answer of up to 64 bytes.
+	uint32_t waitMs = ProbeTimeMs + static_cast<uint32_t>((length + 64) * 10 * 1000 / baudrate);
+
+	// A second attempt covers a command mangled by a line still settling.
+	for (size_t i = 0; i < 2; i++)
+	{
+		try
+		{
+			dh.serialPort->write(command, length);
+		}
+		catch (...)
+		{
+			return false;
+		}
+
+		if (waitForPacket(dh, waitMs, serialNumberOnly))
+			return true;
+	}
+
+	return false;
+}
+
+bool isCancelled(DiscoveryState *state)
+{
+	return state != NULL && state->isCancelled();
+}
+
+// Finds the baudrate of the sensor on the port and, when serialNumber is
+// provided, reads its serial number, which is left at 0 if it does not
+// answer. The search is abandoned once the discovery it belongs to is
+// cancelled.
+bool detect(const string &portName, uint32_t expectedBaudrate, DiscoveryState *state, uint32_t *foundBaudrate, uint32_t *serialNumber)
 {
 	#if __cplusplus < 201103L
 	vector<uint32_t> TestBaudrates(TestBaudratesRaw, TestBaudratesRaw + sizeof(TestBaudratesRaw) / sizeof(TestBaudratesRaw[0]));
 	#endif
+
+	const char ReadModelNumber[] = "$VNRRG,01*XX\r\n";
+	const char ReadSerialNumber[] = "$VNRRG,03*XX\r\n";
+
+	vector<uint32_t> baudrates;
+
+	if (expectedBaudrate != 0)
+		baudrates.push_back(expectedBaudrate);
+
 	for (vector<uint32_t>::const_iterator it = TestBaudrates.begin(); it != TestBaudrates.end(); ++it)
 	{
-		uint32_t curBaudrate = *it;
+		if (*it != expectedBaudrate)
+			baudrates.push_back(*it);
+	}
 
-		if (test(portName, curBaudrate))
-		{
-			*foundBaudrate = curBaudrate;
+	DetectHelper dh(portName);
+	bool found = false;
 
-			return true;
+	// A sensor sending asynchronous output produces data at any baudrate,
+	// though only the right one yields valid packets. A line which is silent
+	// at one baudrate is silent at all of them.
+	bool anyDataReceived = true;
+
+	for (vector<uint32_t>::const_iterator it = baudrates.begin(); it != baudrates.end() && !found && anyDataReceived && !isCancelled(state); ++it)
+	{
+		if (!useBaudrate(dh, *it))
+			continue;
+
+		found = listen(dh, anyDataReceived);
+
+		if (found)
+			*foundBaudrate = *it;
+	}
+
+	for (vector<uint32_t>::const_iterator it = baudrates.begin(); it != baudrates.end() && !found && !isCancelled(state); ++it)
+	{
+		if (!useBaudrate(dh, *it))
+			continue;
+
+		found = probe(dh, *it, ReadModelNumber, sizeof(ReadModelNumber) - 1, false);
+
+		if (found)
+			*foundBaudrate = *it;
+	}
+
+	if (found && serialNumber != NULL)
+	{
+		*serialNumber = 0;
+
+		if (probe(dh, *foundBaudrate, ReadSerialNumber, sizeof(ReadSerialNumber) - 1, true))
+		{
+			dh.countsCS.enter();
+			*serialNumber = dh.serialNumber;
+			dh.countsCS.leave();
 		}
 	}
 
-	return false;
+	if (dh.serialPort != NULL)
+		dh.serialPort->close();
+
+	return found;
+}
+
+// The cache holds one line per port with the port name, baudrate and serial
+// number of the sensor last found on it.
+void loadDiscoveryCache(const string &cacheFile, vector<DiscoveredSensor> &entries)
+{
+	ifstream in(cacheFile.c_str());
+	DiscoveredSensor entry;
+
+	while (in >> entry.portName >> entry.baudrate >> entry.serialNumber)
+		entries.push_back(entry);
+}
+
+void saveDiscoveryCache(const string &cacheFile, const vector<DiscoveredSensor> &entries)
+{
+	// The cache only saves time, so failing to write it is not an error.
+	ofstream out(cacheFile.c_str());
+
+	for (vector<DiscoveredSensor>::const_iterator it = entries.begin(); it != entries.end(); ++it)
+		out << it->portName << ' ' << it->baudrate << ' ' << it->serialNumber << '\n';
+}
+
+bool Searcher::search(const string &portName, int32_t *foundBaudrate)
+{
+	uint32_t baudrate;
+
+	if (!detectBaudrate(portName, &baudrate))
+		return false;
+
+	*foundBaudrate = static_cast<int32_t>(baudrate);
+
+	return true;
+}
+
+bool Searcher::detectBaudrate(const string &portName, uint32_t *foundBaudrate, uint32_t expectedBaudrate)
+{
+	return detect(portName, expectedBaudrate, NULL, foundBaudrate, NULL);
 }
 
 vector<pair<string, uint32_t> > Searcher::search()
@@ -79,32 +388,85 @@ vector<pair<string, uint32_t> > Searcher::search()
 
 vector<pair<string, uint32_t> > Searcher::search(vector<string>& portsToCheck)
 {
-	list<SearchHelper*> helpers;
+	vector<DiscoveredSensor> sensors = discover(portsToCheck);
 	vector<pair<string, uint32_t> > result;
 
-	// Start threads to test each port.
+	for (vector<DiscoveredSensor>::const_iterator it = sensors.begin(); it != sensors.end(); ++it)
+		result.push_back(pair<string, uint32_t>(it->portName, it->baudrate));
+
+	return result;
+}
+
+vector<DiscoveredSensor> Searcher::discover(const vector<string> &portsToCheck, size_t expectedNumOfSensors, const string &cacheFile)
+{
+	vector<DiscoveredSensor> cache;
+
+	if (!cacheFile.empty())
+		loadDiscoveryCache(cacheFile, cache);
+
+	DiscoveryState state(expectedNumOfSensors);
+	vector<PortDiscovery*> discoveries;
+
+	// Search every port at once, starting each with the baudrate its sensor
+	// had last time.
 	for (vector<string>::const_iterator it = portsToCheck.begin(); it != portsToCheck.end(); ++it)
 	{
-		SearchHelper *sh = new SearchHelper(*it);
+		uint32_t expectedBaudrate = 0;
 
-		helpers.push_back(sh);
+		for (vector<DiscoveredSensor>::const_iterator c = cache.begin(); c != cache.end(); ++c)
+		{
+			if (c->portName == *it)
+				expectedBaudrate = c->baudrate;
+		}
+
+		PortDiscovery *pd = new PortDiscovery(&state, *it, expectedBaudrate);
+
+		discoveries.push_back(pd);
 
-		Thread::startNew(searchThread, sh);
+		pd->thread = Thread::startNew(discoveryThread, pd);
 	}
 
-	// Wait for each thread to finish.
-	for (list<SearchHelper*>::const_iterator it = helpers.begin(); it != helpers.end(); ++it)
+	vector<DiscoveredSensor> result;
+
+	for (vector<PortDiscovery*>::const_iterator it = discoveries.begin(); it != discoveries.end(); ++it)
 	{
-		SearchHelper* sh = (*it);
+		PortDiscovery *pd = *it;
+
+		pd->thread->join();
 
-		sh->finishedSearchingPort.wait();
+		delete pd->thread;
 
-		if (sh->sensorFound)
+		if (pd->sensorFound)
 		{
-			result.push_back(pair<string, uint32_t>(sh->portName, sh->foundBaudrate));
+			DiscoveredSensor sensor;
+			sensor.portName = pd->portName;
+			sensor.baudrate = pd->foundBaudrate;
+			sensor.serialNumber = pd->serialNumber;
+
+			result.push_back(sensor);
 		}
 
-		delete sh;
+		delete pd;
+	}
+
+	if (!cacheFile.empty() && !result.empty())
+	{
+		// Entries for ports where nothing was found are kept, since the
+		// search may have been cut short.
+		for (vector<DiscoveredSensor>::const_iterator it = result.begin(); it != result.end(); ++it)
+		{
+			vector<DiscoveredSensor>::iterator c = cache.begin();
+
+			while (c != cache.end() && c->portName != it->portName)
+				++c;
+
+			if (c != cache.end())
+				*c = *it;
+			else
+				cache.push_back(*it);
+		}
+
+		saveDiscoveryCache(cacheFile, cache);
 	}
 
 	return result;
@@ -164,13 +526,14 @@ bool Searcher::test(string portName, uint32_t baudrate)
 	return false;
 }
 
-void searchThread(void* routineData)
+void discoveryThread(void* routineData)
 {
-	SearchHelper *sh = static_cast<SearchHelper*>(routineData);
+	PortDiscovery *pd = static_cast<PortDiscovery*>(routineData);
 
-	sh->sensorFound = Searcher::search(sh->portName, &sh->foundBaudrate);
+	pd->sensorFound = detect(pd->portName, pd->expectedBaudrate, pd->state, &pd->foundBaudrate, &pd->serialNumber);
 
-	sh->finishedSearchingPort.signal();
+	if (pd->sensorFound)
+		pd->state->sensorFound();
 }
 
 void testDataReceivedHandler(void* userData)
@@ -185,6 +548,33 @@ void testDataReceivedHandler(void* userData)
 	th->packetFinder->processReceivedData(buffer, numOfBytesRead, false);
 }
 
+void detectDataReceivedHandler(void* userData)
+{
+	DetectHelper *dh = static_cast<DetectHelper*>(userData);
+
+	char buffer[0x100];
+	size_t numOfBytesRead = 0;
+
+	// Reading inside the critical section ties the data to the baudrate it
+	// was received at.
+	dh->countsCS.enter();
+
+	try
+	{
+		dh->serialPort->read(buffer, 0x100, numOfBytesRead);
+	}
+	catch (...)
+	{
+		numOfBytesRead = 0;
+	}
+
+	dh->numOfBytesReceived += numOfBytesRead;
+
+	dh->packetFinder->processReceivedData(buffer, numOfBytesRead, false);
+
+	dh->countsCS.leave();
+}
+
 #if defined(_MSC_VER)
 	#pragma warning(push)
 
@@ -192,13 +582,29 @@ void testDataReceivedHandler(void* userData)
 	#pragma warning(disable:4100)
 #endif
 
-void testValidPacketFoundHandler(void *userData, Packet &packet, size_t runningIndexOfPacketStart, TimeStamp timestamp)
+void testValidPacketFoundHandler(void *userData, PacketView &, size_t, TimeStamp)
 {
 	TestHelper *th = static_cast<TestHelper*>(userData);
 
 	th->waitForCheckingOnPort.signal();
 }
 
+void detectValidPacketFoundHandler(void *userData, PacketView &packet, size_t, TimeStamp)
+{
+	DetectHelper *dh = static_cast<DetectHelper*>(userData);
+
+	// Called with the counts critical section already entered.
+	dh->numOfPacketsFound++;
+
+	if (packet.type() == Packet::TYPE_ASCII && packet.isResponse() && packet.length() > 10 && strncmp(packet.data(), "$VNRRG,03,", 10) == 0)
+	{
+		packet.parseSerialNumber(&dh->serialNumber);
+		dh->serialNumberReceived = true;
+	}
+
+	dh->packetFound.signal();
+}
+
 #if defined (_MSC_VER)
 	#pragma warning(pop)
 #endif
@@ -11,10 +11,14 @@
 #include "vn/compiler.h"
 #include "vn/util.h"
 #include "vn/thread.h"
+#include "vn/commandbuilder.h"
+#include "vn/packetqueue.h"
 
 
 #include <string>
-#include <queue>
+#include <fstream>
+#include <limits>
+#include <utility>
 #include <string.h>
 #include <stdio.h>
 
@@ -72,12 +76,282 @@ char const* sensor_error::what() const throw()
 	return _errorMessage;
 }
 
+namespace {
+
+// Identifies which command a message belongs to.
+struct CommandKey
+{
+	// The three letter name following "$VN".
+	uint32_t Name;
+
+	// The register ID of register reads and writes; otherwise -1.
+	int RegisterId;
+};
+
+// Determines the key of a command or of a response to one. Returns false if
+// the message does not start with a command name.
+bool determineCommandKey(const char* data, size_t length, CommandKey& key)
+{
+	if (length < 6 || data[0] != '$' || data[1] != 'V' || data[2] != 'N')
+		return false;
+
+	key.Name = (static_cast<uint32_t>(static_cast<unsigned char>(data[3])) << 16)
+		| (static_cast<uint32_t>(static_cast<unsigned char>(data[4])) << 8)
+		| static_cast<unsigned char>(data[5]);
+	key.RegisterId = -1;
+
+	if ((data[3] == 'R' || data[3] == 'W') && data[4] == 'R' && data[5] == 'G' && length > 7 && data[6] == ',')
+	{
+		int registerId = 0;
+		size_t i = 7;
+
+		for (; i < length && data[i] >= '0' && data[i] <= '9'; i++)
+			registerId = registerId * 10 + (data[i] - '0');
+
+		if (i > 7)
+			key.RegisterId = registerId;
+	}
+
+	return true;
+}
+
+string identityCacheFile(const string &directory, uint32_t serialNumber)
+{
+	char name[32];
+	CommandBuilder(name, sizeof(name)).append("vnsensor_").appendUnsigned(serialNumber).append(".txt");
+
+	string path = directory;
+
+	if (path[path.length() - 1] != '/' && path[path.length() - 1] != '\\')
+		path += '/';
+
+	return path + name;
+}
+
+// The cache file holds the serial number followed by the model number and
+// hardware revision, one per line.
+bool loadIdentity(const string &file, SensorIdentity &identity)
+{
+	ifstream in(file.c_str());
+	uint32_t serialNumber;
+
+	if (!(in >> serialNumber) || serialNumber != identity.serialNumber)
+		return false;
+
+	in.ignore(numeric_limits<streamsize>::max(), '\n');
+
+	if (!getline(in, identity.modelNumber))
+		return false;
+
+	in >> identity.hardwareRevision;
+
+	// Older cache files hold the firmware version on this line, which must
+	// not be taken for the hardware revision.
+	return !in.fail() && (in.peek() == '\n' || in.eof());
+}
+
+void saveIdentity(const string &file, const SensorIdentity &identity)
+{
+	// The cache only saves time, so failing to write it is not an error.
+	ofstream out(file.c_str());
+
+	out << identity.serialNumber << '\n'
+		<< identity.modelNumber << '\n'
+		<< identity.hardwareRevision << '\n';
+}
+
+// Binary outputs which are turned off produce nothing, whatever their other
+// fields hold.
+bool binaryOutputMatches(const BinaryOutputRegister &current, const BinaryOutputRegister &desired)
+{
+	if (current.asyncMode == ASYNCMODE_NONE && desired.asyncMode == ASYNCMODE_NONE)
+		return true;
+
+	return current.asyncMode == desired.asyncMode
+		&& current.rateDivisor == desired.rateDivisor
+		&& current.commonField == desired.commonField
+		&& current.timeField == desired.timeField
+		&& current.imuField == desired.imuField
+		&& current.gpsField == desired.gpsField
+		&& current.attitudeField == desired.attitudeField
+		&& current.insField == desired.insField
+		&& current.gps2Field == desired.gps2Field;
+}
+
+}
+
+struct PendingTransaction::Impl
+{
+	enum State
+	{
+		STATE_IDLE,				// Never started, or abandoned while in flight.
+		STATE_IN_FLIGHT,		// Waiting for the response.
+		STATE_COMPLETING,		// Out of flight and notifying the handler.
+		STATE_COMPLETED
+	};
+
+	enum Outcome
+	{
+		OUTCOME_RESPONSE,
+		OUTCOME_TIMEOUT,
+		OUTCOME_DISCONNECTED
+	};
+
+	PendingTransaction* BackReference;
+
+	// Guards the state, the outcome, the response and the retransmit count,
+	// which are shared with the threads completing the transaction. When
+	// both are needed, the sensor's transaction critical section is entered
+	// first.
+	CriticalSection StateCS;
+	State CurrentState;
+	Outcome Result;
+	Packet Response;
+	uint32_t Retransmits;
+	xplat::Event CompletedEvent;
+
+	// Only used by the sensor while the transaction is in flight.
+	VnSensor::Impl* Sensor;
+	string Command;
+	// Commands without a key, such as the bootloader's baudrate calibration,
+	// are only answered by responses without one.
+	bool HasKey;
+	CommandKey Key;
+	Stopwatch Clock;
+	float TimeoutAtMs;
+	float NextRetransmitAtMs;
+	uint16_t RetransmitDelayMs;
+	CompletedHandler Handler;
+	void* UserData;
+	Impl* Previous;
+	Impl* Next;
+
+	explicit Impl(PendingTransaction* backReference) :
+		BackReference(backReference),
+		CurrentState(STATE_IDLE),
+		Result(OUTCOME_RESPONSE),
+		Retransmits(0),
+		Sensor(NULL),
+		HasKey(false),
+		TimeoutAtMs(0),
+		NextRetransmitAtMs(0),
+		RetransmitDelayMs(0),
+		Handler(NULL),
+		UserData(NULL),
+		Previous(NULL),
+		Next(NULL)
+	{
+	}
+
+	State state()
+	{
+		StateCS.enter();
+		State s = CurrentState;
+		StateCS.leave();
+
+		return s;
+	}
+};
+
 struct VnSensor::Impl
 {
 	static const size_t DefaultReadBufferSize = 256;
 	static const uint16_t DefaultResponseTimeoutMs = 500;
 	static const uint16_t DefaultRetransmitDelayMs = 200;
 
+	// A worker of the packet pipeline. Every worker consumes its own queue,
+	// so the serial port's thread is the only producer of each queue.
+	struct PipelineWorker : private util::NoCopy
+	{
+		Impl* Owner;
+		PacketQueue Queue;
+		xplat::Event Wakeup;
+		CriticalSection StopCS;
+		bool StopRequested;
+		Thread* WorkerThread;
+		CriticalSection ExceptionsCS;
+		size_t NumOfHandlerExceptions;
+
+		PipelineWorker(Impl* owner, size_t queueCapacity) :
+			Owner(owner),
+			Queue(queueCapacity),
+			StopRequested(false),
+			WorkerThread(NULL),
+			NumOfHandlerExceptions(0)
+		{ }
+
+		size_t numOfHandlerExceptions()
+		{
+			ExceptionsCS.enter();
+			size_t n = NumOfHandlerExceptions;
+			ExceptionsCS.leave();
+
+			return n;
+		}
+
+		void dispatchQueuedPackets()
+		{
+			size_t length;
+			size_t runningIndex;
+			TimeStamp timestamp;
+			char* data;
+
+			while ((data = Queue.front(length, runningIndex, timestamp)) != NULL)
+			{
+				PacketView packet(data, length);
+
+				// A handler which throws only loses its own packet, which is
+				// counted in the statistics.
+				try
+				{
+					Owner->dispatchAsyncPacket(packet, runningIndex, timestamp);
+				}
+				catch (...)
+				{
+					ExceptionsCS.enter();
+					NumOfHandlerExceptions++;
+					ExceptionsCS.leave();
+				}
+
+				Queue.pop();
+			}
+		}
+
+		static void workerRoutine(void* routineData)
+		{
+			PipelineWorker* pThis = static_cast<PipelineWorker*>(routineData);
+
+			while (true)
+			{
+				// The request is read before the queue is emptied, so every
+				// packet queued before the worker was stopped is dispatched.
+				pThis->StopCS.enter();
+				bool isStopping = pThis->StopRequested;
+				pThis->StopCS.leave();
+
+				pThis->dispatchQueuedPackets();
+
+				if (isStopping)
+					return;
+
+				pThis->Wakeup.wait();
+			}
+		}
+
+		void stop()
+		{
+			StopCS.enter();
+			StopRequested = true;
+			StopCS.leave();
+
+			Wakeup.signal();
+			WorkerThread->join();
+
+			delete WorkerThread;
+			WorkerThread = NULL;
+		}
+	};
+
 	SerialPort *pSerialPort;
 	char readBuffer[DefaultReadBufferSize];
 	IPort* port;
@@ -93,15 +367,27 @@ struct VnSensor::Impl
 	void* _asyncPacketReceivedUserData;
 	ErrorDetectionMode _sendErrorDetectionMode;
 	VnSensor* BackReference;
-	queue<Packet> _receivedResponses;
+	// Guards the list of transactions in flight and the writes of commands
+	// to the port, so the list stays in the order the sensor sees them.
 	CriticalSection _transactionCS;
-	bool _waitingForResponse;
+	PendingTransaction::Impl* _inFlightHead;
+	PendingTransaction::Impl* _inFlightTail;
+	Thread* _transactionThread;
+	bool _transactionThreadRunning;
+	// Completed transactions of synchronous commands, kept for reuse so that
+	// a command and its response do not allocate once there is one for each
+	// concurrent caller.
+	vector<PendingTransaction*> _idleTransactions;
+	xplat::Event _transactionThreadEvent;
 	bool _filteringBootloaderResponses;
 	ErrorPacketReceivedHandler _errorPacketReceivedHandler;
 	void* _errorPacketReceivedUserData;
 	uint16_t _responseTimeoutMs;
 	uint16_t _retransmitDelayMs;
-	xplat::Event _newResponsesEvent;
+	// Guards the workers, which the serial port's thread uses to queue
+	// packets.
+	CriticalSection _pipelineCS;
+	vector<PipelineWorker*> _pipelineWorkers;
 	#if PYTHON
 	PyObject* _rawDataReceivedHandlerPython;
 	PyObject* _asyncPacketReceivedHandlerPython;
@@ -121,7 +407,10 @@ struct VnSensor::Impl
 		_asyncPacketReceivedUserData(NULL),
 		_sendErrorDetectionMode(ERRORDETECTIONMODE_CHECKSUM),
 		BackReference(backReference),
-		_waitingForResponse(false),
+		_inFlightHead(NULL),
+		_inFlightTail(NULL),
+		_transactionThread(NULL),
+		_transactionThreadRunning(false),
 		_filteringBootloaderResponses(false),
 		_errorPacketReceivedHandler(NULL),
 		_errorPacketReceivedUserData(NULL),
@@ -139,15 +428,23 @@ struct VnSensor::Impl
 	~Impl()
 	{
         _packetFinder.unregisterPossiblePacketFoundHandler();
+
+		stopTransactionThread();
+		abortTransactionsInFlight();
+
+		for (size_t i = 0; i < _idleTransactions.size(); i++)
+			delete _idleTransactions[i];
+
+		stopPipelineWorkers(_pipelineWorkers);
 	}
 
-	void onPossiblePacketFound(Packet& possiblePacket, size_t packetStartRunningIndex)
+	void onPossiblePacketFound(PacketView& possiblePacket, size_t packetStartRunningIndex)
 	{
 		if (_possiblePacketFoundHandler != NULL)
 			_possiblePacketFoundHandler(_possiblePacketFoundUserData, possiblePacket, packetStartRunningIndex);
 	}
 
-	void onAsyncPacketReceived(Packet& asciiPacket, size_t runningIndex, TimeStamp timestamp)
+	void onAsyncPacketReceived(PacketView& asciiPacket, size_t runningIndex, TimeStamp timestamp)
 	{
 
 		if (_asyncPacketReceivedHandler != NULL)
@@ -167,19 +464,130 @@ struct VnSensor::Impl
 		//#endif
 	}
 
-	void onErrorPacketReceived(Packet& errorPacket, size_t runningIndex)
+	void onErrorPacketReceived(PacketView& errorPacket, size_t runningIndex)
 	{
 		if (_errorPacketReceivedHandler != NULL)
 			_errorPacketReceivedHandler(_errorPacketReceivedUserData, errorPacket, runningIndex);
 	}
 
-	static void possiblePacketFoundHandler(void* userData, Packet& possiblePacket, size_t packetStartRunningIndex, TimeStamp timestamp)
+	// Checks a packet which was classified as asynchronous and, if it is
+	// valid, notifies the handlers.
+	void dispatchAsyncPacket(PacketView& asyncPacket, size_t runningIndex, TimeStamp timestamp)
+	{
+		bool valid;
+		if (!asyncPacket.tryIsValid(valid) || !valid)
+			return;
+
+		onAsyncPacketReceived(asyncPacket, runningIndex, timestamp);
+	}
+
+	// Chooses the worker for a packet from its type, which is the message
+	// name of an ASCII packet and the group and field selection of a binary
+	// packet. Packets of the same type therefore stay in order.
+	PipelineWorker* pipelineWorkerFor(const PacketView& packet)
+	{
+		if (_pipelineWorkers.size() == 1)
+			return _pipelineWorkers[0];
+
+		const char* data = packet.data();
+		size_t length = packet.length();
+		size_t typeEnd;
+
+		if (static_cast<unsigned char>(data[0]) == 0xFA && length > 1)
+		{
+			typeEnd = 2;
+			for (uint8_t groups = static_cast<uint8_t>(data[1]); groups != 0; groups >>= 1)
+				typeEnd += 2 * (groups & 1);
+		}
+		else
+		{
+			// Skips the '$' and covers the five character message name.
+			typeEnd = 6;
+		}
+
+		if (typeEnd > length)
+			typeEnd = length;
+
+		// FNV-1a hash of the type.
+		uint32_t hash = 2166136261u;
+		for (size_t i = 1; i < typeEnd; i++)
+		{
+			hash ^= static_cast<uint8_t>(data[i]);
+			hash *= 16777619u;
+		}
+
+		return _pipelineWorkers[hash % _pipelineWorkers.size()];
+	}
+
+	// Hands a packet to its worker without checking its integrity, which is
+	// left to the worker.
+	void queueAsyncPacket(PacketView& asyncPacket, size_t runningIndex, TimeStamp timestamp)
+	{
+		PipelineWorker* worker = pipelineWorkerFor(asyncPacket);
+
+		if (worker->Queue.push(asyncPacket, runningIndex, timestamp))
+			worker->Wakeup.signal();
+	}
+
+	// Replaces the workers of the pipeline with the provided ones. The
+	// previous workers are stopped before the lock is released, so the
+	// packets they still hold are dispatched before any packet received
+	// afterwards.
+	void replacePipelineWorkers(vector<PipelineWorker*> &workers)
+	{
+		_pipelineCS.enter();
+
+		_pipelineWorkers.swap(workers);
+
+		stopPipelineWorkers(workers);
+
+		_pipelineCS.leave();
+	}
+
+	static void stopPipelineWorkers(vector<PipelineWorker*> &workers)
+	{
+		for (size_t i = 0; i < workers.size(); i++)
+		{
+			if (workers[i]->WorkerThread != NULL)
+				workers[i]->stop();
+
+			delete workers[i];
+		}
+
+		workers.clear();
+	}
+
+	static void possiblePacketFoundHandler(void* userData, PacketView& possiblePacket, size_t packetStartRunningIndex, TimeStamp timestamp)
 	{
 		Impl* pThis = static_cast<Impl*>(userData);
 
 		pThis->onPossiblePacketFound(possiblePacket, packetStartRunningIndex);
 
-		if (!possiblePacket.isValid())
+		// With the pipeline enabled, asynchronous packets are only classified
+		// here and the workers do the rest. While bootloader responses are
+		// being filtered, every packet is still checked here so that only a
+		// valid packet turns the filter off.
+		if (!pThis->_filteringBootloaderResponses
+			&& !possiblePacket.isError()
+			&& !possiblePacket.isResponse())
+		{
+			pThis->_pipelineCS.enter();
+
+			bool isQueued = !pThis->_pipelineWorkers.empty();
+
+			if (isQueued)
+				pThis->queueAsyncPacket(possiblePacket, packetStartRunningIndex, timestamp);
+
+			pThis->_pipelineCS.leave();
+
+			if (isQueued)
+				return;
+		}
+
+		// Packets of an unknown type are dropped along with invalid ones
+		// rather than throwing on the serial port's thread.
+		bool valid;
+		if (!possiblePacket.tryIsValid(valid) || !valid)
 		{
 			return;
 		}
@@ -192,13 +600,7 @@ struct VnSensor::Impl
 
 		if (possiblePacket.isError())
 		{
-			if (pThis->_waitingForResponse)
-			{
-				pThis->_transactionCS.enter();
-				pThis->_receivedResponses.push(possiblePacket);
-				pThis->_newResponsesEvent.signal();
-				pThis->_transactionCS.leave();
-			}
+			pThis->completeTransactionWithResponse(possiblePacket);
 
 			pThis->onErrorPacketReceived(possiblePacket, packetStartRunningIndex);
 
@@ -207,13 +609,7 @@ struct VnSensor::Impl
 
 		if (possiblePacket.isResponse())
 		{
-			if (pThis->_waitingForResponse)
-			{
-				pThis->_transactionCS.enter();
-				pThis->_receivedResponses.push(possiblePacket);
-				pThis->_newResponsesEvent.signal();
-				pThis->_transactionCS.leave();
-			}
+			pThis->completeTransactionWithResponse(possiblePacket);
 
 			return;
 		}
@@ -264,125 +660,394 @@ struct VnSensor::Impl
 
 	size_t finalizeCommandToSend(char *toSend, size_t length)
 	{
-		#if defined(_MSC_VER)
-			// Unable to use save version 'sprintf_s' since the length of 'toSend' is unknown here.
-			#pragma warning(push)
-			#pragma warning(disable:4996)
-		#endif
-		
+		// The length of 'toSend' is unknown here, so only allow room for the
+		// longest ending.
+		CommandBuilder command(toSend + length, sizeof("FFFF\r\n"));
+
 		if (_sendErrorDetectionMode == ERRORDETECTIONMODE_CHECKSUM)
 		{
-			length += sprintf(toSend + length, "%02X\r\n", Checksum8::compute(toSend + 1, length - 2));
+			command.appendHex(Checksum8::compute(toSend + 1, length - 2), 2).append("\r\n");
 		}
 		else if (_sendErrorDetectionMode == ERRORDETECTIONMODE_CRC)
 		{
-			length += sprintf(toSend + length, "%04X\r\n", Crc16::compute(toSend + 1, length - 2));
+			command.appendHex(Crc16::compute(toSend + 1, length - 2), 4).append("\r\n");
 		}
 		else
 		{
-			length += sprintf(toSend + length, "XX\r\n");
+			command.append("XX\r\n");
 		}
 
-		#if defined(_MSC_VER)
-			#pragma warning(pop)
-		#endif
+		return length + command.length();
+	}
 
-		return length;
+	void linkInFlight(PendingTransaction::Impl* t)
+	{
+		t->Previous = _inFlightTail;
+		t->Next = NULL;
+
+		if (_inFlightTail != NULL)
+			_inFlightTail->Next = t;
+		else
+			_inFlightHead = t;
+
+		_inFlightTail = t;
 	}
 
-	Packet transactionWithWait(char* toSend, size_t length, uint16_t responseTimeoutMs, uint16_t retransmitDelayMs)
+	void unlinkInFlight(PendingTransaction::Impl* t)
+	{
+		if (t->Previous != NULL)
+			t->Previous->Next = t->Next;
+		else
+			_inFlightHead = t->Next;
+
+		if (t->Next != NULL)
+			t->Next->Previous = t->Previous;
+		else
+			_inFlightTail = t->Previous;
+
+		t->Previous = NULL;
+		t->Next = NULL;
+	}
+
+	void beginTransaction(PendingTransaction::Impl* t, const char* toSend, size_t length, uint16_t responseTimeoutMs, uint16_t retransmitDelayMs, PendingTransaction::CompletedHandler handler, void* userData)
 	{
-		// Make sure we don't have any existing responses.
 		_transactionCS.enter();
+		t->StateCS.enter();
 
-		#if VN_SUPPORTS_SWAP
-		queue<Packet> empty;
-		_receivedResponses.swap(empty);
-		#else
-		while (!_receivedResponses.empty()) _receivedResponses.pop();
-		#endif
-		_waitingForResponse = true;
-		_transactionCS.leave();
+		if (!isConnected() || t->CurrentState == PendingTransaction::Impl::STATE_IN_FLIGHT || t->CurrentState == PendingTransaction::Impl::STATE_COMPLETING)
+		{
+			t->StateCS.leave();
+			_transactionCS.leave();
 
-		// Send the command and continue sending if retransmits are enabled
-		// until we receive the response or timeout.
-		Stopwatch timeoutSw;
+			throw invalid_operation();
+		}
 
-		port->write(toSend, length);
-		float curElapsedTime = timeoutSw.elapsedMs();
+		t->CurrentState = PendingTransaction::Impl::STATE_IN_FLIGHT;
+		t->Response = Packet();
+		t->Retransmits = 0;
+		t->Sensor = this;
+		t->StateCS.leave();
 
-		while (true)
+		t->Command.assign(toSend, length);
+		t->HasKey = determineCommandKey(toSend, length, t->Key);
+		t->Clock.reset();
+		t->TimeoutAtMs = responseTimeoutMs;
+		t->RetransmitDelayMs = retransmitDelayMs;
+		t->NextRetransmitAtMs = retransmitDelayMs;
+		t->Handler = handler;
+		t->UserData = userData;
+
+		linkInFlight(t);
+
+		try
 		{
-			bool shouldRetransmit = false;
+			port->write(toSend, length);
 
-			// Compute how long we should wait for a response before taking
-			// more action.
-			float responseWaitTime = responseTimeoutMs - curElapsedTime;
-			if (responseWaitTime > retransmitDelayMs)
+			if (_transactionThread == NULL)
 			{
-				responseWaitTime = retransmitDelayMs;
-				shouldRetransmit = true;
+				_transactionThreadRunning = true;
+				_transactionThread = Thread::startNew(transactionThreadRoutine, this);
 			}
+		}
+		catch (...)
+		{
+			unlinkInFlight(t);
+
+			t->StateCS.enter();
+			t->CurrentState = PendingTransaction::Impl::STATE_IDLE;
+			t->Sensor = NULL;
+			t->StateCS.leave();
+
+			_transactionCS.leave();
+
+			throw;
+		}
+
+		_transactionCS.leave();
+
+		// Let the transaction thread account for the new deadlines.
+		_transactionThreadEvent.signal();
+	}
 
-			// See if we have time left.
-			if (responseWaitTime < 0)
+	// Takes the transaction the response belongs to out of flight and
+	// completes it. Responses that belong to no transaction, such as the
+	// answers to retransmits of a completed command, are ignored.
+	void completeTransactionWithResponse(PacketView& response)
+	{
+		PendingTransaction::Impl* t = NULL;
+
+		_transactionCS.enter();
+
+		if (response.isError())
+		{
+			// Errors do not say which command they belong to, but the sensor
+			// answers commands in order.
+			t = _inFlightHead;
+		}
+		else
+		{
+			CommandKey key;
+			bool hasKey = determineCommandKey(response.data(), response.length(), key);
+
+			// The response echoes the command and register it answers.
+			for (t = _inFlightHead; t != NULL; t = t->Next)
 			{
-				_waitingForResponse = false;
-				throw timeout();
+				if (t->HasKey != hasKey)
+					continue;
+
+				if (!hasKey || (t->Key.Name == key.Name && t->Key.RegisterId == key.RegisterId))
+					break;
 			}
+		}
 
-			// Wait for any new responses that come in or until it is time to
-			// send a new retransmit.
-			xplat::Event::WaitResult waitResult = _newResponsesEvent.waitUs(static_cast<uint32_t>(responseWaitTime * 1000));
+		if (t != NULL)
+		{
+			unlinkInFlight(t);
 
-			queue<Packet> responsesToProcess;
+			t->StateCS.enter();
+			t->CurrentState = PendingTransaction::Impl::STATE_COMPLETING;
+			t->Result = PendingTransaction::Impl::OUTCOME_RESPONSE;
+			t->Response = response;
+			t->StateCS.leave();
+		}
+
+		_transactionCS.leave();
 
-			if (waitResult == xplat::Event::WAIT_TIMEDOUT)
+		if (t != NULL)
+			finishTransaction(t);
+	}
+
+	// Notifies the handler of a transaction that has been taken out of
+	// flight and then marks it as completed.
+	static void finishTransaction(PendingTransaction::Impl* t)
+	{
+		if (t->Handler != NULL)
+			t->Handler(t->UserData, *t->BackReference);
+
+		t->StateCS.enter();
+		t->CurrentState = PendingTransaction::Impl::STATE_COMPLETED;
+		t->Sensor = NULL;
+		t->CompletedEvent.signal();
+		t->StateCS.leave();
+	}
+
+	void abandonTransaction(PendingTransaction::Impl* t)
+	{
+		_transactionCS.enter();
+
+		t->StateCS.enter();
+
+		if (t->CurrentState == PendingTransaction::Impl::STATE_IN_FLIGHT)
+		{
+			unlinkInFlight(t);
+			t->CurrentState = PendingTransaction::Impl::STATE_IDLE;
+			t->Sensor = NULL;
+		}
+
+		t->StateCS.leave();
+
+		_transactionCS.leave();
+	}
+
+	// Fails every transaction in flight, for when the port goes away.
+	void abortTransactionsInFlight()
+	{
+		while (true)
+		{
+			_transactionCS.enter();
+
+			PendingTransaction::Impl* t = _inFlightHead;
+
+			if (t != NULL)
 			{
-				if (!shouldRetransmit)
-				{
-					_waitingForResponse = false;
-					throw timeout();
-				}
+				unlinkInFlight(t);
+
+				t->StateCS.enter();
+				t->CurrentState = PendingTransaction::Impl::STATE_COMPLETING;
+				t->Result = PendingTransaction::Impl::OUTCOME_DISCONNECTED;
+				t->StateCS.leave();
 			}
 
-			if (waitResult == xplat::Event::WAIT_SIGNALED)
+			_transactionCS.leave();
+
+			if (t == NULL)
+				return;
+
+			finishTransaction(t);
+		}
+	}
+
+	// Retransmits the commands which are due and times out the ones which
+	// have run out of time. Returns the number of milliseconds until the
+	// next deadline.
+	float serviceTransactionsInFlight()
+	{
+		// Upper bound on the wait when nothing is in flight. New commands
+		// signal the thread anyway.
+		const float IdleWaitMs = 1000;
+
+		PendingTransaction::Impl* timedOut = NULL;
+		float nextDeadlineMs = IdleWaitMs;
+
+		_transactionCS.enter();
+
+		PendingTransaction::Impl* next;
+		for (PendingTransaction::Impl* t = _inFlightHead; t != NULL; t = next)
+		{
+			next = t->Next;
+
+			float elapsedMs = t->Clock.elapsedMs();
+
+			if (elapsedMs >= t->TimeoutAtMs)
 			{
-				// Get the current collection of responses.
-				_transactionCS.enter();
-				#if VN_SUPPORTS_SWAP
-				_receivedResponses.swap(responsesToProcess);
-				#else
-				while (!_receivedResponses.empty())
-				{
-					responsesToProcess.push(_receivedResponses.front());
-					_receivedResponses.pop();
-				}
-				#endif
-				_transactionCS.leave();
+				unlinkInFlight(t);
+
+				t->StateCS.enter();
+				t->CurrentState = PendingTransaction::Impl::STATE_COMPLETING;
+				t->Result = PendingTransaction::Impl::OUTCOME_TIMEOUT;
+				t->StateCS.leave();
+
+				t->Next = timedOut;
+				timedOut = t;
+
+				continue;
 			}
 
-			// Process the collection of responses we have.
-			while (!responsesToProcess.empty())
-			{
-				Packet p = responsesToProcess.front();
-				responsesToProcess.pop();
+			// A command is only retransmitted while the retransmit delay
+			// ends before the timeout. A delay of zero turns retransmits off.
+			bool retransmits = t->RetransmitDelayMs != 0 && t->NextRetransmitAtMs < t->TimeoutAtMs;
 
-				if (p.isError())
+			if (retransmits && elapsedMs >= t->NextRetransmitAtMs)
+			{
+				try
+				{
+					if (isConnected())
+						port->write(t->Command.c_str(), t->Command.length());
+				}
+				catch (...)
 				{
-					_waitingForResponse = false;
-					throw sensor_error(p.parseError());
+					// The timeout still applies if the port fails.
 				}
 
-				// We must have a response packet.
-				_waitingForResponse = false;
-				Thread::sleepMs(1);
-				return p;
+				t->StateCS.enter();
+				t->Retransmits++;
+				t->StateCS.leave();
+
+				t->NextRetransmitAtMs = elapsedMs + t->RetransmitDelayMs;
+				retransmits = t->NextRetransmitAtMs < t->TimeoutAtMs;
 			}
 
-			// Retransmit.
-			port->write(toSend, length);
-			curElapsedTime = timeoutSw.elapsedMs();
+			float deadlineMs = (retransmits ? t->NextRetransmitAtMs : t->TimeoutAtMs) - elapsedMs;
+
+			if (deadlineMs < nextDeadlineMs)
+				nextDeadlineMs = deadlineMs;
+		}
+
+		_transactionCS.leave();
+
+		while (timedOut != NULL)
+		{
+			PendingTransaction::Impl* t = timedOut;
+			timedOut = t->Next;
+			t->Next = NULL;
+
+			finishTransaction(t);
+		}
+
+		return nextDeadlineMs;
+	}
+
+	static void transactionThreadRoutine(void* routineData)
+	{
+		Impl* pThis = static_cast<Impl*>(routineData);
+
+		while (true)
+		{
+			pThis->_transactionCS.enter();
+			bool isRunning = pThis->_transactionThreadRunning;
+			pThis->_transactionCS.leave();
+
+			if (!isRunning)
+				return;
+
+			float waitMs = pThis->serviceTransactionsInFlight();
+
+			if (waitMs > 0)
+				pThis->_transactionThreadEvent.waitUs(static_cast<uint32_t>(waitMs * 1000) + 1);
+		}
+	}
+
+	void stopTransactionThread()
+	{
+		_transactionCS.enter();
+		Thread* thread = _transactionThread;
+		_transactionThreadRunning = false;
+		_transactionThread = NULL;
+		_transactionCS.leave();
+
+		if (thread == NULL)
+			return;
+
+		_transactionThreadEvent.signal();
+		thread->join();
+
+		delete thread;
+	}
+
+	// Takes a transaction for a synchronous command from the idle ones, or
+	// creates one if all are in use.
+	PendingTransaction* acquireTransaction()
+	{
+		_transactionCS.enter();
+
+		PendingTransaction* t = NULL;
+
+		if (!_idleTransactions.empty())
+		{
+			t = _idleTransactions.back();
+			_idleTransactions.pop_back();
+		}
+
+		_transactionCS.leave();
+
+		return t != NULL ? t : new PendingTransaction();
+	}
+
+	void releaseTransaction(PendingTransaction* t)
+	{
+		_transactionCS.enter();
+
+		try
+		{
+			_idleTransactions.push_back(t);
+		}
+		catch (...)
+		{
+			delete t;
+		}
+
+		_transactionCS.leave();
+	}
+
+	Packet transactionWithWait(char* toSend, size_t length, uint16_t responseTimeoutMs, uint16_t retransmitDelayMs)
+	{
+		PendingTransaction* t = acquireTransaction();
+
+		try
+		{
+			beginTransaction(t->_pi, toSend, length, responseTimeoutMs, retransmitDelayMs, NULL, NULL);
+
+			Packet response(t->wait());
+
+			releaseTransaction(t);
+
+			return response;
+		}
+		catch (...)
+		{
+			releaseTransaction(t);
+
+			throw;
 		}
 	}
 
@@ -400,7 +1065,24 @@ struct VnSensor::Impl
 		}
 		else
 		{
-			port->write(toSend, length);
+			// The transaction thread writes retransmits to the same port.
+			_transactionCS.enter();
+
+			try
+			{
+				if (!isConnected())
+					throw invalid_operation();
+
+				port->write(toSend, length);
+			}
+			catch (...)
+			{
+				_transactionCS.leave();
+
+				throw;
+			}
+
+			_transactionCS.leave();
 		}
 	}
 
@@ -424,19 +1106,19 @@ struct VnSensor::Impl
 		transaction(toSend, length, waitForReply, response, _responseTimeoutMs, _retransmitDelayMs);
 	}
 
-	BinaryOutputRegister readBinaryOutput(uint8_t binaryOutputNumber)
+	// Builds the command to read a binary output register, up to the
+	// checksum.
+	static size_t genReadBinaryOutput(uint8_t binaryOutputNumber, char* toSend, size_t size)
 	{
-		char toSend[17];
-		Packet response;
-		uint16_t asyncMode, rateDivisor, outputGroup, commonField, timeField, imuField, gpsField, attitudeField, insField, gps2Field;
+		CommandBuilder command(toSend, size);
+		command.append("$VNRRG,").appendUnsigned(74 + binaryOutputNumber).append('*');
 
-		#if VN_HAVE_SECURE_CRT
-		int length = sprintf_s(toSend, sizeof(toSend), "$VNRRG,%u*", 74 + binaryOutputNumber);
-		#else
-		int length = sprintf(toSend, "$VNRRG,%u*", 74 + binaryOutputNumber);
-		#endif
+		return command.length();
+	}
 
-		transaction(toSend, length, true, &response);
+	static BinaryOutputRegister parseBinaryOutput(PacketView &response)
+	{
+		uint16_t asyncMode, rateDivisor, outputGroup, commonField, timeField, imuField, gpsField, attitudeField, insField, gps2Field;
 
 		response.parseBinaryOutput(
 			&asyncMode,
@@ -462,11 +1144,22 @@ struct VnSensor::Impl
       static_cast<GpsGroup>(gps2Field));
 	}
 
-	void writeBinaryOutput(uint8_t binaryOutputNumber, BinaryOutputRegister &fields, bool waitForReply)
+	BinaryOutputRegister readBinaryOutput(uint8_t binaryOutputNumber)
 	{
-		char toSend[256];
+		char toSend[17];
 		Packet response;
 
+		size_t length = genReadBinaryOutput(binaryOutputNumber, toSend, sizeof(toSend));
+
+		transaction(toSend, length, true, &response);
+
+		return parseBinaryOutput(response);
+	}
+
+	// Builds the command to write a binary output register, up to the
+	// checksum.
+	static size_t genWriteBinaryOutput(uint8_t binaryOutputNumber, const BinaryOutputRegister &fields, char* toSend, size_t size)
+	{
 		// First determine which groups are present.
 		uint16_t groups = 0;
 		if (fields.commonField)
@@ -484,62 +1177,58 @@ struct VnSensor::Impl
     if(fields.gps2Field)
       groups |= 0x0040;
 
-		#if VN_HAVE_SECURE_CRT
-		int length = sprintf_s(toSend, sizeof(toSend), "$VNWRG,%u,%u,%u,%X", 74 + binaryOutputNumber, fields.asyncMode, fields.rateDivisor, groups);
-		#else
-		int length = sprintf(toSend, "$VNWRG,%u,%u,%u,%X", 74 + binaryOutputNumber, fields.asyncMode, fields.rateDivisor, groups);
-		#endif
+		CommandBuilder command(toSend, size);
+		command.append("$VNWRG,").appendUnsigned(74 + binaryOutputNumber)
+			.append(',').appendUnsigned(fields.asyncMode)
+			.append(',').appendUnsigned(fields.rateDivisor)
+			.append(',').appendHex(groups);
 
 		if (fields.commonField)
-			#if VN_HAVE_SECURE_CRT
-			length += sprintf_s(toSend + length, sizeof(toSend) - length, ",%X", fields.commonField);
-			#else
-			length += sprintf(toSend + length, ",%X", fields.commonField);
-			#endif
+			command.append(',').appendHex(fields.commonField);
 		if (fields.timeField)
-			#if VN_HAVE_SECURE_CRT
-			length += sprintf_s(toSend + length, sizeof(toSend) - length, ",%X", fields.timeField);
-			#else
-			length += sprintf(toSend + length, ",%X", fields.timeField);
-			#endif
+			command.append(',').appendHex(fields.timeField);
 		if (fields.imuField)
-			#if VN_HAVE_SECURE_CRT
-			length += sprintf_s(toSend + length, sizeof(toSend) - length, ",%X", fields.imuField);
-			#else
-			length += sprintf(toSend + length, ",%X", fields.imuField);
-			#endif
+			command.append(',').appendHex(fields.imuField);
 		if (fields.gpsField)
-			#if VN_HAVE_SECURE_CRT
-			length += sprintf_s(toSend + length, sizeof(toSend) - length, ",%X", fields.gpsField);
-			#else
-			length += sprintf(toSend + length, ",%X", fields.gpsField);
-			#endif
+			command.append(',').appendHex(fields.gpsField);
 		if (fields.attitudeField)
-			#if VN_HAVE_SECURE_CRT
-			length += sprintf_s(toSend + length, sizeof(toSend) - length, ",%X", fields.attitudeField);
-			#else
-			length += sprintf(toSend + length, ",%X", fields.attitudeField);
-			#endif
+			command.append(',').appendHex(fields.attitudeField);
 		if (fields.insField)
-			#if VN_HAVE_SECURE_CRT
-			length += sprintf_s(toSend + length, sizeof(toSend) - length, ",%X", fields.insField);
-			#else
-			length += sprintf(toSend + length, ",%X", fields.insField);
-			#endif
-    if(fields.gps2Field)
-      #if VN_HAVE_SECURE_CRT
-      length += sprintf_s(toSend + length, sizeof(toSend) - length, ",%X", fields.gps2Field);
-      #else
-      length += sprintf(toSend + length, ",%X", fields.gps2Field);
-      #endif
-
-		#if VN_HAVE_SECURE_CRT
-		length += sprintf_s(toSend + length, sizeof(toSend) - length, "*");
-		#else
-		length += sprintf(toSend + length, "*");
-		#endif
+			command.append(',').appendHex(fields.insField);
+		if (fields.gps2Field)
+			command.append(',').appendHex(fields.gps2Field);
+
+		command.append('*');
+
+		return command.length();
+	}
+
+	// Lets the packet finder know what the sensor will now be sending.
+	void expectBinaryOutput(uint8_t binaryOutputNumber, const BinaryOutputRegister &fields)
+	{
+		if (fields.asyncMode == ASYNCMODE_NONE)
+			_packetFinder.unregisterExpectedBinaryOutput(binaryOutputNumber);
+		else
+			_packetFinder.registerExpectedBinaryOutput(binaryOutputNumber, fields.commonField, fields.timeField, fields.imuField, fields.gpsField, fields.attitudeField, fields.insField, fields.gps2Field);
+	}
+
+	void writeBinaryOutput(uint8_t binaryOutputNumber, BinaryOutputRegister &fields, bool waitForReply)
+	{
+		char toSend[256];
+		Packet response;
+
+		size_t length = genWriteBinaryOutput(binaryOutputNumber, fields, toSend, sizeof(toSend));
 
 		transaction(toSend, length, waitForReply, &response);
+
+		expectBinaryOutput(binaryOutputNumber, fields);
+	}
+
+	// Starts a transaction for a finished command using the current
+	// response timeout and retransmit delay.
+	void beginTransaction(PendingTransaction &transaction, char* toSend, size_t length)
+	{
+		beginTransaction(transaction._pi, toSend, length, _responseTimeoutMs, _retransmitDelayMs, NULL, NULL);
 	}
 };
 
@@ -631,6 +1320,16 @@ void VnSensor::setResponseTimeoutMs(uint16_t timeout)
 	_pi->_responseTimeoutMs = timeout;
 }
 
+bool VnSensor::rejectUnexpectedBinaryOutputs()
+{
+	return _pi->_packetFinder.rejectUnexpectedBinaryOutputs();
+}
+
+void VnSensor::setRejectUnexpectedBinaryOutputs(bool reject)
+{
+	_pi->_packetFinder.setRejectUnexpectedBinaryOutputs(reject);
+}
+
 uint16_t VnSensor::retransmitDelayMs()
 {
 	return _pi->_retransmitDelayMs;
@@ -666,6 +1365,11 @@ void VnSensor::connect(IPort* simplePort)
 	_pi->port = simplePort;
 	_pi->SimplePortIsOurs = false;
 
+	// We do not know how a newly connected sensor's binary outputs are
+	// configured until they are written.
+	for (uint8_t i = 1; i <= 3; i++)
+		_pi->_packetFinder.unregisterExpectedBinaryOutput(i);
+
 	_pi->port->registerDataReceivedHandler(_pi, Impl::dataReceivedHandler);
 
 	if (!_pi->port->isOpen())
@@ -682,6 +1386,15 @@ void VnSensor::disconnect()
 
 	_pi->port->unregisterDataReceivedHandler();
 
+	// Nothing more will be received, so the commands in flight cannot
+	// complete.
+	_pi->stopTransactionThread();
+	_pi->abortTransactionsInFlight();
+
+	// Commands are written to the port under the transaction lock, so it is
+	// also held while the port goes away.
+	_pi->_transactionCS.enter();
+
 	if (_pi->DidWeOpenSimplePort)
 	{
 		_pi->port->close();
@@ -698,10 +1411,15 @@ void VnSensor::disconnect()
 
 	if (_pi->pSerialPort != NULL)
 	{
+		if (_pi->port == dynamic_cast<IPort*>(_pi->pSerialPort))
+			_pi->port = NULL;
+
 		// Assuming we created this serial port.
 		delete _pi->pSerialPort;
 		_pi->pSerialPort = NULL;
 	}
+
+	_pi->_transactionCS.leave();
 }
 
 string VnSensor::transaction(string toSend)
@@ -731,17 +1449,96 @@ string VnSensor::transaction(string toSend)
 	return response.datastr();
 }
 
+void VnSensor::beginTransaction(PendingTransaction& transaction, const char* toSend, size_t length, PendingTransaction::CompletedHandler handler, void* userData)
+{
+	_pi->beginTransaction(transaction._pi, toSend, length, _pi->_responseTimeoutMs, _pi->_retransmitDelayMs, handler, userData);
+}
+
+PendingTransaction::PendingTransaction() :
+	_pi(new Impl(this))
+{
+}
+
+PendingTransaction::~PendingTransaction()
+{
+	_pi->StateCS.enter();
+	Impl::State state = _pi->CurrentState;
+	VnSensor::Impl* sensor = _pi->Sensor;
+	_pi->StateCS.leave();
+
+	if (state == Impl::STATE_IN_FLIGHT && sensor != NULL)
+		sensor->abandonTransaction(_pi);
+
+	// The transaction may have been taken out of flight just before it was
+	// abandoned, in which case its handler must finish first.
+	while (_pi->state() == Impl::STATE_COMPLETING)
+		_pi->CompletedEvent.wait();
+
+	delete _pi;
+}
+
+bool PendingTransaction::isCompleted()
+{
+	return _pi->state() == Impl::STATE_COMPLETED;
+}
+
+Packet& PendingTransaction::wait()
+{
+	Impl::State state = _pi->state();
+
+	if (state == Impl::STATE_IDLE)
+		throw invalid_operation();
+
+	if (state != Impl::STATE_COMPLETED)
+	{
+		while (_pi->state() != Impl::STATE_COMPLETED)
+			_pi->CompletedEvent.wait();
+
+		// Pass the signal on to any other thread waiting on the transaction.
+		_pi->CompletedEvent.signal();
+	}
+
+	switch (_pi->Result)
+	{
+		case Impl::OUTCOME_TIMEOUT:
+			throw timeout();
+
+		case Impl::OUTCOME_DISCONNECTED:
+			throw invalid_operation();
+
+		default:
+			break;
+	}
+
+	if (_pi->Response.isError())
+		throw sensor_error(_pi->Response.parseError());
+
+	return _pi->Response;
+}
+
+uint32_t PendingTransaction::retransmits()
+{
+	_pi->StateCS.enter();
+	uint32_t retransmits = _pi->Retransmits;
+	_pi->StateCS.leave();
+
+	return retransmits;
+}
+
 string VnSensor::send(string toSend, bool waitForReply, ErrorDetectionMode errorDetectionMode)
 {
 	Packet p;
-	char *buffer = new char[toSend.size() + 8];	// Extra room for possible additions.
+	// Extra room for a '$', a '*', a CRC, "\r\n" and the builder's null
+	// terminator.
+	size_t bufferSize = toSend.size() + 9;
+	char *buffer = new char[bufferSize];
 	size_t curToSendLength = toSend.size();
 
 	// See if a '$' needs to be prepended.
 	if (toSend[0] == '$')
 	{
 		#if VN_HAVE_SECURE_SCL
-		toSend._Copy_s(buffer, toSend.size() + 8, toSend.size());
+		toSend._Copy_s(buffer, bufferSize, toSend.size());
 		#else
 		toSend.copy(buffer, toSend.size());
 		#endif
@@ -751,7 +1548,7 @@ string VnSensor::send(string toSend, bool waitForReply, ErrorDetectionMode error
 	{
 		buffer[0] = '$';
 		#if VN_HAVE_SECURE_SCL
-		toSend._Copy_s(buffer + 1, toSend.size() + 8 - 1, toSend.size());
+		toSend._Copy_s(buffer + 1, bufferSize - 1, toSend.size());
 		#else
 		toSend.copy(buffer + 1, toSend.size());
 		#endif
@@ -779,30 +1576,16 @@ string VnSensor::send(string toSend, bool waitForReply, ErrorDetectionMode error
 	// Do we need to add a checksum/CRC?
 	if (astrickLocation == curToSendLength - 1)
 	{
+		CommandBuilder command(buffer + curToSendLength, bufferSize - curToSendLength);
+
 		if (errorDetectionMode == ERRORDETECTIONMODE_CHECKSUM)
-		{
-			#if VN_HAVE_SECURE_CRT
-			curToSendLength += sprintf_s(buffer + curToSendLength, toSend.size() + 8 - curToSendLength, "%02X\r\n", Checksum8::compute(buffer + 1, curToSendLength - 2));
-			#else
-			curToSendLength += sprintf(buffer + curToSendLength, "%02X\r\n", Checksum8::compute(buffer + 1, curToSendLength - 2));
-			#endif
-		}
+			command.appendHex(Checksum8::compute(buffer + 1, curToSendLength - 2), 2).append("\r\n");
 		else if (errorDetectionMode == ERRORDETECTIONMODE_CRC)
-		{
-			#if VN_HAVE_SECURE_CRT
-			curToSendLength += sprintf_s(buffer + curToSendLength, toSend.size() + 8 - curToSendLength, "%04X\r\n", Crc16::compute(buffer + 1, curToSendLength - 2));
-			#else
-			curToSendLength += sprintf(buffer + curToSendLength, "%04X\r\n", Crc16::compute(buffer + 1, curToSendLength - 2));
-			#endif
-		}
+			command.appendHex(Crc16::compute(buffer + 1, curToSendLength - 2), 4).append("\r\n");
 		else
-		{
-			#if VN_HAVE_SECURE_CRT
-			curToSendLength += sprintf_s(buffer + curToSendLength, toSend.size() + 8 - curToSendLength, "*XX\r\n");
-			#else
-			curToSendLength += sprintf(buffer + curToSendLength, "*XX\r\n");
-			#endif
-		}
+			command.append("XX\r\n");
+
+		curToSendLength += command.length();
 	}
 	// Do we need to add "\r\n"?
 	else if (buffer[curToSendLength - 1] != '\n')
@@ -922,6 +1705,78 @@ void VnSensor::unregisterErrorPacketReceivedHandler()
 	_pi->_errorPacketReceivedUserData = NULL;
 }
 
+void VnSensor::enablePipeline(size_t queueCapacity, size_t numOfWorkers)
+{
+	if (isPipelineEnabled())
+		throw invalid_operation();
+
+	if (numOfWorkers == 0)
+		throw invalid_argument("numOfWorkers");
+
+	vector<Impl::PipelineWorker*> workers;
+
+	try
+	{
+		for (size_t i = 0; i < numOfWorkers; i++)
+		{
+			workers.push_back(new Impl::PipelineWorker(_pi, queueCapacity));
+
+			workers.back()->WorkerThread = Thread::startNew(Impl::PipelineWorker::workerRoutine, workers.back());
+		}
+	}
+	catch (...)
+	{
+		Impl::stopPipelineWorkers(workers);
+
+		throw;
+	}
+
+	_pi->replacePipelineWorkers(workers);
+}
+
+void VnSensor::disablePipeline()
+{
+	if (!isPipelineEnabled())
+		throw invalid_operation();
+
+	vector<Impl::PipelineWorker*> workers;
+
+	_pi->replacePipelineWorkers(workers);
+}
+
+bool VnSensor::isPipelineEnabled()
+{
+	_pi->_pipelineCS.enter();
+	bool isEnabled = !_pi->_pipelineWorkers.empty();
+	_pi->_pipelineCS.leave();
+
+	return isEnabled;
+}
+
+PipelineStatistics VnSensor::pipelineStatistics()
+{
+	PipelineStatistics statistics;
+
+	_pi->_pipelineCS.enter();
+
+	for (size_t i = 0; i < _pi->_pipelineWorkers.size(); i++)
+	{
+		PacketQueue& queue = _pi->_pipelineWorkers[i]->Queue;
+
+		statistics.numOfPacketsQueued += queue.numOfPacketsQueued();
+		statistics.numOfPacketsDropped += queue.numOfPacketsDropped();
+		statistics.numOfHandlerExceptions += _pi->_pipelineWorkers[i]->numOfHandlerExceptions();
+		statistics.depth += queue.depth();
+
+		if (queue.maximumDepth() > statistics.maximumDepth)
+			statistics.maximumDepth = queue.maximumDepth();
+	}
+
+	_pi->_pipelineCS.leave();
+
+	return statistics;
+}
+
 void VnSensor::writeSettings(bool waitForReply)
 {
 	char toSend[37];
@@ -1048,6 +1903,131 @@ VnSensor::Family VnSensor::determineDeviceFamily(std::string modelNumber)
 	return VnSensor_Family_Unknown;
 }
 
+SensorIdentity VnSensor::readIdentity(const string &cacheDirectory)
+{
+	char toSend[17];
+	size_t length;
+	SensorIdentity identity;
+	PendingTransaction serialNumber, modelNumber, firmwareVersion, hardwareRevision;
+
+	length = Packet::genReadSerialNumber(_pi->_sendErrorDetectionMode, toSend, sizeof(toSend));
+	_pi->beginTransaction(serialNumber, toSend, length);
+
+	// The firmware version changes when the sensor is updated, so it is never
+	// taken from the cache.
+	length = Packet::genReadFirmwareVersion(_pi->_sendErrorDetectionMode, toSend, sizeof(toSend));
+	_pi->beginTransaction(firmwareVersion, toSend, length);
+
+	// Without a cache there is no reason to wait for the serial number.
+	bool cached = !cacheDirectory.empty();
+	bool loaded = false;
+
+	if (cached)
+	{
+		serialNumber.wait().parseSerialNumber(&identity.serialNumber);
+
+		loaded = loadIdentity(identityCacheFile(cacheDirectory, identity.serialNumber), identity);
+	}
+
+	if (!loaded)
+	{
+		length = Packet::genReadModelNumber(_pi->_sendErrorDetectionMode, toSend, sizeof(toSend));
+		_pi->beginTransaction(modelNumber, toSend, length);
+
+		length = Packet::genReadHardwareRevision(_pi->_sendErrorDetectionMode, toSend, sizeof(toSend));
+		_pi->beginTransaction(hardwareRevision, toSend, length);
+	}
+
+	if (!cached)
+		serialNumber.wait().parseSerialNumber(&identity.serialNumber);
+
+	char buffer[50];
+
+	firmwareVersion.wait().parseFirmwareVersion(buffer);
+	identity.firmwareVersion = buffer;
+
+	if (loaded)
+		return identity;
+
+	modelNumber.wait().parseModelNumber(buffer);
+	identity.modelNumber = buffer;
+
+	hardwareRevision.wait().parseHardwareRevision(&identity.hardwareRevision);
+
+	if (cached)
+		saveIdentity(identityCacheFile(cacheDirectory, identity.serialNumber), identity);
+
+	return identity;
+}
+
+size_t VnSensor::applyOutputConfiguration(const OutputConfiguration &configuration, bool persist)
+{
+	char toSend[256];
+	size_t length;
+	const BinaryOutputRegister* desired[] = { &configuration.binaryOutput1, &configuration.binaryOutput2, &configuration.binaryOutput3 };
+	PendingTransaction asyncDataOutputType;
+	PendingTransaction binaryOutputs[3];
+
+	// Read back every register before comparing any of them.
+	length = Packet::genReadAsyncDataOutputType(_pi->_sendErrorDetectionMode, toSend, sizeof(toSend));
+	_pi->beginTransaction(asyncDataOutputType, toSend, length);
+
+	for (uint8_t i = 0; i < 3; i++)
+	{
+		length = _pi->finalizeCommandToSend(toSend, Impl::genReadBinaryOutput(i + 1, toSend, sizeof(toSend)));
+		_pi->beginTransaction(binaryOutputs[i], toSend, length);
+	}
+
+	uint32_t currentAsyncDataOutputType;
+	asyncDataOutputType.wait().parseAsyncDataOutputType(&currentAsyncDataOutputType);
+
+	BinaryOutputRegister current[3];
+	for (size_t i = 0; i < 3; i++)
+		current[i] = Impl::parseBinaryOutput(binaryOutputs[i].wait());
+
+	// Then write the registers which differ, again all at once.
+	bool asyncDataOutputTypeWritten = currentAsyncDataOutputType != static_cast<uint32_t>(configuration.asyncDataOutputType);
+	bool binaryOutputWritten[3];
+	size_t numOfWrites = 0;
+
+	if (asyncDataOutputTypeWritten)
+	{
+		length = Packet::genWriteAsyncDataOutputType(_pi->_sendErrorDetectionMode, toSend, sizeof(toSend), configuration.asyncDataOutputType);
+		_pi->beginTransaction(asyncDataOutputType, toSend, length);
+		numOfWrites++;
+	}
+
+	for (uint8_t i = 0; i < 3; i++)
+	{
+		binaryOutputWritten[i] = !binaryOutputMatches(current[i], *desired[i]);
+
+		if (binaryOutputWritten[i])
+		{
+			length = _pi->finalizeCommandToSend(toSend, Impl::genWriteBinaryOutput(i + 1, *desired[i], toSend, sizeof(toSend)));
+			_pi->beginTransaction(binaryOutputs[i], toSend, length);
+			numOfWrites++;
+		}
+	}
+
+	if (asyncDataOutputTypeWritten)
+		asyncDataOutputType.wait();
+
+	for (uint8_t i = 0; i < 3; i++)
+	{
+		if (binaryOutputWritten[i])
+			binaryOutputs[i].wait();
+
+		// The outputs left alone still need to be known to the packet
+		// finder.
+		_pi->expectBinaryOutput(i + 1, binaryOutputWritten[i] ? *desired[i] : current[i]);
+	}
+
+	if (persist && numOfWrites != 0)
+		writeSettings();
+
+	return numOfWrites;
+}
+
 BinaryOutputRegister VnSensor::readBinaryOutput1()
 {
 	return _pi->readBinaryOutput(1);
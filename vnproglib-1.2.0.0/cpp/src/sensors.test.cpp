@@ -0,0 +1,304 @@
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <stdexcept>
+
+#include "vn/sensors.h"
+#include "vn/port.h"
+#include "vn/thread.h"
+#include "vn/vntime.h"
+#include "vn/event.h"
+#include "vn/criticalsection.h"
+#include "vn/error_detection.h"
+
+#include "allocations.test.h"
+
+using namespace std;
+using namespace vn::sensors;
+using namespace vn::xplat;
+using namespace vn::data::integrity;
+
+namespace {
+
+// Port which answers every command with a serial number register response
+// from its own thread, the way a serial port's reader thread delivers data.
+// Nothing is allocated once the port is open.
+class FakeSensorPort : public IPort
+{
+public:
+
+	FakeSensorPort() :
+		_isOpen(false),
+		_stopRequested(false),
+		_numOfRequests(0),
+		_writtenLength(0),
+		_responseLength(0),
+		_handler(NULL),
+		_handlerUserData(NULL),
+		_responder(NULL)
+	{
+	}
+
+	~FakeSensorPort()
+	{
+		close();
+	}
+
+	void open()
+	{
+		_stopRequested = false;
+		_isOpen = true;
+		_responder = Thread::startNew(respond, this);
+	}
+
+	void close()
+	{
+		if (!_isOpen)
+			return;
+
+		_stateCS.enter();
+		_stopRequested = true;
+		_stateCS.leave();
+
+		_requestEvent.signal();
+		_responder->join();
+
+		delete _responder;
+		_responder = NULL;
+		_isOpen = false;
+	}
+
+	bool isOpen()
+	{
+		return _isOpen;
+	}
+
+	void write(const char data[], size_t length)
+	{
+		_stateCS.enter();
+		_numOfRequests++;
+		_writtenLength = length < sizeof(_written) ? length : sizeof(_written);
+		memcpy(_written, data, _writtenLength);
+		_stateCS.leave();
+
+		_requestEvent.signal();
+	}
+
+	// Returns the data of the last write.
+	string written()
+	{
+		_stateCS.enter();
+		string data(_written, _writtenLength);
+		_stateCS.leave();
+
+		return data;
+	}
+
+	void read(char dataBuffer[], size_t numOfBytesToRead, size_t &numOfBytesActuallyRead)
+	{
+		_dataCS.enter();
+
+		numOfBytesActuallyRead = _responseLength < numOfBytesToRead ? _responseLength : numOfBytesToRead;
+		memcpy(dataBuffer, _response, numOfBytesActuallyRead);
+		_responseLength = 0;
+
+		_dataCS.leave();
+	}
+
+	void registerDataReceivedHandler(void* userData, DataReceivedHandler handler)
+	{
+		_handlerCS.enter();
+		_handler = handler;
+		_handlerUserData = userData;
+		_handlerCS.leave();
+	}
+
+	void unregisterDataReceivedHandler()
+	{
+		_handlerCS.enter();
+		_handler = NULL;
+		_handlerUserData = NULL;
+		_handlerCS.leave();
+	}
+
+	// Hands data to the handler as if the sensor had sent it unprompted.
+	void receive(const char* data, size_t length)
+	{
+		_dataCS.enter();
+		memcpy(_response, data, length);
+		_responseLength = length;
+		_dataCS.leave();
+
+		// The handler reads the data through read(), so it is called without
+		// the data lock held.
+		_handlerCS.enter();
+		if (_handler != NULL)
+			_handler(_handlerUserData);
+		_handlerCS.leave();
+	}
+
+private:
+
+	static void respond(void* userData)
+	{
+		FakeSensorPort* port = static_cast<FakeSensorPort*>(userData);
+
+		const char Body[] = "VNRRG,03,0100012345";
+
+		char response[64];
+		int responseLength = sprintf(response, "$%s*%02X\r\n", Body, Checksum8::compute(Body, strlen(Body)));
+
+		while (true)
+		{
+			port->_requestEvent.wait();
+
+			port->_stateCS.enter();
+			bool stopRequested = port->_stopRequested;
+			size_t numOfRequests = port->_numOfRequests;
+			port->_numOfRequests = 0;
+			port->_stateCS.leave();
+
+			if (stopRequested)
+				return;
+
+			for (size_t i = 0; i < numOfRequests; i++)
+				port->receive(response, responseLength);
+		}
+	}
+
+	bool _isOpen;
+	bool _stopRequested;
+	size_t _numOfRequests;
+	char _written[128];
+	size_t _writtenLength;
+	char _response[128];
+	size_t _responseLength;
+	DataReceivedHandler _handler;
+	void* _handlerUserData;
+	Thread* _responder;
+	Event _requestEvent;
+	CriticalSection _stateCS;
+	CriticalSection _dataCS;
+	CriticalSection _handlerCS;
+};
+
+void throwOnPacket(void*, vn::protocol::uart::PacketView&, size_t)
+{
+	throw std::runtime_error("handler failed");
+}
+
+}
+
+TEST(VnSensor, SynchronousCommandsDoNotAllocate)
+{
+	FakeSensorPort port;
+
+	VnSensor sensor;
+	sensor.connect(&port);
+
+	// The first command creates the transaction which later commands reuse.
+	ASSERT_EQ(100012345u, sensor.readSerialNumber());
+
+	size_t allocationsBefore = numOfAllocations();
+
+	for (int i = 0; i < 100; i++)
+		ASSERT_EQ(100012345u, sensor.readSerialNumber());
+
+	EXPECT_EQ(0u, numOfAllocations() - allocationsBefore);
+
+	sensor.disconnect();
+}
+
+TEST(VnSensor, ResponsesOnlyCompleteTheCommandTheyEcho)
+{
+	FakeSensorPort port;
+
+	VnSensor sensor;
+	sensor.connect(&port);
+
+	// A command without a name, like the bootloader's baudrate calibration,
+	// is answered with the serial number response the port sends for every
+	// command, which must not complete it.
+	const char Unnamed[] = "        ";
+	PendingTransaction unnamed;
+	sensor.beginTransaction(unnamed, Unnamed, sizeof(Unnamed) - 1, NULL, NULL);
+
+	EXPECT_EQ(100012345u, sensor.readSerialNumber());
+	EXPECT_FALSE(unnamed.isCompleted());
+
+	sensor.disconnect();
+
+	EXPECT_TRUE(unnamed.isCompleted());
+}
+
+TEST(VnSensor, PipelineCountsHandlerExceptions)
+{
+	FakeSensorPort port;
+
+	VnSensor sensor;
+	sensor.connect(&port);
+	sensor.registerAsyncPacketReceivedHandler(NULL, throwOnPacket);
+	sensor.enablePipeline(16, 2);
+
+	const char Body[] = "VNYMR,+010.000,+001.000,-002.000";
+
+	char packet[64];
+	int packetLength = sprintf(packet, "$%s*%02X\r\n", Body, Checksum8::compute(Body, strlen(Body)));
+
+	for (int i = 0; i < 3; i++)
+		port.receive(packet, packetLength);
+
+	// The workers dispatch the packets on their own threads.
+	Stopwatch sw;
+	while (sensor.pipelineStatistics().numOfHandlerExceptions < 3 && sw.elapsedMs() < 1000)
+		Thread::sleepMs(1);
+
+	PipelineStatistics statistics = sensor.pipelineStatistics();
+	EXPECT_EQ(3u, statistics.numOfPacketsQueued);
+	EXPECT_EQ(3u, statistics.numOfHandlerExceptions);
+
+	sensor.disablePipeline();
+	sensor.unregisterAsyncPacketReceivedHandler();
+	sensor.disconnect();
+}
+
+TEST(VnSensor, SendCompletesTheCommand)
+{
+	FakeSensorPort port;
+
+	VnSensor sensor;
+	sensor.connect(&port);
+
+	const char Body[] = "VNRRG,03";
+
+	char checksum[16];
+	sprintf(checksum, "%02X\r\n", Checksum8::compute(Body, strlen(Body)));
+
+	char crc[16];
+	sprintf(crc, "%04X\r\n", Crc16::compute(Body, strlen(Body)));
+
+	const char* Commands[] = { "VNRRG,03", "$VNRRG,03", "VNRRG,03*", "$VNRRG,03*" };
+
+	for (size_t i = 0; i < sizeof(Commands) / sizeof(Commands[0]); i++)
+	{
+		sensor.send(Commands[i], false, vn::protocol::uart::ERRORDETECTIONMODE_NONE);
+		EXPECT_EQ("$VNRRG,03*XX\r\n", port.written()) << Commands[i];
+
+		sensor.send(Commands[i], false, vn::protocol::uart::ERRORDETECTIONMODE_CHECKSUM);
+		EXPECT_EQ(string("$VNRRG,03*") + checksum, port.written()) << Commands[i];
+
+		sensor.send(Commands[i], false, vn::protocol::uart::ERRORDETECTIONMODE_CRC);
+		EXPECT_EQ(string("$VNRRG,03*") + crc, port.written()) << Commands[i];
+	}
+
+	// A command which already has its checksum only gets a line ending.
+	sensor.send("VNRRG,03*XX", false, vn::protocol::uart::ERRORDETECTIONMODE_CRC);
+	EXPECT_EQ("$VNRRG,03*XX\r\n", port.written());
+
+	sensor.send("$VNRRG,03*XX\r\n", false, vn::protocol::uart::ERRORDETECTIONMODE_CRC);
+	EXPECT_EQ("$VNRRG,03*XX\r\n", port.written());
+
+	sensor.disconnect();
+}
@@ -495,6 +495,97 @@ struct SerialPort::Impl
 			throw invalid_operation("Port is not closed.");
 	}
 
+	#if __linux__ || __APPLE__ || __CYGWIN__ || __QNXNTO__
+
+	static tcflag_t determineBaudrateFlag(uint32_t baudrate)
+	{
+		switch (baudrate)
+		{
+			case 9600:
+				return B9600;
+			case 19200:
+				return B19200;
+			case 38400:
+				return B38400;
+			case 57600:
+				return B57600;
+			case 115200:
+				return B115200;
+
+			// QNX does not have higher baudrates defined.
+			#if !defined(__QNXNTO__)
+
+			case 230400:
+				return B230400;
+
+			// Not available on Mac OS X???
+			#if !defined(__APPLE__)
+
+			case 460800:
+				return B460800;
+			case 921600:
+				return B921600;
+
+			#endif
+
+			#endif
+
+			default:
+				throw unknown_error();
+		}
+	}
+
+	#endif
+
+	// Changes the baudrate of the open port in place, which keeps the
+	// notifications thread running and is much quicker than reopening the
+	// port. Data received at the previous baudrate is discarded.
+	void reconfigureBaudrate(uint32_t baudrate)
+	{
+		#if _WIN32
+
+		DCB config;
+
+		if (!GetCommState(SerialPortHandle, &config))
+			throw unknown_error();
+
+		config.BaudRate = baudrate;
+
+		if (!SetCommState(SerialPortHandle, &config))
+		{
+			if (GetLastError() == ERROR_INVALID_PARAMETER)
+				throw invalid_argument("Unsupported baudrate.");
+
+			throw unknown_error();
+		}
+
+		if (!PurgeComm(SerialPortHandle, PURGE_RXCLEAR))
+			throw unknown_error();
+
+		#elif __linux__ || __APPLE__ || __CYGWIN__ || __QNXNTO__
+
+		tcflag_t baudrateFlag = determineBaudrateFlag(baudrate);
+		termios portSettings;
+
+		if (tcgetattr(SerialPortHandle, &portSettings) != 0)
+			throw unknown_error();
+
+		if (cfsetispeed(&portSettings, baudrateFlag) != 0 || cfsetospeed(&portSettings, baudrateFlag) != 0)
+			throw unknown_error();
+
+		if (tcsetattr(SerialPortHandle, TCSANOW, &portSettings) != 0)
+			throw unknown_error();
+
+		if (tcflush(SerialPortHandle, TCIFLUSH) != 0)
+			throw unknown_error();
+
+		#else
+		#error "Unknown System"
+		#endif
+
+		Baudrate = baudrate;
+	}
+
 	void open(bool checkAndToggleIsOpenFlag = true)
 	{
 		if (checkAndToggleIsOpenFlag)
@@ -669,50 +760,7 @@ struct SerialPort::Impl
 			0,
 			sizeof(termios));
 
-		tcflag_t baudrateFlag;
-
-		switch (Baudrate)
-		{
-			case 9600:
-				baudrateFlag = B9600;
-				break;
-			case 19200:
-				baudrateFlag = B19200;
-				break;
-			case 38400:
-				baudrateFlag = B38400;
-				break;
-			case 57600:
-				baudrateFlag = B57600;
-				break;
-			case 115200:
-				baudrateFlag = B115200;
-				break;
-
-			// QNX does not have higher baudrates defined.
-			#if !defined(__QNXNTO__)
-
-			case 230400:
-				baudrateFlag = B230400;
-				break;
-			
-			// Not available on Mac OS X???
-			#if !defined(__APPLE__)
-		
-			case 460800:
-				baudrateFlag = B460800;
-				break;
-			case 921600:
-				baudrateFlag = B921600;
-				break;
-			
-			#endif
-		
-			#endif
-
-			default:
-				throw unknown_error();
-		}
+		tcflag_t baudrateFlag = determineBaudrateFlag(Baudrate);
 
 		// Set baudrate, 8n1, no modem control, and enable receiving characters.
 		#if __linux__ || __CYGWIN__ || __QNXNTO__
@@ -1398,11 +1446,7 @@ void SerialPort::changeBaudrate(uint32_t baudrate)
 {
 	_pi->ensureOpened();
 
-	_pi->close(false);
-
-	_pi->Baudrate = baudrate;
-
-	_pi->open(false);
+	_pi->reconfigureBaudrate(baudrate);
 }
 
 size_t SerialPort::NumberOfReceiveDataDroppedSections()
@@ -21,37 +21,6 @@ VpeStatus::VpeStatus(uint16_t raw)
 	knownAccelDisturbance = (0x1000 & raw) != 0;
 }
 
-
-CommonGroup operator|(CommonGroup lhs, CommonGroup rhs)
-{
-	return CommonGroup(int(lhs) | int(rhs));
-}
-
-TimeGroup operator|(TimeGroup lhs, TimeGroup rhs)
-{
-	return TimeGroup(int(lhs) | int(rhs));
-}
-
-ImuGroup operator|(ImuGroup lhs, ImuGroup rhs)
-{
-	return ImuGroup(int(lhs) | int(rhs));
-}
-
-GpsGroup operator|(GpsGroup lhs, GpsGroup rhs)
-{
-	return GpsGroup(int(lhs) | int(rhs));
-}
-
-AttitudeGroup operator|(AttitudeGroup lhs, AttitudeGroup rhs)
-{
-	return AttitudeGroup(int(lhs) | int(rhs));
-}
-
-InsGroup operator|(InsGroup lhs, InsGroup rhs)
-{
-	return InsGroup(int(lhs) | int(rhs));
-}
-
 }
 }
 }
@@ -8,7 +8,7 @@ namespace vn {
 namespace protocol {
 namespace uart {
 
-char* vnstrtok(char* str, size_t& startIndex);
+const char* vnstrtok(const char* str, size_t& startIndex);
 
 string str(AsciiAsync val)
 {